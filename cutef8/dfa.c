@@ -5,6 +5,25 @@
 
 #include "dfa.h"
 
+#include <string.h>
+
+// NOTE: Like FBInk's span fills, the ASCII fast path is vectorized depending on the target ISA,
+//       unless FBINK_NO_SIMD is defined, in which case we fall back to SWAR on a 64-bit word.
+#ifndef FBINK_NO_SIMD
+#	if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#		include <arm_neon.h>
+#		define CUTEF8_SIMD_NEON
+#	elif defined(__SSE2__)
+#		include <emmintrin.h>
+#		define CUTEF8_SIMD_SSE2
+#	endif
+#endif
+#if defined(CUTEF8_SIMD_NEON) || defined(CUTEF8_SIMD_SSE2)
+#	define CUTEF8_BLOCK_BYTES 16U
+#else
+#	define CUTEF8_BLOCK_BYTES 8U
+#endif
+
 static const uint8_t utf8d[] = {
 	0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 	0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -46,13 +65,82 @@ inline static uint8_t
 	return *state;
 }
 
+// Returns true if the CUTEF8_BLOCK_BYTES bytes @ s are all plain ASCII (i.e., < 0x80).
+// NOTE: s must be aligned to CUTEF8_BLOCK_BYTES, and the whole block must be part of the string:
+//       callers never let us read past the NUL terminator, in order to keep ASan & Valgrind happy.
+//       As such, we don't have to look for a NUL in there, either.
+inline static bool
+    is_ascii_block(const uint8_t* restrict s)
+{
+#if defined(CUTEF8_SIMD_NEON)
+	const uint8x16_t v   = vld1q_u8(s);
+	const uint8x16_t bad = vtstq_u8(v, vdupq_n_u8(0x80u));
+	// NOTE: No horizontal reductions on ARMv7, so, fold it down to a pair of 64-bit lanes instead
+	const uint64x2_t b64 = vreinterpretq_u64_u8(bad);
+	return (vgetq_lane_u64(b64, 0) | vgetq_lane_u64(b64, 1)) == 0U;
+#elif defined(CUTEF8_SIMD_SSE2)
+	const __m128i v = _mm_load_si128((const __m128i*) (const void*) s);
+	return _mm_movemask_epi8(v) == 0;
+#else
+	uint64_t w;
+	memcpy(&w, s, sizeof(w));
+	return (w & 0x8080808080808080u) == 0U;
+#endif
+}
+
+// Widen a block of plain ASCII (as vetted by is_ascii_block) to codepoints
+inline static void
+    widen_ascii_block(const uint8_t* restrict s, uint32_t* restrict dst)
+{
+#if defined(CUTEF8_SIMD_NEON)
+	const uint8x16_t v  = vld1q_u8(s);
+	const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+	const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+	vst1q_u32(dst, vmovl_u16(vget_low_u16(lo)));
+	vst1q_u32(dst + 4U, vmovl_u16(vget_high_u16(lo)));
+	vst1q_u32(dst + 8U, vmovl_u16(vget_low_u16(hi)));
+	vst1q_u32(dst + 12U, vmovl_u16(vget_high_u16(hi)));
+#elif defined(CUTEF8_SIMD_SSE2)
+	const __m128i v    = _mm_load_si128((const __m128i*) (const void*) s);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i lo   = _mm_unpacklo_epi8(v, zero);
+	const __m128i hi   = _mm_unpackhi_epi8(v, zero);
+	_mm_storeu_si128((__m128i*) (void*) dst, _mm_unpacklo_epi16(lo, zero));
+	_mm_storeu_si128((__m128i*) (void*) (dst + 4U), _mm_unpackhi_epi16(lo, zero));
+	_mm_storeu_si128((__m128i*) (void*) (dst + 8U), _mm_unpacklo_epi16(hi, zero));
+	_mm_storeu_si128((__m128i*) (void*) (dst + 12U), _mm_unpackhi_epi16(hi, zero));
+#else
+	for (uint8_t i = 0U; i < CUTEF8_BLOCK_BYTES; i++) {
+		dst[i] = s[i];
+	}
+#endif
+}
+
+// Are we at the start of a fresh sequence, on a block boundary?
+#define CAN_SKIP_BLOCK(state, s) ((state) == UTF8_ACCEPT && ((uintptr_t) (s) & (CUTEF8_BLOCK_BYTES - 1U)) == 0U)
+// Is there still a full block of string left @ s?
+#define HAS_BLOCK(s, end)        ((size_t) ((end) - (s)) >= CUTEF8_BLOCK_BYTES)
+
 inline static int
     count_codepoints(const char* restrict str, size_t* restrict count)
 {
-	uint8_t state = 0;
-
-	for (*count = 0; *str; ++str) {
-		if (!check(&state, *(const uint8_t*) str)) {
+	const uint8_t* restrict s     = (const uint8_t*) str;
+	// NOTE: We need the length to keep the block reads within the string, and libc's strlen is fast enough
+	const uint8_t*          end   = s + strlen(str);
+	uint8_t                 state = 0;
+
+	for (*count = 0; s < end; ++s) {
+		// Plain ASCII is one codepoint per byte, and never changes the state, so, skip through it a block at a time
+		if (CAN_SKIP_BLOCK(state, s)) {
+			while (HAS_BLOCK(s, end) && is_ascii_block(s)) {
+				*count += CUTEF8_BLOCK_BYTES;
+				s      += CUTEF8_BLOCK_BYTES;
+			}
+			if (s == end) {
+				break;
+			}
+		}
+		if (!check(&state, *s)) {
 			*count += 1;
 		}
 	}
@@ -76,15 +164,54 @@ size_t
 bool
     u8_isvalid2(const char* restrict str)
 {
-	uint8_t state = 0;
-
-	while (*str) {
-		check(&state, *(const uint8_t*) str++);
+	const uint8_t* restrict s     = (const uint8_t*) str;
+	const uint8_t*          end   = s + strlen(str);
+	uint8_t                 state = 0;
+
+	while (s < end) {
+		if (CAN_SKIP_BLOCK(state, s)) {
+			while (HAS_BLOCK(s, end) && is_ascii_block(s)) {
+				s += CUTEF8_BLOCK_BYTES;
+			}
+			if (s == end) {
+				break;
+			}
+		}
+		check(&state, *s++);
 	}
 
 	return state == UTF8_ACCEPT;
 }
 
+size_t
+    u8_decode2(const char* restrict str, uint32_t* restrict dst, size_t size)
+{
+	const uint8_t* restrict s     = (const uint8_t*) str;
+	const uint8_t*          end   = s + strlen(str);
+	uint32_t                ch    = 0;
+	uint8_t                 state = 0;
+	size_t                  count = 0;
+
+	while (s < end && count < size) {
+		if (CAN_SKIP_BLOCK(state, s)) {
+			while (count + CUTEF8_BLOCK_BYTES <= size && HAS_BLOCK(s, end) && is_ascii_block(s)) {
+				widen_ascii_block(s, dst + count);
+				count += CUTEF8_BLOCK_BYTES;
+				s     += CUTEF8_BLOCK_BYTES;
+			}
+			if (s == end || count == size) {
+				break;
+			}
+		}
+		if (!decode(&state, &ch, *s++)) {
+			dst[count++] = ch;
+		}
+	}
+
+	// NOTE: We only ever stop on a sequence boundary, so this only catches malformed input
+	return state == UTF8_ACCEPT ? count : 0;
+}
+
 // Take a stab at reimplementing u8_nextchar with the dfa decoder...
 // NOTE: For shit'n giggles, libunibreak also has its own next_char implementation... (ub_get_next_char_utf8 @ unibreakdef.c)
 // NOTE: As does glib, which should ensure a fairly battle-tested implementation...
@@ -17,6 +17,9 @@
 size_t u8_strlen2(const char* restrict s) __attribute__((pure));
 // Returns true if UTF-8 encoded string s is not malformed
 bool   u8_isvalid2(const char* restrict s) __attribute__((pure));
+// Decodes (at most) the first size codepoints of UTF-8 encoded string s into dst
+// Returns the # of codepoints decoded (or 0 if a malformed sequence was hit along the way)
+size_t u8_decode2(const char* restrict s, uint32_t* restrict dst, size_t size);
 
 // Like u8_nextchar, but using the dfa decoder
 uint32_t u8_nextchar2(const char* restrict s, size_t* restrict i);
@@ -531,6 +531,129 @@ static void
 	// https://github.com/NiLuJe/FBInk/commit/75407d4a44d7bfc7705665ad4ec9ecad0d03a368).
 }
 
+// The blit engine: every bulk write to the fb goes through here (c.f., fill_span*, blit_copy & blit_fence).
+// NOTE: On our targets, the fb mapping is write-combined: partial writes & read-backs stall the WC buffers,
+//       while a full cache line gets flushed in a single bus transaction.
+//       So, we never read from dst, and we write whole, aligned cache lines whenever we can.
+//       Where the ISA allows it, those go through non-temporal stores, which don't pollute the cache on the way.
+//       That only makes sense for the actual fb mapping, though: the shadow buffer is plain, cached heap memory.
+static inline __attribute__((always_inline)) bool
+    blit_wants_stream(void)
+{
+#ifdef FBINK_SIMD_STREAM
+	return shadowFb.fb_mem == NULL;
+#else
+	return false;
+#endif
+}
+
+// Non-temporal stores are weakly ordered, so, make them globally visible before anyone (e.g., the EPDC) looks at the fb.
+static inline __attribute__((always_inline)) void
+    blit_fence(bool stream __attribute__((unused)))
+{
+#ifdef FBINK_SIMD_STREAM
+	if (stream) {
+		_mm_sfence();
+	}
+#endif
+}
+
+#ifdef FBINK_SIMD_BYTES
+static inline __attribute__((always_inline, hot)) void
+    blit_store_vec(unsigned char* p, fbink_vec_t v, bool stream __attribute__((unused)))
+{
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+#	if defined(FBINK_SIMD_NEON)
+	vst1q_u8(p, v);
+#	elif defined(FBINK_SIMD_AVX2)
+	if (stream) {
+		_mm256_stream_si256((__m256i*) p, v);
+	} else {
+		_mm256_store_si256((__m256i*) p, v);
+	}
+#	elif defined(FBINK_SIMD_SSE2)
+	if (stream) {
+		_mm_stream_si128((__m128i*) p, v);
+	} else {
+		_mm_store_si128((__m128i*) p, v);
+	}
+#	endif
+#	pragma GCC diagnostic pop
+}
+
+static inline __attribute__((always_inline, hot)) fbink_vec_t
+    blit_load_vec(const unsigned char* p)
+{
+#	if defined(FBINK_SIMD_NEON)
+	return vld1q_u8(p);
+#	elif defined(FBINK_SIMD_AVX2)
+	return _mm256_loadu_si256((const __m256i*) p);
+#	elif defined(FBINK_SIMD_SSE2)
+	return _mm_loadu_si128((const __m128i*) p);
+#	endif
+}
+
+// Fill up to len bytes @ p (which *must* be vector-aligned) with v, returns the amount of bytes actually written,
+// which is always a multiple of FBINK_SIMD_BYTES (the caller takes care of the tail).
+// Single vectors get us to a cache line boundary, then we switch to full cache line bursts.
+static inline __attribute__((always_inline, hot)) size_t
+    blit_fill_vec(unsigned char* restrict p, fbink_vec_t v, size_t len, bool stream)
+{
+	size_t i = 0U;
+	for (; i + FBINK_SIMD_BYTES <= len && !IS_ALIGNED((uintptr_t) (p + i), BLIT_BURST_BYTES);
+	     i += FBINK_SIMD_BYTES) {
+		blit_store_vec(p + i, v, stream);
+	}
+	for (; i + BLIT_BURST_BYTES <= len; i += BLIT_BURST_BYTES) {
+		for (size_t k = 0U; k < BLIT_BURST_BYTES; k += FBINK_SIMD_BYTES) {
+			blit_store_vec(p + i + k, v, stream);
+		}
+	}
+	for (; i + FBINK_SIMD_BYTES <= len; i += FBINK_SIMD_BYTES) {
+		blit_store_vec(p + i, v, stream);
+	}
+	return i;
+}
+#endif    // FBINK_SIMD_BYTES
+
+// Copy len bytes from src (which may be unaligned) to dst, with the same burst layout as blit_fill_vec.
+// NOTE: dst must not overlap src. If stream is set, the caller is responsible for the final blit_fence.
+static inline __attribute__((always_inline, hot)) void
+    blit_copy(unsigned char* restrict dst,
+	      const unsigned char* restrict src,
+	      size_t len,
+	      bool stream __attribute__((unused)))
+{
+#ifdef FBINK_SIMD_BYTES
+	// Small copies wouldn't get any bursts in, don't bother.
+	if (len < BLIT_BURST_BYTES * 2U) {
+		memcpy(dst, src, len);
+		return;
+	}
+	size_t i = 0U;
+	while (!IS_ALIGNED((uintptr_t) (dst + i), FBINK_SIMD_BYTES)) {
+		dst[i] = src[i];
+		i++;
+	}
+	for (; i + FBINK_SIMD_BYTES <= len && !IS_ALIGNED((uintptr_t) (dst + i), BLIT_BURST_BYTES);
+	     i += FBINK_SIMD_BYTES) {
+		blit_store_vec(dst + i, blit_load_vec(src + i), stream);
+	}
+	for (; i + BLIT_BURST_BYTES <= len; i += BLIT_BURST_BYTES) {
+		for (size_t k = 0U; k < BLIT_BURST_BYTES; k += FBINK_SIMD_BYTES) {
+			blit_store_vec(dst + i + k, blit_load_vec(src + i + k), stream);
+		}
+	}
+	for (; i + FBINK_SIMD_BYTES <= len; i += FBINK_SIMD_BYTES) {
+		blit_store_vec(dst + i, blit_load_vec(src + i), stream);
+	}
+	memcpy(dst + i, src + i, len - i);
+#else
+	memcpy(dst, src, len);
+#endif
+}
+
 #ifdef FBINK_WITH_DRAW
 // Handle a few sanity checks...
 // NOTE: If you can, prefer using the right put_pixel_* function directly.
@@ -787,6 +910,476 @@ static inline __attribute__((always_inline, hot)) void
 	}
 }
 
+// Format-specialized variants of put_pixel & get_pixel.
+// NOTE: put_pixel & get_pixel have to figure out the pixel format for every single pixel,
+//       which adds up quickly in the innermost loops of our glyph & OT renderers.
+//       These are always inlined into "template" renderers that are in turn only ever called with a compile-time
+//       constant pxfmt (c.f., the *_Y4, *_Y8, ... stubs below), so the compiler folds all the format checks away,
+//       leaving us with one copy of each renderer per pixel format, and no format branching in its inner loops.
+//       fbink_init() then points fxpPlotGlyphRow & fxpPaintOTLine to the right copy, like it does for fxpFillRect.
+static inline __attribute__((always_inline, hot)) void
+    put_pixel_fmt(FBInkCoordinates coords, const FBInkPixel* restrict px, bool is_rgb565, FBINK_PXFMT_INDEX_T pxfmt)
+{
+	// Same rotation & bounds-checking as put_pixel
+	(*fxpRotateCoords)(&coords);
+	if (unlikely(coords.x >= vInfo.xres || coords.y >= vInfo.yres)) {
+		return;
+	}
+
+	if (pxfmt == FBINK_PXFMT_Y4) {
+		put_pixel_Gray4(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_Y8) {
+		put_pixel_Gray8(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_BGR565 || pxfmt == FBINK_PXFMT_RGB565) {
+		if (is_rgb565) {
+			put_pixel_RGB565(&coords, px);
+		} else {
+			FBInkPixel packed_px;
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#	pragma clang diagnostic ignored "-Wunknown-warning-option"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+			if (pxfmt == FBINK_PXFMT_BGR565) {
+				packed_px.rgb565 = pack_bgr565(px->bgra.color.r, px->bgra.color.g, px->bgra.color.b);
+			} else {
+				packed_px.rgb565 = pack_rgb565(px->rgba.color.r, px->rgba.color.g, px->rgba.color.b);
+			}
+#	pragma GCC diagnostic pop
+			put_pixel_RGB565(&coords, &packed_px);
+		}
+	} else if (pxfmt == FBINK_PXFMT_BGR24) {
+		put_pixel_BGR24(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_RGB24) {
+		put_pixel_RGB24(&coords, px);
+	} else {
+		put_pixel_RGB32(&coords, px);
+	}
+}
+
+static inline __attribute__((always_inline, hot)) void
+    get_pixel_fmt(FBInkCoordinates coords, FBInkPixel* restrict px, FBINK_PXFMT_INDEX_T pxfmt)
+{
+	// Same rotation & bounds-checking as get_pixel
+	(*fxpRotateCoords)(&coords);
+	if (unlikely(coords.x >= vInfo.xres || coords.y >= vInfo.yres)) {
+		return;
+	}
+
+	if (pxfmt == FBINK_PXFMT_Y4) {
+		get_pixel_Gray4(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_Y8) {
+		get_pixel_Gray8(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_BGR565) {
+		get_pixel_BGR565(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_RGB565) {
+		get_pixel_RGB565(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_BGR24) {
+		get_pixel_BGR24(&coords, px);
+	} else if (pxfmt == FBINK_PXFMT_RGB24) {
+		get_pixel_RGB24(&coords, px);
+	} else {
+		get_pixel_RGB32(&coords, px);
+	}
+}
+
+// Plot a single row of a fixed-cell glyph, scaled by FONTSIZE_MULT, one pixel at a time.
+// This is only used for the overlay, bgless & fgless modes, where we can't just batch stripes through fill_rect
+// (c.f., RENDER_GLYPH in draw).
+// row is the glyph's bitmask for that row (LSB is the leftmost column), (x_offs, cy) the top-left corner of the output row.
+static inline __attribute__((always_inline, hot)) void
+    plot_glyph_row(uint32_t                   row,
+		   unsigned short int         x_offs,
+		   unsigned short int         cy,
+		   const FBInkPixel* restrict fgP,
+		   const FBInkPixel* restrict bgP,
+		   bool                       is_overlay,
+		   bool                       is_fgless,
+		   FBINK_PXFMT_INDEX_T        pxfmt)
+{
+	FBInkCoordinates coords = { 0U };
+	FBInkPixel       fbP    = { 0U };
+	for (uint8_t x = 0U; x < glyphWidth; x++) {
+		const bool is_fgpx = !!(row & 1U << x);
+		// We only print fg pixels, unless we're fgless, in which case we only print bg pixels ;).
+		if (is_fgpx == is_fgless) {
+			continue;
+		}
+		// x: input column, cx: first output column after scaling
+		const unsigned short int cx = (unsigned short int) (x_offs + (x * FONTSIZE_MULT));
+		// NOTE: Apply our scaling factor in both dimensions!
+		for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {
+			coords.y = (unsigned short int) (cy + l);
+			for (uint8_t k = 0U; k < FONTSIZE_MULT; k++) {
+				coords.x = (unsigned short int) (cx + k);
+				if (is_fgless) {
+					put_pixel_fmt(coords, bgP, true, pxfmt);
+				} else if (is_overlay) {
+					// In overlay mode, we print in the inverse color of the underlying pixel.
+					// Obviously, the closer we get to GRAY7, the less contrast we get.
+					get_pixel_fmt(coords, &fbP, pxfmt);
+					fbP.p ^= 0x00FFFFFFu;
+					put_pixel_fmt(coords, &fbP, false, pxfmt);
+				} else {
+					put_pixel_fmt(coords, fgP, true, pxfmt);
+				}
+			}
+		}
+	}
+}
+
+#	ifdef FBINK_WITH_OPENTYPE
+// Paint a line of OT text to the fb, blending our fg & bg colors (or the underlying pixels),
+// using the rendered coverage mask as alpha.
+// What we get from stbtt is an alpha coverage mask, hence the need for alpha-blending for anti-aliasing.
+// As it's obviously expensive, we try to avoid it if possible (on fully opaque & fully transparent pixels).
+// NOTE: Please forgive the code repetition. Performance...
+static inline __attribute__((always_inline, hot)) void
+    paint_ot_line(const FBInkOTPaint* restrict p, FBINK_PXFMT_INDEX_T pxfmt)
+{
+	// NOTE: Since pxfmt is a constant, this is folded at compile-time (c.f., deviceQuirks.isRGB).
+	const bool is_rgb = (pxfmt == FBINK_PXFMT_RGB565 || pxfmt == FBINK_PXFMT_RGB24 || pxfmt == FBINK_PXFMT_RGBA ||
+			     pxfmt == FBINK_PXFMT_RGB32);
+	const unsigned char* restrict lnPtr       = p->mask;
+	FBInkCoordinates              paint_point = p->origin;
+	FBInkPixel                    pixel;
+	pixel.bgra.color.a = 0xFFu;
+	FBInkPixel fb_px   = { 0U };
+
+	if (!p->is_overlay && !p->is_fgless && !p->is_bgless) {
+		if (abs(p->layer_diff) == 0xFFu) {
+			// If we're painting in B&W, use the mask as-is, it's already B&W ;).
+			// We just need to invert it ;).
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b = lnPtr[k] ^ p->ainv;
+					put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		} else {
+			const uint16_t pmul_bg = (uint16_t) (p->bgcolor * 0xFFu);
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					if (lnPtr[k] == 0U) {
+						// No coverage (transparent) -> background
+						put_pixel_fmt(paint_point, &p->bgP, true, pxfmt);
+					} else if (lnPtr[k] == 0xFFu) {
+						// Full coverage (opaque) -> foreground
+						put_pixel_fmt(paint_point, &p->fgP, true, pxfmt);
+					} else {
+						// AA, blend it using the coverage mask as alpha
+						pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b =
+						    (uint8_t) DIV255((pmul_bg + (p->layer_diff * lnPtr[k])));
+						put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					}
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		}
+	} else if (p->is_fgless) {
+		const uint16_t pmul_bg = (uint16_t) (p->bgcolor * 0xFFu);
+		const uint8_t  bgcolor = p->bgcolor;
+		// NOTE: One more branch needed because 4bpp fbs are terrible...
+		if (pxfmt != FBINK_PXFMT_Y4) {
+			// 8, 16, 24 & 32bpp
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					if (lnPtr[k] == 0U) {
+						// No coverage (transparent) -> background
+						put_pixel_fmt(paint_point, &p->bgP, true, pxfmt);
+					} else if (lnPtr[k] != 0xFFu) {
+						// AA, blend it using the coverage mask as alpha,
+						// and the underlying pixel as fg
+						get_pixel_fmt(paint_point, &fb_px, pxfmt);
+						if (is_rgb) {
+							pixel.rgba.color.r = (uint8_t) DIV255(
+							    (pmul_bg + ((fb_px.rgba.color.r - bgcolor) * lnPtr[k])));
+							pixel.rgba.color.g = (uint8_t) DIV255(
+							    (pmul_bg + ((fb_px.rgba.color.g - bgcolor) * lnPtr[k])));
+							pixel.rgba.color.b = (uint8_t) DIV255(
+							    (pmul_bg + ((fb_px.rgba.color.b - bgcolor) * lnPtr[k])));
+						} else {
+							pixel.bgra.color.r = (uint8_t) DIV255(
+							    (pmul_bg + ((fb_px.bgra.color.r - bgcolor) * lnPtr[k])));
+							pixel.bgra.color.g = (uint8_t) DIV255(
+							    (pmul_bg + ((fb_px.bgra.color.g - bgcolor) * lnPtr[k])));
+							pixel.bgra.color.b = (uint8_t) DIV255(
+							    (pmul_bg + ((fb_px.bgra.color.b - bgcolor) * lnPtr[k])));
+						}
+						put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					}
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		} else {
+			// 4bpp... We'll have to alpha-blend *everything* to avoid clobbering pixels...
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					// AA, blend it using the coverage mask as alpha, and the underlying pixel as fg
+					get_pixel_fmt(paint_point, &fb_px, pxfmt);
+					pixel.gray8 = (uint8_t) DIV255((pmul_bg + ((fb_px.gray8 - bgcolor) * lnPtr[k])));
+					put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		}
+	} else if (p->is_overlay) {
+		if (pxfmt != FBINK_PXFMT_Y4) {
+			// 8, 16, 24 & 32bpp
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					if (lnPtr[k] == 0xFFu) {
+						// Full coverage (opaque) -> foreground
+						get_pixel_fmt(paint_point, &fb_px, pxfmt);
+						// We want our foreground to be the inverse of the underlying pixel...
+						pixel.p = fb_px.p ^ 0x00FFFFFFu;
+						put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					} else if (lnPtr[k] != 0U) {
+						// AA, blend it using the coverage mask as alpha,
+						// and the underlying pixel as bg
+						// Without forgetting our foreground color trickery...
+						get_pixel_fmt(paint_point, &fb_px, pxfmt);
+						if (is_rgb) {
+							pixel.rgba.color.r = (uint8_t) DIV255(
+							    (MUL255(fb_px.rgba.color.r) +
+							     (((fb_px.rgba.color.r ^ 0xFF) - fb_px.rgba.color.r) *
+							      lnPtr[k])));
+							pixel.rgba.color.g = (uint8_t) DIV255(
+							    (MUL255(fb_px.rgba.color.g) +
+							     (((fb_px.rgba.color.g ^ 0xFF) - fb_px.rgba.color.g) *
+							      lnPtr[k])));
+							pixel.rgba.color.b = (uint8_t) DIV255(
+							    (MUL255(fb_px.rgba.color.b) +
+							     (((fb_px.rgba.color.b ^ 0xFF) - fb_px.rgba.color.b) *
+							      lnPtr[k])));
+						} else {
+							pixel.bgra.color.r = (uint8_t) DIV255(
+							    (MUL255(fb_px.bgra.color.r) +
+							     (((fb_px.bgra.color.r ^ 0xFF) - fb_px.bgra.color.r) *
+							      lnPtr[k])));
+							pixel.bgra.color.g = (uint8_t) DIV255(
+							    (MUL255(fb_px.bgra.color.g) +
+							     (((fb_px.bgra.color.g ^ 0xFF) - fb_px.bgra.color.g) *
+							      lnPtr[k])));
+							pixel.bgra.color.b = (uint8_t) DIV255(
+							    (MUL255(fb_px.bgra.color.b) +
+							     (((fb_px.bgra.color.b ^ 0xFF) - fb_px.bgra.color.b) *
+							      lnPtr[k])));
+						}
+						put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					}
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		} else {
+			// 4bpp...
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
+					// Without forgetting our foreground color trickery...
+					get_pixel_fmt(paint_point, &fb_px, pxfmt);
+					pixel.gray8 = (uint8_t) DIV255(
+					    (MUL255(fb_px.gray8) + (((fb_px.gray8 ^ 0xFF) - fb_px.gray8) * lnPtr[k])));
+					put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		}
+	} else if (p->is_bgless) {
+		const uint8_t fgcolor = p->fgcolor;
+		if (pxfmt != FBINK_PXFMT_Y4) {
+			// 8, 16, 24 & 32bpp
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					if (lnPtr[k] == 0xFFu) {
+						// Full coverage (opaque) -> foreground
+						put_pixel_fmt(paint_point, &p->fgP, true, pxfmt);
+					} else if (lnPtr[k] != 0U) {
+						// AA, blend it using the coverage mask as alpha,
+						// and the underlying pixel as bg
+						get_pixel_fmt(paint_point, &fb_px, pxfmt);
+						if (is_rgb) {
+							pixel.rgba.color.r = (uint8_t) DIV255(
+							    (MUL255(fb_px.rgba.color.r) +
+							     ((fgcolor - fb_px.rgba.color.r) * lnPtr[k])));
+							pixel.rgba.color.g = (uint8_t) DIV255(
+							    (MUL255(fb_px.rgba.color.g) +
+							     ((fgcolor - fb_px.rgba.color.g) * lnPtr[k])));
+							pixel.rgba.color.b = (uint8_t) DIV255(
+							    (MUL255(fb_px.rgba.color.b) +
+							     ((fgcolor - fb_px.rgba.color.b) * lnPtr[k])));
+						} else {
+							pixel.bgra.color.r = (uint8_t) DIV255(
+							    (MUL255(fb_px.bgra.color.r) +
+							     ((fgcolor - fb_px.bgra.color.r) * lnPtr[k])));
+							pixel.bgra.color.g = (uint8_t) DIV255(
+							    (MUL255(fb_px.bgra.color.g) +
+							     ((fgcolor - fb_px.bgra.color.g) * lnPtr[k])));
+							pixel.bgra.color.b = (uint8_t) DIV255(
+							    (MUL255(fb_px.bgra.color.b) +
+							     ((fgcolor - fb_px.bgra.color.b) * lnPtr[k])));
+						}
+						put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					}
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		} else {
+			// 4bpp...
+			for (int j = 0; j < p->height; j++) {
+				for (unsigned int k = 0U; k < p->width; k++) {
+					// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
+					get_pixel_fmt(paint_point, &fb_px, pxfmt);
+					pixel.gray8 = (uint8_t) DIV255(
+					    (MUL255(fb_px.gray8) + ((fgcolor - fb_px.gray8) * lnPtr[k])));
+					put_pixel_fmt(paint_point, &pixel, false, pxfmt);
+					paint_point.x++;
+				}
+				lnPtr        += p->stride;
+				paint_point.x = p->origin.x;
+				paint_point.y++;
+			}
+		}
+	}
+}
+#	endif    // FBINK_WITH_OPENTYPE
+
+// And now, stamp out the actual per-format copies of those renderers...
+// NOTE: The 32bpp variants with & without an alpha channel behave the same, so they share their copy.
+#	define DEFINE_PXFMT_RENDERERS(FMT)                                                                                    \
+		static __attribute__((hot)) void plot_glyph_row_##FMT(uint32_t                   row,                        \
+								      unsigned short int         x_offs,                     \
+								      unsigned short int         cy,                         \
+								      const FBInkPixel* restrict fgP,                        \
+								      const FBInkPixel* restrict bgP,                        \
+								      bool                       is_overlay,                 \
+								      bool                       is_fgless)                  \
+		{                                                                                                            \
+			plot_glyph_row(row, x_offs, cy, fgP, bgP, is_overlay, is_fgless, FBINK_PXFMT_##FMT);                 \
+		}                                                                                                            \
+		DEFINE_PXFMT_OT_RENDERER(FMT)
+#	ifdef FBINK_WITH_OPENTYPE
+#		define DEFINE_PXFMT_OT_RENDERER(FMT)                                                                          \
+			static __attribute__((hot)) void paint_ot_line_##FMT(const FBInkOTPaint* restrict p)                 \
+			{                                                                                                    \
+				paint_ot_line(p, FBINK_PXFMT_##FMT);                                                         \
+			}
+#	else
+#		define DEFINE_PXFMT_OT_RENDERER(FMT)
+#	endif
+DEFINE_PXFMT_RENDERERS(Y4)
+DEFINE_PXFMT_RENDERERS(Y8)
+DEFINE_PXFMT_RENDERERS(BGR565)
+DEFINE_PXFMT_RENDERERS(RGB565)
+DEFINE_PXFMT_RENDERERS(BGR24)
+DEFINE_PXFMT_RENDERERS(RGB24)
+DEFINE_PXFMT_RENDERERS(BGRA)
+DEFINE_PXFMT_RENDERERS(RGBA)
+#	undef DEFINE_PXFMT_RENDERERS
+#	undef DEFINE_PXFMT_OT_RENDERER
+
+// Fill a span of count 8bpp pixels with the same value (i.e., a memset through the blit engine).
+// The SIMD variants handle the unaligned head & tail with scalar stores, and hand the aligned middle to blit_fill_vec.
+static inline __attribute__((always_inline, hot)) void
+    fill_span8(uint8_t* restrict p, uint8_t v, size_t count, bool stream __attribute__((unused)))
+{
+#	ifdef FBINK_SIMD_BYTES
+	while (count && !IS_ALIGNED((uintptr_t) p, FBINK_SIMD_BYTES)) {
+		*p++ = v;
+		count--;
+	}
+#		if defined(FBINK_SIMD_NEON)
+	const fbink_vec_t vv = vdupq_n_u8(v);
+#		elif defined(FBINK_SIMD_AVX2)
+	const fbink_vec_t vv = _mm256_set1_epi8((char) v);
+#		elif defined(FBINK_SIMD_SSE2)
+	const fbink_vec_t vv = _mm_set1_epi8((char) v);
+#		endif
+	const size_t done = blit_fill_vec(p, vv, count, stream);
+	p += done;
+	count -= done;
+	while (count--) {
+		*p++ = v;
+	}
+#	else
+	memset(p, v, count);
+#	endif    // FBINK_SIMD_BYTES
+}
+
+// Same, but for 16bpp pixels
+// NOTE: Requires p to be at least 2-bytes aligned, which holds true for every 16bpp fb we've ever seen.
+static inline __attribute__((always_inline, hot)) void
+    fill_span16(uint16_t* restrict p, uint16_t v, size_t count, bool stream __attribute__((unused)))
+{
+#	ifdef FBINK_SIMD_BYTES
+	while (count && !IS_ALIGNED((uintptr_t) p, FBINK_SIMD_BYTES)) {
+		*p++ = v;
+		count--;
+	}
+#		if defined(FBINK_SIMD_NEON)
+	const fbink_vec_t vv = vreinterpretq_u8_u16(vdupq_n_u16(v));
+#		elif defined(FBINK_SIMD_AVX2)
+	const fbink_vec_t vv = _mm256_set1_epi16((short int) v);
+#		elif defined(FBINK_SIMD_SSE2)
+	const fbink_vec_t vv = _mm_set1_epi16((short int) v);
+#		endif
+	const size_t done = blit_fill_vec((unsigned char*) p, vv, count << 1U, stream) >> 1U;
+	p += done;
+	count -= done;
+#	endif    // FBINK_SIMD_BYTES
+	// That's the exact pattern used by the Linux kernel (c.f., memset16 @ lib/string.c)
+	while (count--) {
+		*p++ = v;
+	}
+}
+
+// Same, but for 32bpp pixels
+// NOTE: Requires p to be at least 4-bytes aligned, which is a given for any sane 32bpp fb.
+static inline __attribute__((always_inline, hot)) void
+    fill_span32(uint32_t* restrict p, uint32_t v, size_t count, bool stream __attribute__((unused)))
+{
+#	ifdef FBINK_SIMD_BYTES
+	while (count && !IS_ALIGNED((uintptr_t) p, FBINK_SIMD_BYTES)) {
+		*p++ = v;
+		count--;
+	}
+#		if defined(FBINK_SIMD_NEON)
+	const fbink_vec_t vv = vreinterpretq_u8_u32(vdupq_n_u32(v));
+#		elif defined(FBINK_SIMD_AVX2)
+	const fbink_vec_t vv = _mm256_set1_epi32((int) v);
+#		elif defined(FBINK_SIMD_SSE2)
+	const fbink_vec_t vv = _mm_set1_epi32((int) v);
+#		endif
+	const size_t done = blit_fill_vec((unsigned char*) p, vv, count << 2U, stream) >> 2U;
+	p += done;
+	count -= done;
+#	endif    // FBINK_SIMD_BYTES
+	while (count--) {
+		*p++ = v;
+	}
+}
+
 // Helper functions to draw a rectangle in a given color
 static __attribute__((hot)) void
     fill_rect_Gray4(unsigned short int x,
@@ -795,16 +1388,36 @@ static __attribute__((hot)) void
 		    unsigned short int h,
 		    const FBInkPixel* restrict px)
 {
-	// Go with pixel plotting @ 4bpp to keep this simple...
+	// We can only address whole bytes, i.e., pairs of pixels, so, plot the odd edges, and fill the rest.
+	// NOTE: Those edges are the only read-modify-write left in the fill codepaths, and they're at most two pixels wide.
+	// NOTE: Unlike the pixel plotting loop this replaced, the span maths can't cope with an empty rectangle
+	//       (the leading edge would overshoot end), and some callers (e.g., OT padding) can legitimately pass w = 0.
+	if (unlikely(w == 0U)) {
+		return;
+	}
+	const uint8_t packed = (uint8_t) ((px->gray8 & 0xF0u) | (px->gray8 >> 4U));
+	const size_t  end    = (size_t) x + w;
+	const bool    stream = blit_wants_stream();
 	for (unsigned short int cy = 0U; cy < h; cy++) {
-		for (unsigned short int cx = 0U; cx < w; cx++) {
-			const FBInkCoordinates coords = {
-				.x = (unsigned short int) (x + cx),
-				.y = (unsigned short int) (y + cy),
-			};
+		FBInkCoordinates coords = {
+			.x = x,
+			.y = (unsigned short int) (y + cy),
+		};
+		// Leading odd pixel (i.e., low nibble)
+		if (coords.x & 0x01u) {
+			put_pixel_Gray4(&coords, px);
+			coords.x++;
+		}
+		// Whole bytes
+		const size_t bytes = (end - coords.x) >> 1U;
+		fill_span8(fbPtr + (coords.y * fInfo.line_length) + (coords.x >> 1U), packed, bytes, stream);
+		coords.x = (unsigned short int) (coords.x + (bytes << 1U));
+		// Trailing even pixel (i.e., high nibble)
+		if (coords.x < end) {
 			put_pixel_Gray4(&coords, px);
 		}
 	}
+	blit_fence(stream);
 
 #	ifdef DEBUG
 	LOG("Filled a #%02hhX %hux%hu rectangle @ (%hu, %hu)", px->gray8, w, h, x, y);
@@ -861,10 +1474,12 @@ static __attribute__((hot)) void
 	};
 	(*fxpRotateRegion)(&region);
 
+	const bool stream = blit_wants_stream();
 	for (size_t j = region.top; j < region.top + region.height; j++) {
 		uint8_t* p = fbPtr + (fInfo.line_length * j) + (region.left);
-		memset(p, px->gray8, region.width);
+		fill_span8(p, px->gray8, region.width, stream);
 	}
+	blit_fence(stream);
 
 #		ifdef DEBUG
 	LOG("Filled a #%02hhX %hux%hu rectangle @ (%hu, %hu)", px->gray8, w, h, x, y);
@@ -879,10 +1494,12 @@ static __attribute__((hot)) void
 		    const FBInkPixel* restrict px)
 {
 	// NOTE: fxpRotateRegion is never set at 8bpp :).
+	const bool stream = blit_wants_stream();
 	for (size_t j = y; j < y + h; j++) {
 		uint8_t* p = fbPtr + (fInfo.line_length * j) + (x);
-		memset(p, px->gray8, w);
+		fill_span8(p, px->gray8, w, stream);
 	}
+	blit_fence(stream);
 
 #		ifdef DEBUG
 	LOG("Filled a #%02hhX %hux%hu rectangle @ (%hu, %hu)", px->gray8, w, h, x, y);
@@ -943,20 +1560,17 @@ static __attribute__((hot)) void
 	};
 	(*fxpRotateRegion)(&region);
 
-	// And that's a cheap-ass manual memset16, let's hope the compiler can do something fun with that...
-	// That's the exact pattern used by the Linux kernel (c.f., memset16 @ lib/string.c), so, here's hoping ;).
+	// And that's a memset16, vectorized if possible
+	const bool stream = blit_wants_stream();
 	for (size_t j = region.top; j < region.top + region.height; j++) {
 		const size_t scanline_offset = fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 		uint16_t* restrict p = (uint16_t*) (fbPtr + scanline_offset) + region.left;
 #	pragma GCC diagnostic pop
-		size_t px_count = region.width;
-
-		while (px_count--) {
-			*p++ = px->rgb565;
-		}
+		fill_span16(p, px->rgb565, region.width, stream);
 	}
+	blit_fence(stream);
 
 #	ifdef DEBUG
 	LOG("Filled a #%02hhX %hux%hu rectangle @ (%hu, %hu)", px->gray8, w, h, x, y);
@@ -1006,10 +1620,12 @@ static void
 		    const FBInkPixel* restrict px)
 {
 	// NOTE: fxpRotateRegion is never set at 24bpp :).
+	const bool stream = blit_wants_stream();
 	for (size_t j = y; j < y + h; j++) {
 		uint8_t* p = fbPtr + (fInfo.line_length * j) + (x * 3U);
-		memset(p, px->gray8, w * 3U);
+		fill_span8(p, px->gray8, w * 3U, stream);
 	}
+	blit_fence(stream);
 
 #	ifdef DEBUG
 	LOG("Filled a #%02hhX %hux%hu rectangle @ (%hu, %hu)", px->gray8, w, h, x, y);
@@ -1057,20 +1673,17 @@ static __attribute__((hot)) void
 		    const FBInkPixel* restrict px)
 {
 	// NOTE: fxpRotateRegion is never set at 32bpp :).
+	const bool stream = blit_wants_stream();
 	for (size_t j = y; j < y + h; j++) {
-		// NOTE: Go with a cheap memset32 in order to preserve the alpha value of our input pixel...
-		//       The compiler should be able to turn that into something as fast as a plain memset ;).
+		// NOTE: Go with a memset32 in order to preserve the alpha value of our input pixel...
 		const size_t scanline_offset = fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 		uint32_t* p = (uint32_t*) (fbPtr + scanline_offset) + x;
 #	pragma GCC diagnostic pop
-		size_t px_count = w;
-
-		while (px_count--) {
-			*p++ = px->p;
-		}
+		fill_span32(p, px->p, w, stream);
 	}
+	blit_fence(stream);
 
 #	ifdef DEBUG
 	LOG("Filled a #%02hhX %hux%hu rectangle @ (%hu, %hu)", px->gray8, w, h, x, y);
@@ -1110,6 +1723,31 @@ static __attribute__((hot)) void
 	return fill_rect_RGB32(x, y, w, h, px);
 }
 
+// Fill the [start, end) byte range of the fb (c.f., clear_screen & run_bands)
+// NOTE: Bands are split on BLIT_BURST_BYTES boundaries, so they always start on a pixel boundary.
+static void
+    fill_fb_band(const void* ctx, uint32_t start, uint32_t end)
+{
+	const FBInkFillBand* band   = ctx;
+	const bool           stream = blit_wants_stream();
+	if (band->bpp == 16U) {
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+		uint16_t* p = (uint16_t*) (fbPtr + start);
+#	pragma GCC diagnostic pop
+		fill_span16(p, band->px.rgb565, (end - start) >> 1U, stream);
+	} else if (band->bpp == 32U) {
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+		uint32_t* p = (uint32_t*) (fbPtr + start);
+#	pragma GCC diagnostic pop
+		fill_span32(p, band->px.p, (end - start) >> 2U, stream);
+	} else {
+		fill_span8(fbPtr + start, band->px.gray8, end - start, stream);
+	}
+	blit_fence(stream);
+}
+
 // Helper function to clear the screen - fill whole screen with given color
 static void
     clear_screen(int fbfd UNUSED_BY_NOTKINDLE, FBInkPixel* px, bool is_flashing UNUSED_BY_NOTKINDLE)
@@ -1143,7 +1781,13 @@ static void
 		//       which should cover the active & visible buffer only...
 		memset(fbPtr, px->gray8, fInfo.line_length * vInfo.yres_virtual);
 	} else {
-		memset(fbPtr, px->gray8, fInfo.smem_len);
+		const FBInkFillBand band = { .px = *px, .bpp = 8U };
+		run_bands(&fill_fb_band,
+			  &band,
+			  0U,
+			  fInfo.smem_len,
+			  BLIT_BURST_BYTES,
+			  fInfo.line_length * WORKERS_MIN_BAND_ROWS);
 	}
 #	else
 	// NOTE: Apparently, some NTX devices do not appreciate a memset of the full smem_len when they're in a 16bpp mode...
@@ -1153,31 +1797,22 @@ static void
 	//       in particular size/psize vs. mapsize
 	//       Anyway, don't clobber that, as it seems to cause softlocks on BQ/Cervantes,
 	//       and be very conservative, using yres instead of yres_virtual, as Qt *may* already rely on that memory region.
+	// NOTE: The actual fill happens in fill_fb_band, so that it can be split across threads.
+	FBInkFillBand band = { .px = *px, .bpp = (uint8_t) vInfo.bits_per_pixel };
+	uint32_t      len;
 	if (unlikely(vInfo.bits_per_pixel == 16U)) {
 		// We whip up a quick memset16, like fill_rect_RGB565. Input pixel is guarnteed to be packed properly already.
-#		pragma GCC diagnostic push
-#		pragma GCC diagnostic ignored "-Wcast-align"
-		uint16_t* p        = (uint16_t*) fbPtr;
-#		pragma GCC diagnostic pop
-		size_t    px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
-		while (px_count--) {
-			*p++ = px->rgb565;
-		}
+		len = vInfo.xres_virtual * vInfo.yres * 2U;
 	} else if (vInfo.bits_per_pixel == 32U) {
 		// Much like in fill_rect_RGB32, do this in a way that'll preserve the alpha byte...
-#		pragma GCC diagnostic push
-#		pragma GCC diagnostic ignored "-Wcast-align"
-		uint32_t* p        = (uint32_t*) fbPtr;
-#		pragma GCC diagnostic pop
-		size_t    px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
-		while (px_count--) {
-			*p++ = px->p;
-		}
+		len = vInfo.xres_virtual * vInfo.yres * 4U;
 	} else {
 		// NOTE: fInfo.smem_len should actually match fInfo.line_length * vInfo.yres_virtual on 32bpp ;).
 		//       Which is how things should always be, but, alas, poor Yorick...
-		memset(fbPtr, px->gray8, fInfo.smem_len);
+		band.bpp = 8U;
+		len      = fInfo.smem_len;
 	}
+	run_bands(&fill_fb_band, &band, 0U, len, BLIT_BURST_BYTES, fInfo.line_length * WORKERS_MIN_BAND_ROWS);
 #	endif
 }
 
@@ -1240,6 +1875,11 @@ int
 	FBInkPixel             px     = pack_pixel_from_y8(v);
 	put_pixel(coords, &px, true);
 
+	// We don't go through refresh(), so keep the shadow buffer in the loop ourselves
+	struct mxcfb_rect region = { .top = y, .left = x, .width = 1U, .height = 1U };
+	(*fxpRotateRegion)(&region);
+	damage_shadow_fb(&region);
+
 	// Cleanup
 cleanup:
 	if (isFbMapped && !keep_fd) {
@@ -1288,6 +1928,11 @@ int
 	FBInkPixel             px     = pack_pixel_from_rgba(r, g, b, a);
 	put_pixel(coords, &px, true);
 
+	// We don't go through refresh(), so keep the shadow buffer in the loop ourselves
+	struct mxcfb_rect region = { .top = y, .left = x, .width = 1U, .height = 1U };
+	(*fxpRotateRegion)(&region);
+	damage_shadow_fb(&region);
+
 	// Cleanup
 cleanup:
 	if (isFbMapped && !keep_fd) {
@@ -1367,6 +2012,11 @@ int
 	const FBInkCoordinates coords = { .x = x, .y = y };
 	put_pixel(coords, px, true);
 
+	// We don't go through refresh(), so keep the shadow buffer in the loop ourselves
+	struct mxcfb_rect region = { .top = y, .left = x, .width = 1U, .height = 1U };
+	(*fxpRotateRegion)(&region);
+	damage_shadow_fb(&region);
+
 	// Cleanup
 cleanup:
 	if (isFbMapped && !keep_fd) {
@@ -1383,14 +2033,92 @@ cleanup:
 #endif
 }
 
+#ifdef FBINK_WITH_DRAW
+// Bulk variant of put_pixel: branch on the pixel format once, and then run a tight loop over the points with the right put_pixel_*.
+// xy holds count packed (x, y) pairs. If values is set, it holds one 8-bit luminance value per point, and px is ignored.
+// NOTE: Rotation & off-screen pixels are handled exactly like in put_pixel.
+#	define PUT_PIXELS_LOOP(put_pixel_fxp)                                                                               \
+		for (size_t i = 0U; i < count; i++) {                                                                      \
+			const uint32_t   x      = xy[i << 1U];                                                             \
+			const uint32_t   y      = xy[(i << 1U) + 1U];                                                      \
+			FBInkCoordinates coords = { .x = (unsigned short int) x, .y = (unsigned short int) y };            \
+                                                                                                                           \
+			(*fxpRotateCoords)(&coords);                                                                       \
+			if (unlikely(coords.x >= vInfo.xres || coords.y >= vInfo.yres)) {                                  \
+				continue;                                                                                  \
+			}                                                                                                  \
+                                                                                                                           \
+			put_pixel_fxp(&coords, values ? &lut[values[i]] : px);                                             \
+			min_x = MIN(min_x, x);                                                                             \
+			min_y = MIN(min_y, y);                                                                             \
+			max_x = MAX(max_x, x);                                                                             \
+			max_y = MAX(max_y, y);                                                                             \
+		}
+
+static __attribute__((hot)) void
+    put_pixels(const uint16_t* restrict xy, size_t count, const FBInkPixel* px, const uint8_t* restrict values)
+{
+	if (count == 0U) {
+		return;
+	}
+
+	// Pack every possible luminance value once, instead of once per point
+	FBInkPixel lut[256U];
+	if (values) {
+		for (uint16_t v = 0U; v < 256U; v++) {
+			lut[v] = pack_pixel_from_y8((uint8_t) v);
+		}
+	}
+
+	// Keep track of the (unrotated) bounding box, for set_last_rect
+	uint32_t min_x = UINT32_MAX;
+	uint32_t min_y = UINT32_MAX;
+	uint32_t max_x = 0U;
+	uint32_t max_y = 0U;
+
+	// NOTE: Same if ladder as in put_pixel. Pixels are always packed in the target pixel format here.
+	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
+		PUT_PIXELS_LOOP(put_pixel_Gray4)
+	} else if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+		PUT_PIXELS_LOOP(put_pixel_Gray8)
+	} else if (vInfo.bits_per_pixel == 16U) {
+		PUT_PIXELS_LOOP(put_pixel_RGB565)
+	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
+		PUT_PIXELS_LOOP(put_pixel_BGR24)
+	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24)) {
+		PUT_PIXELS_LOOP(put_pixel_RGB24)
+	} else if (likely(vInfo.bits_per_pixel == 32U)) {
+		PUT_PIXELS_LOOP(put_pixel_RGB32)
+	}
+
+	// Only remember what was actually plotted (if anything), and keep it on screen
+	max_x = MIN(max_x, screenWidth - 1U);
+	max_y = MIN(max_y, screenHeight - 1U);
+	if (min_x > max_x || min_y > max_y) {
+		return;
+	}
+
+	struct mxcfb_rect region = {
+		.top    = min_y,
+		.left   = min_x,
+		.width  = max_x - min_x + 1U,
+		.height = max_y - min_y + 1U,
+	};
+	// Remember the rect...
+	set_last_rect(&region);
+	// And make sure the shadow buffer knows about it, as we don't refresh
+	(*fxpRotateRegion)(&region);
+	damage_shadow_fb(&region);
+}
+#	undef PUT_PIXELS_LOOP
+#endif    // FBINK_WITH_DRAW
+
 int
-    fbink_get_pixel(int fbfd   UNUSED_BY_NODRAW,
-		    uint16_t x UNUSED_BY_NODRAW,
-		    uint16_t y UNUSED_BY_NODRAW,
-		    uint8_t* r UNUSED_BY_NODRAW,
-		    uint8_t* g UNUSED_BY_NODRAW,
-		    uint8_t* b UNUSED_BY_NODRAW,
-		    uint8_t* a UNUSED_BY_NODRAW)
+    fbink_put_pixels_gray(int fbfd                       UNUSED_BY_NODRAW,
+			  const uint16_t* restrict xy    UNUSED_BY_NODRAW,
+			  size_t count                   UNUSED_BY_NODRAW,
+			  uint8_t v                      UNUSED_BY_NODRAW,
+			  const uint8_t* restrict values UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
 	// If we open a fd now, we'll only keep it open for this single call!
@@ -1411,27 +2139,117 @@ int
 		}
 	}
 
-	const FBInkCoordinates coords = { .x = x, .y = y };
-	FBInkPixel             px;
-	get_pixel(coords, &px);
+	const FBInkPixel px = pack_pixel_from_y8(v);
+	put_pixels(xy, count, &px, values);
 
-	// Unpack the pixel for public consumption
-	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 || deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) {
-		*r = px.gray8;
-		*g = px.gray8;
-		*b = px.gray8;
-		*a = 0xFFu;
-	} else if (deviceQuirks.isRGB) {
-		*r = px.rgba.color.r;
-		*g = px.rgba.color.g;
-		*b = px.rgba.color.b;
-		if (vInfo.bits_per_pixel == 32U) {
-			*a = px.rgba.color.a;
-		} else {
-			*a = 0xFFu;
-		}
-	} else {
-		*r = px.bgra.color.r;
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_put_pixels(int fbfd                    UNUSED_BY_NODRAW,
+		     const uint16_t* restrict xy UNUSED_BY_NODRAW,
+		     size_t count                UNUSED_BY_NODRAW,
+		     void* px                    UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	put_pixels(xy, count, px, NULL);
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_get_pixel(int fbfd   UNUSED_BY_NODRAW,
+		    uint16_t x UNUSED_BY_NODRAW,
+		    uint16_t y UNUSED_BY_NODRAW,
+		    uint8_t* r UNUSED_BY_NODRAW,
+		    uint8_t* g UNUSED_BY_NODRAW,
+		    uint8_t* b UNUSED_BY_NODRAW,
+		    uint8_t* a UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	const FBInkCoordinates coords = { .x = x, .y = y };
+	FBInkPixel             px;
+	get_pixel(coords, &px);
+
+	// Unpack the pixel for public consumption
+	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 || deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) {
+		*r = px.gray8;
+		*g = px.gray8;
+		*b = px.gray8;
+		*a = 0xFFu;
+	} else if (deviceQuirks.isRGB) {
+		*r = px.rgba.color.r;
+		*g = px.rgba.color.g;
+		*b = px.rgba.color.b;
+		if (vInfo.bits_per_pixel == 32U) {
+			*a = px.rgba.color.a;
+		} else {
+			*a = 0xFFu;
+		}
+	} else {
+		*r = px.bgra.color.r;
 		*g = px.bgra.color.g;
 		*b = px.bgra.color.b;
 		if (vInfo.bits_per_pixel == 32U) {
@@ -1483,6 +2301,34 @@ static const unsigned char*
 		return font8x8_basic[0];
 	}
 }
+
+// Find the glyph mapped to that codepoint in a font's sorted table of codepoint ranges (c.f., *_get_bitmap).
+// Returns NULL if the font doesn't cover it.
+static const void*
+    font_lookup_glyph(const FBInkGlyphRange* restrict ranges, size_t count, uint32_t codepoint, size_t glyph_size)
+{
+	// The first range is usually ASCII, which is what we'll be printing most of the time, so check it first.
+	// NOTE: Relies on unsigned wraparound to handle both bounds in a single check.
+	if (likely(codepoint - ranges[0].first <= ranges[0].last - ranges[0].first)) {
+		return (const unsigned char*) ranges[0].glyphs + ((codepoint - ranges[0].first) * glyph_size);
+	}
+
+	// Otherwise, binary search, which keeps the cost flat no matter how many ranges the font has
+	size_t lo = 1U;
+	size_t hi = count;
+	while (lo < hi) {
+		const size_t           mid   = lo + ((hi - lo) >> 1U);
+		const FBInkGlyphRange* range = &ranges[mid];
+		if (codepoint < range->first) {
+			hi = mid;
+		} else if (codepoint > range->last) {
+			lo = mid + 1U;
+		} else {
+			return (const unsigned char*) range->glyphs + ((codepoint - range->first) * glyph_size);
+		}
+	}
+	return NULL;
+}
 #endif    // FBINK_WITH_BITMAP
 
 static __attribute__((cold)) const char*
@@ -1562,6 +2408,18 @@ static __attribute__((cold)) const char*
 	}
 }
 
+// Same, but accounting for a font pack overriding the builtin font
+static __attribute__((cold)) const char*
+    current_font_name(const FBInkConfig* restrict fbink_cfg)
+{
+#ifdef FBINK_WITH_BITMAP
+	if (fontPack.map) {
+		return fontPack.name;
+	}
+#endif
+	return fontname_to_string(fbink_cfg->fontname);
+}
+
 #ifdef FBINK_WITH_BITMAP
 // KISS helper function to count the amount of digits in an integer (for dynamic padding purposes in printf calls)
 // c.f., https://stackoverflow.com/a/3069580
@@ -1601,9 +2459,231 @@ static int
 	return 1;
 }
 
+// Drop every cached glyph cell (and rectangle cover)
+static void
+    glyph_cache_reset(void)
+{
+	free(glyphCache.cells);
+	free(glyphCache.keys);
+	glyphCache = (FBInkGlyphCache){ 0 };
+	// NOTE: Both are keyed on bitmap pointers, which are only stable for as long as a font pack stays mapped.
+	memset(glyphCovers, 0, sizeof(glyphCovers));
+}
+
+// Size the glyph cache for the current font, scaling factor & fb format (c.f., initialize_fbink).
+// Leaves it disabled (i.e., slots == 0) when it's either impossible or pointless to use it.
+static void
+    glyph_cache_setup(void)
+{
+	glyph_cache_reset();
+
+	// NOTE: Cells are blitted row by row, so we need byte-aligned pixels (at 4bpp, odd columns would require shifting
+	//       every nibble of the cell), and a fb that isn't rotated behind our back (i.e., no fxpRotateRegion shenanigans).
+	if (vInfo.bits_per_pixel < 8U || fxpRotateRegion != &rotate_region_nop) {
+		LOG("Glyph cache is disabled on this fb");
+		return;
+	}
+
+	const uint8_t bpp       = (uint8_t) (vInfo.bits_per_pixel >> 3U);
+	const size_t  pitch     = (size_t) FONTW * bpp;
+	const size_t  cell_size = pitch * FONTH;
+	uint32_t      slots     = GLYPH_CACHE_MAX_SLOTS;
+	while (slots >= GLYPH_CACHE_MIN_SLOTS && cell_size * slots > GLYPH_CACHE_BYTES) {
+		slots >>= 1U;
+	}
+	if (slots < GLYPH_CACHE_MIN_SLOTS) {
+		LOG("Glyph cells are too large (%zu bytes) to be worth caching", cell_size);
+		return;
+	}
+
+	glyphCache.cells = malloc(cell_size * slots);
+	glyphCache.keys  = calloc(slots, sizeof(*glyphCache.keys));
+	if (!glyphCache.cells || !glyphCache.keys) {
+		PFWARN("Failed to allocate the glyph cache: %m");
+		glyph_cache_reset();
+		return;
+	}
+	glyphCache.cell_size = cell_size;
+	glyphCache.pitch     = pitch;
+	glyphCache.slots     = slots;
+	glyphCache.width     = FONTW;
+	glyphCache.height    = FONTH;
+	glyphCache.mult      = FONTSIZE_MULT;
+	glyphCache.bpp       = bpp;
+	glyphCache.pxfmt     = deviceQuirks.pixelFormat;
+	LOG("Glyph cache: %u slots of %hux%hu cells (%zu bytes)", slots, FONTW, FONTH, cell_size * slots);
+}
+
+// Returns the rendered cell for that glyph in those colors, rendering it on a miss
+// NOTE: Only covers the opaque fg/bg rendering of RENDER_GLYPH in draw, which doesn't depend on what's already on screen.
+static __attribute__((hot)) const unsigned char*
+    glyph_cache_fetch(const void* restrict bitmap, const FBInkPixel* restrict fgP, const FBInkPixel* restrict bgP)
+{
+	uint32_t h = (uint32_t) (uintptr_t) bitmap ^ (fgP->p * 0x85EBCA6Bu) ^ (bgP->p * 0xC2B2AE35u);
+	h ^= h >> 16U;
+	h *= 0x9E3779B1u;
+	h ^= h >> 16U;
+	const uint32_t slot = h & (glyphCache.slots - 1U);
+	FBInkGlyphKey* key  = &glyphCache.keys[slot];
+	unsigned char* cell = glyphCache.cells + (glyphCache.cell_size * slot);
+	if (likely(key->bitmap == bitmap && key->fg == fgP->p && key->bg == bgP->p)) {
+		return cell;
+	}
+
+	// Miss (or collision), render it, one scaled row at a time
+	const size_t  pitch = glyphCache.pitch;
+	const uint8_t bpp   = glyphCache.bpp;
+	for (uint8_t y = 0U; y < glyphHeight; y++) {
+		uint32_t row;
+		if (glyphWidth <= 8U) {
+			row = ((const uint8_t*) bitmap)[y];
+		} else if (glyphWidth <= 16U) {
+			row = ((const uint16_t*) bitmap)[y];
+		} else {
+			row = ((const uint32_t*) bitmap)[y];
+		}
+
+		unsigned char* restrict dst = cell + (pitch * y * FONTSIZE_MULT);
+		for (uint8_t x = 0U; x < glyphWidth; x++) {
+			// Same packed values & the same per-format semantics as fill_rect_*
+			const FBInkPixel* px = (row & 1U << x) ? fgP : bgP;
+			unsigned char*    p  = dst + ((size_t) x * FONTSIZE_MULT * bpp);
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+			if (bpp == 4U) {
+				fill_span32((uint32_t*) (void*) p, px->p, FONTSIZE_MULT, false);
+			} else if (bpp == 2U) {
+				fill_span16((uint16_t*) (void*) p, px->rgb565, FONTSIZE_MULT, false);
+			} else {
+				fill_span8(p, px->gray8, (size_t) FONTSIZE_MULT * bpp, false);
+			}
+#	pragma GCC diagnostic pop
+		}
+		// And replicate that row to honor the vertical scaling
+		for (uint8_t k = 1U; k < FONTSIZE_MULT; k++) {
+			memcpy(dst + (pitch * k), dst, pitch);
+		}
+	}
+
+	key->bitmap = bitmap;
+	key->fg     = fgP->p;
+	key->bg     = bgP->p;
+	return cell;
+}
+
+// Blit a cached cell to the fb, with its top-left corner at (x, y)
+// NOTE: The caller is responsible for making sure the full cell fits on screen.
+static __attribute__((hot)) void
+    glyph_cache_blit(const unsigned char* restrict cell, unsigned short int x, unsigned short int y)
+{
+	const size_t   pitch  = glyphCache.pitch;
+	const bool     stream = blit_wants_stream();
+	unsigned char* dst    = fbPtr + ((size_t) fInfo.line_length * y) + ((size_t) x * glyphCache.bpp);
+	for (unsigned short int j = 0U; j < glyphCache.height; j++) {
+		blit_copy(dst, cell, pitch, stream);
+		dst += fInfo.line_length;
+		cell += pitch;
+	}
+	blit_fence(stream);
+}
+
+// Tile the set bits of rows (glyphHeight rows of glyphWidth columns) with rectangles, starting at rects[count].
+// Greedy: take the widest run at the top-left-most free pixel, and extend it down for as long as the run stays whole.
+// Returns the new count, or GLYPH_COVER_MAX_RECTS + 1 if we ran out of room.
+static uint8_t
+    glyph_cover_rows(uint32_t* restrict rows, FBInkGlyphRect* restrict rects, uint8_t count)
+{
+	for (uint8_t y = 0U; y < glyphHeight; y++) {
+		while (rows[y] != 0U) {
+			if (count >= GLYPH_COVER_MAX_RECTS) {
+				return GLYPH_COVER_MAX_RECTS + 1U;
+			}
+
+			const uint8_t  x    = (uint8_t) __builtin_ctz(rows[y]);
+			const uint32_t run  = rows[y] >> x;
+			// NOTE: ~run is 0 when the run spans all 32 columns, and ctz(0) is undefined.
+			const uint8_t  w    = (uint8_t) (~run == 0U ? 32U : (unsigned int) __builtin_ctz(~run));
+			const uint32_t span = (w == 32U ? UINT32_MAX : ((1U << w) - 1U)) << x;
+
+			uint8_t h = 1U;
+			while (y + h < glyphHeight && (rows[y + h] & span) == span) {
+				h++;
+			}
+			for (uint8_t k = 0U; k < h; k++) {
+				rows[y + k] &= ~span;
+			}
+
+			rects[count++] = (FBInkGlyphRect){ .x = x, .y = y, .w = w, .h = h };
+		}
+	}
+	return count;
+}
+
+// Returns the rectangle decomposition of that glyph, computing it on a miss.
+// NOTE: Like the glyph cache, this is keyed on the bitmap pointer, which is unique to a (font, codepoint) tuple.
+//       Returns NULL if the glyph needs too many rectangles, in which case the per-row stripes do a better job.
+static __attribute__((hot)) const FBInkGlyphCover*
+    glyph_cover_fetch(const void* bitmap)
+{
+	uint32_t h = (uint32_t) (uintptr_t) bitmap;
+	h ^= h >> 16U;
+	h *= 0x9E3779B1u;
+	h ^= h >> 16U;
+	FBInkGlyphCover* cover = &glyphCovers[h & (GLYPH_COVER_SLOTS - 1U)];
+	if (likely(cover->bitmap == bitmap)) {
+		return cover->count ? cover : NULL;
+	}
+
+	// Split the bitmap in fg & bg masks (c.f., RENDER_GLYPH for the bitmap layout)
+	const uint32_t cols = glyphWidth >= 32U ? UINT32_MAX : ((1U << glyphWidth) - 1U);
+	uint32_t       fg[32];
+	uint32_t       bg[32];
+	for (uint8_t y = 0U; y < glyphHeight; y++) {
+		uint32_t row;
+		if (glyphWidth <= 8U) {
+			row = ((const uint8_t*) bitmap)[y];
+		} else if (glyphWidth <= 16U) {
+			row = ((const uint16_t*) bitmap)[y];
+		} else {
+			row = ((const uint32_t*) bitmap)[y];
+		}
+		fg[y] = row & cols;
+		bg[y] = ~row & cols;
+	}
+
+	uint8_t count = glyph_cover_rows(fg, cover->rects, 0U);
+	if (count <= GLYPH_COVER_MAX_RECTS) {
+		cover->fg_count = count;
+		count           = glyph_cover_rows(bg, cover->rects, count);
+	}
+	cover->bitmap = bitmap;
+	cover->count  = count <= GLYPH_COVER_MAX_RECTS ? count : 0U;
+	return cover->count ? cover : NULL;
+}
+
+// Draw a glyph's rectangles, scaled by FONTSIZE_MULT, with its top-left corner at (x, y)
+static __attribute__((hot)) void
+    draw_glyph_cover(const FBInkGlyphCover* restrict cover,
+		     unsigned short int x,
+		     unsigned short int y,
+		     const FBInkPixel* restrict fgP,
+		     const FBInkPixel* restrict bgP)
+{
+	for (uint8_t r = 0U; r < cover->count; r++) {
+		const FBInkGlyphRect* rect = &cover->rects[r];
+		(*fxpFillRectChecked)((unsigned short int) (x + rect->x * FONTSIZE_MULT),
+				      (unsigned short int) (y + rect->y * FONTSIZE_MULT),
+				      (unsigned short int) (rect->w * FONTSIZE_MULT),
+				      (unsigned short int) (rect->h * FONTSIZE_MULT),
+				      r < cover->fg_count ? fgP : bgP);
+	}
+}
+
 // Helper function for drawing
 static struct mxcfb_rect
     draw(const char* restrict text,
+	 const uint32_t* restrict codepoints,
+	 size_t             charcount,
 	 unsigned short int row,
 	 unsigned short int col,
 	 unsigned short int multiline_offset,
@@ -1627,48 +2707,16 @@ static struct mxcfb_rect
 	// Adjust row in case we're a continuation of a multi-line print...
 	row = (unsigned short int) (row + multiline_offset);
 
-	// Compute the length of our actual string
 	// NOTE: We already took care in fbink_print() of making sure that the string passed in text wouldn't take up
 	//       more space (as in columns, not bytes) than (MAXCOLS - col), the maximum printable length.
 	//       And as we're printing glyphs, we need to iterate over the number of characters/grapheme clusters,
-	//       not bytes.
-	const size_t charcount = u8_strlen2(text);
-	const size_t txtlength = strlen(text);
-	// Flawfinder: ignore
-	LOG("Character count: %zu (over %zu bytes)", charcount, txtlength);
-
-	// Compute our actual subcell offset in pixels
-	unsigned short int pixel_offset = 0U;
-	// Do we have a centering induced halfcell adjustment to correct?
-	if (halfcell_offset) {
-		pixel_offset = FONTW / 2U;
-		LOG("Incrementing pixel_offset by %hu pixels to account for a halfcell centering tweak", pixel_offset);
-	}
-	// Do we have a permanent adjustment to make because of dead space on the right edge?
-	if (!deviceQuirks.isPerfectFit) {
-		// We correct by half of said dead space, since we want perfect centering ;).
-		unsigned short int deadzone_offset =
-		    (unsigned short int) (viewWidth - (unsigned short int) (MAXCOLS * FONTW)) / 2U;
-		pixel_offset = (unsigned short int) (pixel_offset + deadzone_offset);
-		LOG("Incrementing pixel_offset by %hu pixels to compensate for dead space on the right edge",
-		    deadzone_offset);
-	}
+	//       not bytes, which is why the caller hands us text already decoded to codepoints (once, and only once).
+	LOG("Character count: %zu", charcount);
 
-	// Clamp h/v offset to safe values
-	short int voffset = fbink_cfg->voffset;
-	short int hoffset = fbink_cfg->hoffset;
-	// NOTE: This test isn't perfect, but then, if you play with this, you do it knowing the risks...
-	//       It's mainly there so that stupidly large values don't wrap back on screen because of overflow wraparound.
-	if ((uint32_t) abs(voffset) >= viewHeight) {
-		LOG("The specified vertical offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
-		    voffset);
-		voffset = 0;
-	}
-	if ((uint32_t) abs(hoffset) >= viewWidth) {
-		LOG("The specified horizontal offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
-		    hoffset);
-		hoffset = 0;
-	}
+	// Compute our actual subcell offset in pixels, and clamp h/v offset to safe values
+	short int                voffset;
+	short int                hoffset;
+	const unsigned short int pixel_offset = cell_pen_offsets(halfcell_offset, fbink_cfg, &hoffset, &voffset);
 
 	// Compute the dimension of the screen region we'll paint to (taking multi-line into account)
 	struct mxcfb_rect region = {
@@ -1819,12 +2867,8 @@ static struct mxcfb_rect
 	}
 
 	// Loop through all the *characters* in the text string
-	size_t                   bi    = 0U;
-	size_t                   ch_bi = bi;
-	size_t                   ci    = 0U;
-	uint32_t                 ch;
-	FBInkCoordinates         coords = { 0U };
-	FBInkPixel*              pxP;
+	size_t   ci = 0U;
+	uint32_t ch;
 	// NOTE: We don't do much sanity checking on hoffset/voffset,
 	//       because we want to allow pushing part of the string off-screen
 	//       (we basically only make sure it won't screw up the region rectangle too badly).
@@ -1840,34 +2884,38 @@ static struct mxcfb_rect
 	unsigned short int cx;
 	unsigned short int cy;
 
+	// Opaque glyphs can go through the glyph cache, provided it still matches the current font & fb setup
+	// (c.f., glyph_cache_setup), or, failing that, through their rectangle decomposition (c.f., glyph_cover_fetch).
+	const bool is_opaque       = !fbink_cfg->is_overlay && !fbink_cfg->is_bgless && !fbink_cfg->is_fgless;
+	const bool use_glyph_cache = is_opaque && glyphCache.slots != 0U && glyphCache.width == FONTW &&
+				     glyphCache.height == FONTH && glyphCache.mult == FONTSIZE_MULT &&
+				     glyphCache.pxfmt == deviceQuirks.pixelFormat &&
+				     fxpRotateRegion == &rotate_region_nop;
+	const FBInkGlyphCover* cover;
+
 	// We'll also need to compute the amount of zero padding we'll want for logging...
-	// i.e., we'll use the amount of digits in the text's length in bytes as the printf field width.
+	// i.e., we'll use the amount of digits in the text's length in characters as the printf field width.
 	// We cap at 5 because that should cover most sane use-cases.
-	int pad_len = zu_print_length(txtlength);
+	int pad_len = zu_print_length(charcount);
 
 	// NOTE: Extra code duplication because the glyph's bitmap data type depends on the glyph's width,
 	//       so, one way or another, we have to duplicate the inner loops,
 	//       but we want to inline this *and* branch outside the loops,
 	//       and I don't feel like moving that to inline functions,
 	//       because it depends on seven billion different variables I'd have to pass around...
-#	ifdef FBINK_WITH_FONTS
 	if (glyphWidth <= 8) {
-#	endif
-		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
-			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
+		while (ci < charcount) {
+			ch = codepoints[ci];
+			LOG("Char %.*zu out of %.*zu is U+%04X (%s)",
 			    pad_len,
 			    (ci + 1U),
 			    pad_len,
 			    charcount,
-			    pad_len,
-			    ch_bi,
 			    ch,
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
 			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-			// Remember the next char's byte offset for next iteration's logging
-			ch_bi                           = bi;
 
 			// Crappy macro to avoid repeating myself in each branch...
 			// NOTE: When no special processing is needed, we attempt to speed things up by using fill_rect
@@ -1883,6 +2931,9 @@ static struct mxcfb_rect
 			//       that would generate a different font format to use at runtime,
 			//       one that's basically just a list of rectangles (tl coordinates + wh) to draw.
 			//       Think SVG redux, with a single shape: filled rectangles ;).
+			// NOTE: Which is what glyph_cover_fetch now does, once per glyph, memoized, instead of offline:
+			//       a greedy cover is cheap enough to compute that it's not worth doubling the size of every font table.
+			//       The stripes below are only used for the rare glyphs that need more than GLYPH_COVER_MAX_RECTS.
 			// NOTE: Suprisingly enough, a variant of the current approach (ca. ae82336),
 			//       in which we start by filling the bg canvas, then only draw fg rectangles,
 			//       did not yield performance improvements across the board:
@@ -1890,7 +2941,14 @@ static struct mxcfb_rect
 #	define RENDER_GLYPH()                                                                                                         \
 		/* NOTE: We only need to loop on the base glyph's dimensions (i.e., the bitmap resolution), */                         \
 		/*       and from there compute the extra pixels for that single input pixel given our scaling factor... */            \
-		if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless && !fbink_cfg->is_fgless) {                                        \
+		if (use_glyph_cache && (uint32_t) (x_offs + FONTW) <= screenWidth &&                                                   \
+		    (uint32_t) (y_offs + FONTH) <= screenHeight) {                                                                     \
+			/* Opaque cells that fully fit on screen are pre-rendered once, and then simply blitted */                     \
+			glyph_cache_blit(glyph_cache_fetch(bitmap, &fgP, &bgP), x_offs, y_offs);                                       \
+		} else if (is_opaque && (cover = glyph_cover_fetch(bitmap)) != NULL) {                                                 \
+			/* Otherwise, a handful of rectangles spanning multiple rows, which pays off at large scaling factors */       \
+			draw_glyph_cover(cover, x_offs, y_offs, &fgP, &bgP);                                                           \
+		} else if (is_opaque) {                                                                                                \
 			for (uint8_t y = 0U; y < glyphHeight; y++) {                                                                   \
 				/* y: input row, j: first output row after scaling */                                                  \
 				j                         = (unsigned short int) (y * FONTSIZE_MULT);                                  \
@@ -1972,50 +3030,19 @@ static struct mxcfb_rect
 				}                                                                                                      \
 			}                                                                                                              \
 		} else {                                                                                                               \
-			FBInkPixel fbP     = { 0U };                                                                                   \
-			bool       is_fgpx = false;                                                                                    \
+			/* Overlay, bgless & fgless modes have to go pixel per pixel, */                                               \
+			/* fbink_init() picked the variant specialized for the fb's pixel format */                                    \
 			for (uint8_t y = 0U; y < glyphHeight; y++) {                                                                   \
 				/* y: input row, j: first output row after scaling */                                                  \
 				j  = (unsigned short int) (y * FONTSIZE_MULT);                                                         \
 				cy = (unsigned short int) (y_offs + j);                                                                \
-				for (uint8_t x = 0U; x < glyphWidth; x++) {                                                            \
-					/* x: input column, i: first output column after scaling */                                    \
-					i = (unsigned short int) (x * FONTSIZE_MULT);                                                  \
-					/* Each element encodes a full row, we access a column's bit in that row by shifting. */       \
-					if (bitmap[y] & 1U << x) {                                                                     \
-						/* bit was set, pixel is fg! */                                                        \
-						pxP     = &fgP;                                                                        \
-						is_fgpx = true;                                                                        \
-					} else {                                                                                       \
-						/* bit was unset, pixel is bg */                                                       \
-						pxP     = &bgP;                                                                        \
-						is_fgpx = false;                                                                       \
-					}                                                                                              \
-					/* Initial coordinates, before we generate the extra pixels from the scaling factor */         \
-					cx = (unsigned short int) (x_offs + i);                                                        \
-					/* NOTE: Apply our scaling factor in both dimensions! */                                       \
-					for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {                                                 \
-						coords.y = (unsigned short int) (cy + l);                                              \
-						for (uint8_t k = 0U; k < FONTSIZE_MULT; k++) {                                         \
-							coords.x = (unsigned short int) (cx + k);                                      \
-							/* In overlay mode, we only print foreground pixels, */                        \
-							/* and we print in the inverse color of the underlying pixel's */              \
-							/* Obviously, the closer we get to GRAY7, the less contrast we get */          \
-							if (is_fgpx && !fbink_cfg->is_fgless) {                                        \
-								if (fbink_cfg->is_overlay) {                                           \
-									get_pixel(coords, &fbP);                                       \
-									fbP.p ^= 0x00FFFFFFu;                                          \
-									pxP    = &fbP;                                                 \
-									put_pixel(coords, pxP, false);                                 \
-								} else {                                                               \
-									put_pixel(coords, pxP, true);                                  \
-								}                                                                      \
-							} else if (!is_fgpx && fbink_cfg->is_fgless) {                                 \
-								put_pixel(coords, pxP, true);                                          \
-							}                                                                              \
-						}                                                                                      \
-					}                                                                                              \
-				}                                                                                                      \
+				(*fxpPlotGlyphRow)(bitmap[y],                                                                          \
+						   x_offs,                                                                             \
+						   cy,                                                                                 \
+						   &fgP,                                                                               \
+						   &bgP,                                                                               \
+						   fbink_cfg->is_overlay,                                                              \
+						   fbink_cfg->is_fgless);                                                              \
 			}                                                                                                              \
 		}
 
@@ -2028,11 +3055,7 @@ static struct mxcfb_rect
 			} else {
 				// Get the glyph's pixmap (width <= 8 -> uint8_t)
 				const unsigned char* restrict bitmap = NULL;
-#	ifdef FBINK_WITH_FONTS
-				bitmap = (*fxpFont8xGetBitmap)(ch);
-#	else
-			bitmap = font8x8_get_bitmap(ch);
-#	endif
+				bitmap                               = (*fxpFont8xGetBitmap)(ch);
 				RENDER_GLYPH();
 			}
 			// NOTE: If we did not mirror the bitmasks during conversion,
@@ -2045,23 +3068,19 @@ static struct mxcfb_rect
 			// Next glyph! This serves as the source for the pen position, hence it being used as an index...
 			ci++;
 		}
-#	ifdef FBINK_WITH_FONTS
 	} else if (glyphWidth <= 16) {
-		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
-			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
+		while (ci < charcount) {
+			ch = codepoints[ci];
+			LOG("Char %.*zu out of %.*zu is U+%04X (%s)",
 			    pad_len,
 			    (ci + 1U),
 			    pad_len,
 			    charcount,
-			    pad_len,
-			    ch_bi,
 			    ch,
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
 			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-			// Remember the next char's byte offset for next iteration's logging
-			ch_bi                           = bi;
 
 			// Fast-path through spaces, which are always going to be a FONTWxFONTH bg rectangle.
 			if (ch == 0x20u) {
@@ -2082,21 +3101,18 @@ static struct mxcfb_rect
 			ci++;
 		}
 	} else if (glyphWidth <= 32) {
-		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
-			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
+		while (ci < charcount) {
+			ch = codepoints[ci];
+			LOG("Char %.*zu out of %.*zu is U+%04X (%s)",
 			    pad_len,
 			    (ci + 1U),
 			    pad_len,
 			    charcount,
-			    pad_len,
-			    ch_bi,
 			    ch,
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
 			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-			// Remember the next char's byte offset for next iteration's logging
-			ch_bi                           = bi;
 
 			// Fast-path through spaces, which are always going to be a FONTWxFONTH bg rectangle.
 			if (ch == 0x20u) {
@@ -2118,21 +3134,18 @@ static struct mxcfb_rect
 		}
 		/*
 	} else if (glyphWidth <= 64) {
-		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
-			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
+		while (ci < charcount) {
+			ch = codepoints[ci];
+			LOG("Char %.*zu out of %.*zu is U+%04X (%s)",
 			    pad_len,
 			    (ci + 1U),
 			    pad_len,
 			    charcount,
-			    pad_len,
-			    ch_bi,
 			    ch,
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
 			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-			// Remember the next char's byte offset for next iteration's logging
-			ch_bi = bi;
 
 			// Fast-path through spaces, which are always going to be a FONTWxFONTH bg rectangle.
 			if (ch == 0x20u) {
@@ -2154,7 +3167,6 @@ static struct mxcfb_rect
 		}
 	*/
 	}
-#	endif    // FBINK_WITH_FONTS
 
 	return region;
 }
@@ -3692,20 +4704,29 @@ int
 // And finally, dispatch the right refresh request for our HW...
 #ifdef FBINK_FOR_LINUX
 // NOP when we don't have an eInk screen ;).
+// (Save for the shadow buffer, which we still need to push to the fb).
 static int
-    refresh(int                     fbfd __attribute__((unused)),
-	    const struct mxcfb_rect region __attribute__((unused)),
-	    const FBInkConfig*      fbink_cfg __attribute__((unused)))
+    refresh(int fbfd __attribute__((unused)), const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
+	damage_shadow_fb(&region);
+	if (!fbink_cfg->no_refresh) {
+		flush_shadow_fb();
+	}
+
 	return EXIT_SUCCESS;
 }
 
 static int
     refresh_compat(int                     fbfd __attribute__((unused)),
-		   const struct mxcfb_rect region __attribute__((unused)),
-		   bool                    no_refresh __attribute__((unused)),
+		   const struct mxcfb_rect region,
+		   bool                    no_refresh,
 		   const FBInkConfig*      fbink_cfg __attribute__((unused)))
 {
+	damage_shadow_fb(&region);
+	if (!no_refresh) {
+		flush_shadow_fb();
+	}
+
 	return EXIT_SUCCESS;
 }
 #else
@@ -3732,12 +4753,18 @@ static inline void
 static int
     refresh(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
+	// Keep track of what we've touched in the shadow buffer, even if we're not refreshing it just yet...
+	damage_shadow_fb(&region);
+
 	// Were we asked to skip refreshes?
 	if (fbink_cfg->no_refresh) {
 		LOG("Skipping eInk refresh, as requested.");
 		return EXIT_SUCCESS;
 	}
 
+	// ... and make sure it actually made it to the fb before the EPDC gets a look at it.
+	flush_shadow_fb();
+
 	// NOTE: Discard bogus regions, they can cause a softlock on some devices.
 	//       A 0x0 region is a no go on most devices, while a 1x1 region may only upset some Kindle models.
 	//       Some devices even balk at 1xN or Nx1, so, catch that, too.
@@ -3813,6 +4840,8 @@ static int
 static int
     refresh_compat(int fbfd, const struct mxcfb_rect region, bool no_refresh, const FBInkConfig* fbink_cfg)
 {
+	damage_shadow_fb(&region);
+
 	if (no_refresh) {
 		LOG("Skipping eInk refresh, as requested.");
 		return EXIT_SUCCESS;
@@ -4573,6 +5602,14 @@ static __attribute__((cold)) int
 
 	update_verbosity(fbink_cfg);
 
+	// If we're already drawing to a shadow buffer, flush it while we still know the current fb layout...
+	flush_shadow_fb();
+	shadowFb.is_enabled    = fbink_cfg->use_shadow_fb;
+	shadowFb.want_inverted = fbink_cfg->is_shadow_inverted;
+#ifdef FBINK_WITH_DRAW
+	workerThreads = (uint8_t) MAX(1U, MIN(fbink_cfg->threads, WORKERS_MAX));
+#endif
+
 	// Start with some more generic stuff, not directly related to the framebuffer.
 	// As all this stuff is pretty much set in stone, we'll only query it once.
 	if (!deviceQuirks.skipId) {
@@ -5104,21 +6141,28 @@ static __attribute__((cold)) int
 #	ifdef FBINK_WITH_FONTS
 	// Setup custom fonts (glyph size, render fx, bitmap fx)
 	switch (fbink_cfg->fontname) {
+#		ifdef FBINK_WITH_FONT_VGA
 		case VGA:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &vga_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_MICROKNIGHT
 		case MICROKNIGHT:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &microknight_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_TOPAZ
 		case TOPAZ:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &topaz_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_TEWI
 		case TEWIB:
 			glyphWidth         = 6U;
 			glyphHeight        = 13U;
@@ -5129,16 +6173,22 @@ static __attribute__((cold)) int
 			glyphHeight        = 13U;
 			fxpFont8xGetBitmap = &tewi_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_SPLEEN
 		case SPLEEN:
 			glyphWidth          = 16U;
 			glyphHeight         = 32U;
 			fxpFont16xGetBitmap = &spleen_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_FATTY
 		case FATTY:
 			glyphWidth         = 7U;
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &fatty_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_TERMINUS
 		case TERMINUSB:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
@@ -5149,6 +6199,8 @@ static __attribute__((cold)) int
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &terminus_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_SCIENTIFICA
 		case SCIENTIFICAI:
 			glyphWidth         = 7U;
 			glyphHeight        = 12U;
@@ -5164,6 +6216,8 @@ static __attribute__((cold)) int
 			glyphHeight        = 12U;
 			fxpFont8xGetBitmap = &scientifica_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_ORP
 		case ORPI:
 			glyphWidth         = 6U;
 			glyphHeight        = 12U;
@@ -5179,21 +6233,29 @@ static __attribute__((cold)) int
 			glyphHeight        = 12U;
 			fxpFont8xGetBitmap = &orp_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_CTRLD
 		case CTRLD:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &ctrld_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_FKP
 		case FKP:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
 			fxpFont8xGetBitmap = &fkp_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_KATES
 		case KATES:
 			glyphWidth         = 7U;
 			glyphHeight        = 15U;
 			fxpFont8xGetBitmap = &kates_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_LEGGIE
 		case VEGGIE:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
@@ -5204,12 +6266,16 @@ static __attribute__((cold)) int
 			glyphHeight        = 18U;
 			fxpFont8xGetBitmap = &leggie_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_BLOCK
 		case BLOCK:
 			glyphWidth          = 32U;
 			glyphHeight         = 32U;
 			// An horizontal resolution > 8 means a different data type...
 			fxpFont32xGetBitmap = &block_get_bitmap;
 			break;
+#		endif
+#		ifdef FBINK_WITH_FONT_UNSCII
 		case UNSCII_TALL:
 			glyphWidth         = 8U;
 			glyphHeight        = 16U;
@@ -5240,6 +6306,7 @@ static __attribute__((cold)) int
 			glyphHeight        = 8U;
 			fxpFont8xGetBitmap = &unscii_get_bitmap;
 			break;
+#		endif
 #		ifdef FBINK_WITH_UNIFONT
 		case UNIFONT:
 			glyphWidth         = 8U;
@@ -5252,13 +6319,19 @@ static __attribute__((cold)) int
 			fxpFont16xGetBitmap = &unifontdw_get_bitmap;
 			break;
 #		endif
+#		ifdef FBINK_WITH_FONT_COZETTE
 		case COZETTE:
 			glyphWidth         = 8U;
 			glyphHeight        = 13U;
 			fxpFont8xGetBitmap = &cozette_get_bitmap;
 			break;
-		case IBM:
+#		endif
 		default:
+			// Either an unknown font, or one that wasn't part of this build's selection (c.f., BITMAP_FONTS)
+			ELOG("Font %s is not available in this FBInk build, using IBM instead.",
+			     fontname_to_string(fbink_cfg->fontname));
+			// fall through
+		case IBM:
 			glyphWidth         = 8U;
 			glyphHeight        = 8U;
 			fxpFont8xGetBitmap = &font8x8_get_bitmap;
@@ -5274,7 +6347,28 @@ static __attribute__((cold)) int
 		ELOG("Custom fonts are not supported in this FBInk build, using IBM instead.");
 	}
 #	endif    // FBINK_WITH_FONTS
-#endif            // FBINK_WITH_BITMAP
+
+	// A font pack, if requested, takes precedence over all of the above
+	if (fbink_cfg->font_pack && *fbink_cfg->font_pack) {
+		if (load_font_pack(fbink_cfg->font_pack) == EXIT_SUCCESS) {
+			glyphWidth  = fontPack.width;
+			glyphHeight = fontPack.height;
+			if (glyphWidth <= 8U) {
+				fxpFont8xGetBitmap = &font_pack_get_bitmap8;
+			} else if (glyphWidth <= 16U) {
+				fxpFont16xGetBitmap = &font_pack_get_bitmap16;
+			} else {
+				fxpFont32xGetBitmap = &font_pack_get_bitmap32;
+			}
+		} else {
+			WARN("Failed to load font pack `%s`, using %s instead",
+			     fbink_cfg->font_pack,
+			     fontname_to_string(fbink_cfg->fontname));
+		}
+	} else {
+		release_font_pack();
+	}
+#endif    // FBINK_WITH_BITMAP
 
 	// Obey user-specified font scaling multiplier
 	if (fbink_cfg->fontmult > 0) {
@@ -5291,8 +6385,8 @@ static __attribute__((cold)) int
 			// NOTE: If that weren't a circular dependency, we'd take care of the isPerfectFit case here,
 			//       but we can't, so instead that corner-case is handled in fbink_print...
 		}
-#ifdef FBINK_WITH_FONTS
-		// NOTE: Handle custom fonts, no matter their base glyph size...
+#ifdef FBINK_WITH_BITMAP
+		// NOTE: Handle custom fonts (and font packs), no matter their base glyph size...
 		// We want at least N columns, so, viewWidth / N / glyphWidth gives us the maximum multiplier.
 		const uint8_t max_fontmult_width  = (uint8_t) (viewWidth / min_maxcols / glyphWidth);
 		// We want at least 1 row, so, viewHeight / glyphHeight gives us the maximum multiplier.
@@ -5333,17 +6427,23 @@ static __attribute__((cold)) int
 				FONTSIZE_MULT = 4U;    // 32x32
 			}
 		}
-#ifdef FBINK_WITH_FONTS
-		if (fbink_cfg->fontname == BLOCK) {
+#ifdef FBINK_WITH_BITMAP
+		if (fontPack.map) {
+			// Font packs come in all shapes & sizes, so compensate for their actual width, like below...
+			const unsigned int width_ratio = MAX(1U, glyphWidth / 8U);
+			FONTSIZE_MULT                  = (uint8_t) MAX(1U, (unsigned int) FONTSIZE_MULT / width_ratio);
+#	ifdef FBINK_WITH_FONTS
+		} else if (fbink_cfg->fontname == BLOCK) {
 			// Block is roughly 4 times wider than other fonts, compensate for that...
 			FONTSIZE_MULT = (uint8_t) MAX(1U, FONTSIZE_MULT / 4U);
-#	ifdef FBINK_WITH_UNIFONT
+#		ifdef FBINK_WITH_UNIFONT
 		} else if (fbink_cfg->fontname == SPLEEN || fbink_cfg->fontname == UNIFONTDW) {
-#	else
+#		else
 		} else if (fbink_cfg->fontname == SPLEEN) {
-#	endif
+#		endif
 			// Spleen & Unifont DW are roughly twice as wide as other fonts, compensate for that...
 			FONTSIZE_MULT = (uint8_t) MAX(1U, FONTSIZE_MULT / 2U);
+#	endif
 		}
 #endif
 	}
@@ -5353,9 +6453,13 @@ static __attribute__((cold)) int
 	ELOG("Fontsize set to %hux%hu (%s base glyph size: %hhux%hhu)",
 	     FONTW,
 	     FONTH,
-	     fontname_to_string(fbink_cfg->fontname),
+	     current_font_name(fbink_cfg),
 	     glyphWidth,
 	     glyphHeight);
+#ifdef FBINK_WITH_BITMAP
+	// Cached glyph cells depend on all of the above (as well as on the fb format), so start afresh
+	glyph_cache_setup();
+#endif
 
 	// Compute MAX* values now that we know the screen & font resolution
 	MAXCOLS = (unsigned short int) (viewWidth / FONTW);
@@ -5446,45 +6550,82 @@ static __attribute__((cold)) int
 			fxpGetPixel        = &get_pixel_Gray4;
 			fxpFillRect        = &fill_rect_Gray4;
 			fxpFillRectChecked = &fill_rect_Gray4_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_Y4;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_Y4;
+#	endif
 			break;
 		case FBINK_PXFMT_Y8:
 			//fxpPutPixel = &put_pixel_Gray8;
 			fxpGetPixel        = &get_pixel_Gray8;
 			fxpFillRect        = &fill_rect_Gray8;
 			fxpFillRectChecked = &fill_rect_Gray8_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_Y8;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_Y8;
+#	endif
 			break;
 		case FBINK_PXFMT_BGR565:
 			//fxpPutPixel = &put_pixel_RGB565;
 			fxpGetPixel        = &get_pixel_BGR565;
 			fxpFillRect        = &fill_rect_RGB565;
 			fxpFillRectChecked = &fill_rect_RGB565_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_BGR565;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_BGR565;
+#	endif
 			break;
 		case FBINK_PXFMT_RGB565:
 			//fxpPutPixel = &put_pixel_RGB565;
 			fxpGetPixel        = &get_pixel_RGB565;
 			fxpFillRect        = &fill_rect_RGB565;
 			fxpFillRectChecked = &fill_rect_RGB565_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_RGB565;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_RGB565;
+#	endif
 			break;
 		case FBINK_PXFMT_BGR24:
 			//fxpPutPixel = &put_pixel_BGR24;
 			fxpGetPixel        = &get_pixel_BGR24;
 			fxpFillRect        = &fill_rect_RGB24;
 			fxpFillRectChecked = &fill_rect_RGB24_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_BGR24;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_BGR24;
+#	endif
 			break;
 		case FBINK_PXFMT_RGB24:
 			//fxpPutPixel = &put_pixel_RGB24;
 			fxpGetPixel        = &get_pixel_RGB24;
 			fxpFillRect        = &fill_rect_RGB24;
 			fxpFillRectChecked = &fill_rect_RGB24_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_RGB24;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_RGB24;
+#	endif
 			break;
 		case FBINK_PXFMT_BGRA:
-		case FBINK_PXFMT_RGBA:
 		case FBINK_PXFMT_BGR32:
+			//fxpPutPixel = &put_pixel_RGB32;
+			fxpGetPixel        = &get_pixel_RGB32;
+			fxpFillRect        = &fill_rect_RGB32;
+			fxpFillRectChecked = &fill_rect_RGB32_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_BGRA;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_BGRA;
+#	endif
+			break;
+		case FBINK_PXFMT_RGBA:
 		case FBINK_PXFMT_RGB32:
 			//fxpPutPixel = &put_pixel_RGB32;
 			fxpGetPixel        = &get_pixel_RGB32;
 			fxpFillRect        = &fill_rect_RGB32;
 			fxpFillRectChecked = &fill_rect_RGB32_checked;
+			fxpPlotGlyphRow    = &plot_glyph_row_RGBA;
+#	ifdef FBINK_WITH_OPENTYPE
+			fxpPaintOTLine = &paint_ot_line_RGBA;
+#	endif
 			break;
 		default:
 			// Huh oh... Should never happen!
@@ -5501,6 +6642,11 @@ static __attribute__((cold)) int
 	}
 #endif    // FBINK_WITH_DRAW
 
+	// If the fb is already mapped (e.g., on a reinit), (re)setup the shadow buffer for the new layout
+	if (isFbMapped) {
+		setup_shadow_fb();
+	}
+
 	// NOTE: Do we want to keep the fb0 fd open, or simply close it for now?
 	//       Useful because we probably want to close it to keep open fds to a minimum when used as a library,
 	//       while wanting to avoid a useless open/close/open/close cycle when used as a standalone tool.
@@ -5540,7 +6686,7 @@ static __attribute__((cold)) const char*
 
 // Load OT fonts for fbink_add_ot_font & fbink_add_ot_font_v2
 static __attribute__((cold)) int
-    add_ot_font(const char* filename, FONT_STYLE_T style, FBInkOTFonts* restrict ot_fonts)
+    add_ot_font(const char* filename, FONT_STYLE_T style, FBInkOTFonts* restrict ot_fonts, bool want_cmap_lut)
 {
 #	ifdef FBINK_FOR_KOBO
 	// NOTE: Bail if we were passed a Kobo system font, as they're obfuscated,
@@ -5559,71 +6705,96 @@ static __attribute__((cold)) int
 	}
 	otInit = true;
 
-	// Open font from given path, and load into buffer
-	FILE* f                      = fopen(filename, "r" STDIO_CLOEXEC);
-	unsigned char* restrict data = NULL;
-	if (!f) {
-		PFWARN("fopen: %m");
+	// Open font from given path
+	int fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		PFWARN("open: %m");
+		otInit = false;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		PFWARN("fstat: %m");
+		close(fd);
 		otInit = false;
 		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// If someone already loaded that very same file (be it for another style, another FBInkOTConfig, or the global pool),
+	// just share it.
+	FBInkOTFace* face = otFaces;
+	while (face && (face->dev != st.st_dev || face->ino != st.st_ino)) {
+		face = face->next;
+	}
+	if (face) {
+		close(fd);
+		face->refs++;
+		LOG("Font `%s` is already loaded, sharing it (%u users)", filename, face->refs);
 	} else {
-		const int   fd = fileno(f);
-		struct stat st;
-		if (fstat(fd, &st) == -1) {
-			PFWARN("fstat: %m");
-			fclose(f);
-			otInit = false;
+		// Otherwise, map it. Pages will only be faulted in as stbtt actually looks at them,
+		// and the page cache is shared with anyone else using the same font (e.g., the system's text rendering stack).
+		// NOTE: This does mean that truncating or rewriting the file in place while it's loaded will end badly,
+		//       but replacing it (i.e., a new inode) is perfectly safe.
+		const size_t size = (size_t) st.st_size;
+		// NOTE: Not even enough room for an sfnt header, don't let stbtt read past the end of the mapping.
+		if (size < 12U) {
+			close(fd);
+			WARN("File `%s` doesn't appear to be a valid or supported font", filename);
 			return ERRCODE(EXIT_FAILURE);
 		}
-		data = calloc((size_t) st.st_size, sizeof(*data));
-		if (!data) {
-			PFWARN("Error allocating font data buffer: %m");
-			fclose(f);
+		const unsigned char* map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+		// The mapping holds its own reference to the file
+		close(fd);
+		if (map == MAP_FAILED) {
+			PFWARN("mmap: %m");
 			otInit = false;
 			return ERRCODE(EXIT_FAILURE);
 		}
-		if (fread(data, 1U, (size_t) st.st_size, f) < (size_t) st.st_size || ferror(f) != 0) {
-			free(data);
-			fclose(f);
-			otInit = false;
-			WARN("Error reading font file `%s`", filename);
+
+		face = calloc(1U, sizeof(*face));
+		if (!face) {
+			PFWARN("Error allocating FBInkOTFace struct: %m");
+			munmap((void*) (uintptr_t) map, size);
 			return ERRCODE(EXIT_FAILURE);
 		}
-		fclose(f);
-	}
-	stbtt_fontinfo* font_info = calloc(1U, sizeof(stbtt_fontinfo));
-	if (!font_info) {
-		PFWARN("Error allocating stbtt_fontinfo struct: %m");
-		free(data);
-		return ERRCODE(EXIT_FAILURE);
-	}
-	// First, check if we can actually find a recognizable font format in the data...
-	const int fontcount = stbtt_GetNumberOfFonts(data);
-	if (fontcount == 0) {
-		free(data);
-		free(font_info);
-		WARN("File `%s` doesn't appear to be a valid or supported font", filename);
-		return ERRCODE(EXIT_FAILURE);
-	} else if (fontcount > 1) {
-		LOG("Font file `%s` appears to be a font collection containing %d fonts, but we'll only use the first one!",
-		    filename,
-		    fontcount);
-	}
-	// Then, get the offset to the first font
-	const int fontoffset = stbtt_GetFontOffsetForIndex(data, 0);
-	if (fontoffset == -1) {
-		free(data);
-		free(font_info);
-		WARN("File `%s` doesn't appear to contain valid font data at offset %d", filename, fontoffset);
-		return ERRCODE(EXIT_FAILURE);
-	}
-	// And finally, initialize that font
-	// NOTE: We took the long way 'round to try to avoid crashes on invalid data...
-	if (!stbtt_InitFont(font_info, data, fontoffset)) {
-		free(font_info->data);
-		free(font_info);
-		WARN("Error initialising font `%s`", filename);
-		return ERRCODE(EXIT_FAILURE);
+		face->map  = map;
+		face->size = size;
+		// First, check if we can actually find a recognizable font format in the data...
+		const int fontcount = stbtt_GetNumberOfFonts(map);
+		if (fontcount == 0) {
+			WARN("File `%s` doesn't appear to be a valid or supported font", filename);
+			goto invalid;
+		} else if (fontcount > 1) {
+			LOG("Font file `%s` appears to be a font collection containing %d fonts, but we'll only use the first one!",
+			    filename,
+			    fontcount);
+		}
+		// Then, get the offset to the first font
+		const int fontoffset = stbtt_GetFontOffsetForIndex(map, 0);
+		if (fontoffset == -1) {
+			WARN("File `%s` doesn't appear to contain valid font data at offset %d", filename, fontoffset);
+			goto invalid;
+		}
+		// And finally, initialize that font
+		// NOTE: We took the long way 'round to try to avoid crashes on invalid data...
+		if (!stbtt_InitFont(&face->info, map, fontoffset)) {
+			WARN("Error initialising font `%s`", filename);
+			goto invalid;
+		}
+		face->dev  = st.st_dev;
+		face->ino  = st.st_ino;
+		face->refs = 1U;
+		face->next = otFaces;
+		otFaces    = face;
+	}
+	// Only the table of page pointers is allocated now, pages are populated as codepoints are looked up.
+	// NOTE: If the face is shared, so is the table, for everyone's benefit.
+	if (want_cmap_lut && !face->cmap_pages) {
+		face->cmap_pages = calloc(OT_CMAP_PAGES, sizeof(*face->cmap_pages));
+		if (!face->cmap_pages) {
+			// Not fatal, we'll just query the font's cmap directly
+			PFWARN("Error allocating cmap lookup table: %m");
+		}
 	}
 	// Assign the current font to its appropriate FBInkOTFonts struct member, depending on the style specified by the caller.
 	// NOTE: We make sure we free any previous allocation first!
@@ -5632,35 +6803,39 @@ static __attribute__((cold)) int
 			if (free_ot_font(&(ot_fonts->otRegular)) == EXIT_SUCCESS) {
 				LOG("Replacing an existing Regular font style!");
 			}
-			ot_fonts->otRegular = font_info;
+			ot_fonts->otRegular = face;
 			break;
 		case FNT_ITALIC:
 			if (free_ot_font(&(ot_fonts->otItalic)) == EXIT_SUCCESS) {
 				LOG("Replacing an existing Italic font style!");
 			}
-			ot_fonts->otItalic = font_info;
+			ot_fonts->otItalic = face;
 			break;
 		case FNT_BOLD:
 			if (free_ot_font(&(ot_fonts->otBold)) == EXIT_SUCCESS) {
 				LOG("Replacing an existing Bold font style!");
 			}
-			ot_fonts->otBold = font_info;
+			ot_fonts->otBold = face;
 			break;
 		case FNT_BOLD_ITALIC:
 			if (free_ot_font(&(ot_fonts->otBoldItalic)) == EXIT_SUCCESS) {
 				LOG("Replacing an existing Bold Italic font style!");
 			}
-			ot_fonts->otBoldItalic = font_info;
+			ot_fonts->otBoldItalic = face;
 			break;
 		default:
-			free(font_info->data);
-			free(font_info);
+			free_ot_font(&face);
 			WARN("Cannot load font `%s`: requested style (%d) is invalid!", filename, style);
 			return ERRCODE(EXIT_FAILURE);
 	}
 
 	ELOG("Font `%s` loaded for style '%s'", filename, font_style_to_string(style));
 	return EXIT_SUCCESS;
+
+invalid:
+	munmap((void*) (uintptr_t) face->map, face->size);
+	free(face);
+	return ERRCODE(EXIT_FAILURE);
 }
 #endif    // FBINK_WITH_OPENTYPE
 
@@ -5671,7 +6846,7 @@ int
 #ifdef FBINK_WITH_OPENTYPE
 	// Legacy variant, using the global otFonts
 	LOG("Loading font data in the global font pool . . .");
-	return add_ot_font(filename, style, &otFonts);
+	return add_ot_font(filename, style, &otFonts, false);
 #else
 	WARN("OpenType support is disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -5695,7 +6870,7 @@ int
 	}
 	// New variant, using a per-FBInkOTConfig instance
 	LOG("Loading font data in a local FBInkOTFonts instance (%p) . . .", cfg->font);
-	return add_ot_font(filename, style, (FBInkOTFonts*) cfg->font);
+	return add_ot_font(filename, style, (FBInkOTFonts*) cfg->font, cfg->cmap_lut);
 #else
 	WARN("OpenType support is disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -5705,13 +6880,33 @@ int
 #ifdef FBINK_WITH_OPENTYPE
 // Free an individual OpenType font structure
 static __attribute__((cold)) int
-    free_ot_font(stbtt_fontinfo** restrict font_info)
+    free_ot_font(FBInkOTFace** restrict face)
 {
-	if (*font_info) {
-		free((*font_info)->data);    // This is the font data we loaded
-		free(*font_info);
+	if (*face) {
+		FBInkOTFace* f = *face;
 		// Don't leave a dangling pointer
-		*font_info = NULL;
+		*face          = NULL;
+
+		// Only actually release it once nobody else is using it
+		if (--f->refs > 0U) {
+			return EXIT_SUCCESS;
+		}
+		for (FBInkOTFace** link = &otFaces; *link; link = &(*link)->next) {
+			if (*link == f) {
+				*link = f->next;
+				break;
+			}
+		}
+		// NOTE: The glyph cache is keyed on the stbtt_fontinfo pointer, which the next font loaded may very well reuse.
+		ot_cache_purge(&f->info);
+		if (f->cmap_pages) {
+			for (size_t i = 0U; i < OT_CMAP_PAGES; i++) {
+				free(f->cmap_pages[i]);
+			}
+			free(f->cmap_pages);
+		}
+		munmap((void*) (uintptr_t) f->map, f->size);
+		free(f);
 
 		return EXIT_SUCCESS;
 	} else {
@@ -5738,6 +6933,268 @@ static __attribute__((cold)) int
 
 	return EXIT_SUCCESS;
 }
+
+static uint32_t
+    ot_cache_hash(const stbtt_fontinfo* font, int gi, float sf)
+{
+	uint32_t sf_bits;
+	memcpy(&sf_bits, &sf, sizeof(sf_bits));
+	uint32_t h = (uint32_t) ((uintptr_t) font >> 4U) ^ ((uint32_t) gi * 0x85EBCA6Bu) ^ (sf_bits * 0xC2B2AE35u);
+	h ^= h >> 16U;
+	h *= 0x9E3779B1u;
+	h ^= h >> 16U;
+	return h & (OT_CACHE_BUCKETS - 1U);
+}
+
+// Unlink a glyph from the cache, and release it
+static void
+    ot_cache_drop(FBInkOTGlyph* restrict glyph)
+{
+	FBInkOTGlyph** link = &otCache.buckets[ot_cache_hash(glyph->font, glyph->gi, glyph->sf)];
+	while (*link != glyph) {
+		link = &(*link)->hnext;
+	}
+	*link = glyph->hnext;
+	if (glyph->prev) {
+		glyph->prev->next = glyph->next;
+	} else {
+		otCache.head = glyph->next;
+	}
+	if (glyph->next) {
+		glyph->next->prev = glyph->prev;
+	} else {
+		otCache.tail = glyph->prev;
+	}
+
+	otCache.size -= sizeof(*glyph);
+	if (glyph->bitmap) {
+		otCache.size -= (size_t) (glyph->x1 - glyph->x0) * (size_t) (glyph->y1 - glyph->y0);
+	}
+	otCache.count--;
+	free(glyph->bitmap);
+	free(glyph);
+}
+
+// Evict the least recently used glyphs until we're back under budget, sparing keep (which may be NULL).
+// Releases the hash table, too, once the cache is empty.
+static void
+    ot_cache_trim(const FBInkOTGlyph* keep)
+{
+	while (otCache.size > otCache.budget && otCache.tail && otCache.tail != keep) {
+		ot_cache_drop(otCache.tail);
+	}
+
+	if (otCache.count == 0U) {
+		free(otCache.buckets);
+		otCache.buckets = NULL;
+	}
+}
+
+// Evict every glyph & kerning pair of that font (or everything, if font is NULL)
+static void
+    ot_cache_purge(const stbtt_fontinfo* font)
+{
+	FBInkOTGlyph* glyph = otCache.head;
+	while (glyph) {
+		FBInkOTGlyph* next = glyph->next;
+		if (!font || glyph->font == font) {
+			ot_cache_drop(glyph);
+		}
+		glyph = next;
+	}
+	ot_cache_trim(NULL);
+
+	for (size_t i = 0U; i < OT_KERN_SLOTS; i++) {
+		if (!font || otKerns[i].font == font) {
+			otKerns[i].font = NULL;
+		}
+	}
+}
+
+// Returns the (metrics only) cache entry for glyph gi of font at scale sf, creating it on a miss.
+// Returns NULL if the cache is disabled or on allocation failure, in which case the caller should just query stbtt itself.
+// NOTE: The entry is only guaranteed to stay valid until the next ot_cache_* call.
+static FBInkOTGlyph*
+    ot_cache_fetch(const stbtt_fontinfo* font, float sf, int gi)
+{
+	if (otCache.budget == 0U) {
+		return NULL;
+	}
+	if (!otCache.buckets) {
+		otCache.buckets = calloc(OT_CACHE_BUCKETS, sizeof(*otCache.buckets));
+		if (!otCache.buckets) {
+			PFWARN("Failed to allocate the glyph cache: %m");
+			return NULL;
+		}
+	}
+
+	const uint32_t bucket = ot_cache_hash(font, gi, sf);
+	FBInkOTGlyph*  glyph  = otCache.buckets[bucket];
+	while (glyph) {
+		if (glyph->font == font && glyph->gi == gi && glyph->sf == sf) {
+			break;
+		}
+		glyph = glyph->hnext;
+	}
+
+	if (glyph) {
+		// Hit, move it to the front of the LRU list
+		if (glyph->prev) {
+			glyph->prev->next = glyph->next;
+			if (glyph->next) {
+				glyph->next->prev = glyph->prev;
+			} else {
+				otCache.tail = glyph->prev;
+			}
+			glyph->prev        = NULL;
+			glyph->next        = otCache.head;
+			otCache.head->prev = glyph;
+			otCache.head       = glyph;
+		}
+		return glyph;
+	}
+
+	// Miss, start with the metrics, the bitmap is only rendered if someone actually asks for it (c.f., ot_cache_bitmap)
+	glyph = calloc(1U, sizeof(*glyph));
+	if (!glyph) {
+		PFWARN("Failed to allocate a glyph cache entry: %m");
+		return NULL;
+	}
+	glyph->font = font;
+	glyph->sf   = sf;
+	glyph->gi   = gi;
+	int lsb;
+	stbtt_GetGlyphHMetrics(font, gi, &glyph->adv, &lsb);
+	stbtt_GetGlyphBitmapBox(font, gi, sf, sf, &glyph->x0, &glyph->y0, &glyph->x1, &glyph->y1);
+
+	glyph->hnext            = otCache.buckets[bucket];
+	otCache.buckets[bucket] = glyph;
+	glyph->next             = otCache.head;
+	if (otCache.head) {
+		otCache.head->prev = glyph;
+	} else {
+		otCache.tail = glyph;
+	}
+	otCache.head = glyph;
+	otCache.size += sizeof(*glyph);
+	otCache.count++;
+
+	ot_cache_trim(glyph);
+	return glyph;
+}
+
+// Returns the coverage mask of a cached glyph, rendering it on first use. NULL on allocation failure.
+static const unsigned char*
+    ot_cache_bitmap(FBInkOTGlyph* restrict glyph)
+{
+	if (!glyph->bitmap) {
+		const int gw  = glyph->x1 - glyph->x0;
+		const int gh  = glyph->y1 - glyph->y0;
+		glyph->bitmap = malloc((size_t) gw * (size_t) gh);
+		if (!glyph->bitmap) {
+			PFWARN("Failed to allocate a glyph cache bitmap: %m");
+			return NULL;
+		}
+		// NOTE: Unlike in fbink_print_ot, we always render the full glyph box, so out_stride is simply gw.
+		stbtt_MakeGlyphBitmap(glyph->font, glyph->bitmap, gw, gh, gw, glyph->sf, glyph->sf, glyph->gi);
+		otCache.size += (size_t) gw * (size_t) gh;
+
+		ot_cache_trim(glyph);
+	}
+
+	return glyph->bitmap;
+}
+
+// Unscaled kerning adjustment between those two glyphs, as returned by stbtt_GetGlyphKernAdvance.
+// NOTE: That one can be fairly expensive, as it may have to walk GPOS lookups, so we remember the most recent pairs.
+static int
+    ot_kern_advance(const stbtt_fontinfo* font, int gi1, int gi2)
+{
+	uint32_t h =
+	    (uint32_t) ((uintptr_t) font >> 4U) ^ ((uint32_t) gi1 * 0x85EBCA6Bu) ^ ((uint32_t) gi2 * 0xC2B2AE35u);
+	h ^= h >> 16U;
+	h *= 0x9E3779B1u;
+	h ^= h >> 16U;
+	FBInkOTKern* slot = &otKerns[h & (OT_KERN_SLOTS - 1U)];
+	if (slot->font != font || slot->gi1 != gi1 || slot->gi2 != gi2) {
+		slot->font = font;
+		slot->gi1  = gi1;
+		slot->gi2  = gi2;
+		slot->kern = stbtt_GetGlyphKernAdvance(font, gi1, gi2);
+	}
+	return slot->kern;
+}
+
+// Returns the glyph index of codepoint c in that face, via its lookup table if it has one.
+static int
+    ot_face_glyph_index(FBInkOTFace* restrict face, uint32_t c)
+{
+	if (!face->cmap_pages || c >= OT_CMAP_PAGES * OT_CMAP_PAGE_SIZE) {
+		return stbtt_FindGlyphIndex(&face->info, (int) c);
+	}
+
+	uint16_t* page = face->cmap_pages[c / OT_CMAP_PAGE_SIZE];
+	if (unlikely(!page)) {
+		page = malloc(OT_CMAP_PAGE_SIZE * sizeof(*page));
+		if (!page) {
+			return stbtt_FindGlyphIndex(&face->info, (int) c);
+		}
+		// i.e., fill it with OT_CMAP_UNRESOLVED
+		memset(page, 0xFF, OT_CMAP_PAGE_SIZE * sizeof(*page));
+		face->cmap_pages[c / OT_CMAP_PAGE_SIZE] = page;
+	}
+	uint16_t* gi = &page[c % OT_CMAP_PAGE_SIZE];
+	if (unlikely(*gi == OT_CMAP_UNRESOLVED)) {
+		*gi = (uint16_t) stbtt_FindGlyphIndex(&face->info, (int) c);
+	}
+	return *gi;
+}
+
+// Compute the metrics of character c in that font & scale for fbink_print_ot (c.f., FBInkOTRun).
+// next is the byte offset of the following character in string, if any, which we need for kerning.
+static void
+    shape_ot_glyph(FBInkOTRun* restrict  run,
+		   FBInkOTFace* restrict face,
+		   float                 sf,
+		   uint32_t              c,
+		   const char* restrict  string,
+		   size_t                next,
+		   size_t                str_len_bytes)
+{
+	const stbtt_fontinfo* font  = &face->info;
+	const int             gi    = ot_face_glyph_index(face, c);
+	const FBInkOTGlyph*   glyph = ot_cache_fetch(font, sf, gi);
+	// NOTE: The advance is unscaled, but the bitmap box is already scaled
+	int                   adv, x0, y0, x1, y1;
+	if (glyph) {
+		adv = glyph->adv;
+		x0  = glyph->x0;
+		y0  = glyph->y0;
+		x1  = glyph->x1;
+		y1  = glyph->y1;
+	} else {
+		int lsb;
+		stbtt_GetGlyphHMetrics(font, gi, &adv, &lsb);
+		stbtt_GetGlyphBitmapBox(font, gi, sf, sf, &x0, &y0, &x1, &y1);
+	}
+	run->gi  = (uint16_t) gi;
+	run->x0  = (int16_t) x0;
+	run->y0  = (int16_t) y0;
+	run->x1  = (int16_t) x1;
+	run->y1  = (int16_t) y1;
+	run->adv = (int16_t) iroundf(sf * (float) adv);
+
+	// NOTE: Kerning is looked up in *this* glyph's font, even if the next character happens to be markup,
+	//       or in a different style.
+	run->kern = 0;
+	if (next < str_len_bytes) {
+		const uint32_t c2   = u8_nextchar2(string, &next);
+		const int      g2   = ot_face_glyph_index(face, c2);
+		const int      kern = ot_kern_advance(font, gi, g2);
+		run->kern           = (int16_t) iroundf(sf * (float) kern);
+	}
+	run->is_shaped = true;
+}
 #endif    // FBINK_WITH_OPENTYPE
 
 // Free all OpenType fonts (as loaded by fbink_add_ot_font)
@@ -5779,6 +7236,24 @@ int
 #endif    // FBINK_WITH_OPENTYPE
 }
 
+// Set the memory budget of the OpenType glyph cache (0 disables it, and releases whatever it held)
+int
+    fbink_set_ot_cache_budget(size_t bytes UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	otCache.budget = bytes;
+	ot_cache_trim(NULL);
+	LOG("OpenType glyph cache budget set to %zu bytes (%zu glyphs cached in %zu bytes)",
+	    bytes,
+	    otCache.count,
+	    otCache.size);
+	return EXIT_SUCCESS;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
 // Dump a few of our internal state variables to stdout, for shell script consumption
 void
     fbink_state_dump(const FBInkConfig* fbink_cfg)
@@ -5803,7 +7278,7 @@ void
 	    FONTW,
 	    FONTH,
 	    FONTSIZE_MULT,
-	    fontname_to_string(fbink_cfg->fontname),
+	    current_font_name(fbink_cfg),
 	    glyphWidth,
 	    glyphHeight,
 	    MAXCOLS,
@@ -5853,7 +7328,7 @@ void
     fbink_get_state(const FBInkConfig* restrict fbink_cfg, FBInkState* restrict fbink_state)
 {
 	fbink_state->user_hz            = USER_HZ;
-	fbink_state->font_name          = fontname_to_string(fbink_cfg->fontname);
+	fbink_state->font_name          = current_font_name(fbink_cfg);
 	fbink_state->view_width         = viewWidth;
 	fbink_state->view_height        = viewHeight;
 	fbink_state->screen_width       = screenWidth;
@@ -5907,13 +7382,260 @@ void
 	fbink_state->can_wait_for_submission = deviceQuirks.canWaitForSubmission;
 }
 
+// XOR len bytes from src with a repeating 32-bit mask, and store them to dst (which may be src, to invert in place).
+// The mask is applied per native 32-bit word, i.e., 0x00FFFFFFu inverts a 32bpp pixel while keeping its alpha intact,
+// and 0xFFFFFFFFu simply inverts every byte, which does the right thing at every other bitdepth
+// (including both nibbles of a 4bpp byte, and a full RGB565 pixel).
+// NOTE: Unless the mask is uniform, dst needs to be 4-bytes aligned, so that the mask's phase survives the SIMD alignment.
+static inline __attribute__((always_inline, hot)) void
+    xor_span(uint8_t* dst, const uint8_t* src, size_t len, uint32_t mask)
+{
+	uint8_t mask_bytes[4];
+	memcpy(mask_bytes, &mask, sizeof(mask_bytes));
+	size_t i = 0U;
+#ifdef FBINK_SIMD_BYTES
+	while (i < len && !IS_ALIGNED((uintptr_t) (dst + i), FBINK_SIMD_BYTES)) {
+		dst[i] = src[i] ^ mask_bytes[i & 3U];
+		i++;
+	}
+#	if defined(FBINK_SIMD_NEON)
+	const uint8x16_t vmask = vreinterpretq_u8_u32(vdupq_n_u32(mask));
+	for (; i + 16U <= len; i += 16U) {
+		vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), vmask));
+	}
+#	elif defined(FBINK_SIMD_AVX2)
+	const __m256i vmask = _mm256_set1_epi32((int) mask);
+	for (; i + 32U <= len; i += 32U) {
+		const __m256i v = _mm256_loadu_si256((const __m256i*) (src + i));
+		_mm256_store_si256((__m256i*) (dst + i), _mm256_xor_si256(v, vmask));
+	}
+#	elif defined(FBINK_SIMD_SSE2)
+	const __m128i vmask = _mm_set1_epi32((int) mask);
+	for (; i + 16U <= len; i += 16U) {
+		const __m128i v = _mm_loadu_si128((const __m128i*) (src + i));
+		_mm_store_si128((__m128i*) (dst + i), _mm_xor_si128(v, vmask));
+	}
+#	endif
+#endif    // FBINK_SIMD_BYTES
+	for (; i < len; i++) {
+		dst[i] = src[i] ^ mask_bytes[i & 3U];
+	}
+}
+
+// The XOR mask that inverts the current fb's pixels (c.f., xor_span)
+static uint32_t
+    fb_inversion_mask(void)
+{
+	return vInfo.bits_per_pixel == 32U ? 0x00FFFFFFu : 0xFFFFFFFFu;
+}
+
+// Copy a span from the shadow buffer to the fb (or the other way around), inverting it on the way if need be.
+// stream should only be set when dst is the actual fb (c.f., blit_copy).
+static inline __attribute__((always_inline)) void
+    copy_shadow_span(unsigned char* restrict dst, const unsigned char* restrict src, size_t len, bool stream)
+{
+	if (shadowFb.is_inverted) {
+		xor_span(dst, src, len, fb_inversion_mask());
+	} else {
+		blit_copy(dst, src, len, stream);
+	}
+}
+
+// Allocate & seed the shadow buffer, and point fbPtr to it, if it was requested.
+// If it's already active (e.g., on a reinit), resize the tile map & re-seed it, or start afresh if the buffers no longer fit.
+// NOTE: Must only be called once the fb has actually been mapped!
+//       Failures are non-fatal: we simply keep drawing straight to the fb.
+static void
+    setup_shadow_fb(void)
+{
+	if (!shadowFb.is_enabled) {
+		// If the fb was holding an inverted copy, restore it
+		if (shadowFb.is_inverted) {
+			shadowFb.is_inverted = false;
+			if (shadowFb.fb_mem) {
+				damage_full_shadow_fb();
+			} else {
+				xor_span(fbPtr, fbPtr, (size_t) fInfo.line_length * vInfo.yres, fb_inversion_mask());
+			}
+		}
+		release_shadow_fb();
+		return;
+	}
+
+	free(shadowFb.dirty);
+	shadowFb.tiles_per_row  = (vInfo.xres + SHADOW_TILE_SIZE - 1U) / SHADOW_TILE_SIZE;
+	shadowFb.tile_rows      = (vInfo.yres + SHADOW_TILE_SIZE - 1U) / SHADOW_TILE_SIZE;
+	const size_t tile_count = (size_t) shadowFb.tiles_per_row * shadowFb.tile_rows;
+	shadowFb.dirty          = calloc((tile_count + 7U) / 8U, sizeof(*shadowFb.dirty));
+	if (!shadowFb.dirty) {
+		PFWARN("Error allocating shadow tile map: %m");
+		release_shadow_fb();
+		return;
+	}
+
+	// NOTE: Match the mapping's footprint, so that every fbPtr consumer (dumps, fbink_get_fb_pointer) is none the wiser.
+#ifdef FBINK_FOR_KOBO
+	const size_t size = deviceQuirks.isSunxi ? sunxiCtx.alloc_size : fInfo.smem_len;
+#else
+	const size_t size = fInfo.smem_len;
+#endif
+
+	if (shadowFb.fb_mem) {
+		// Already active, and the buffers still match the fb's layout, just re-seed it
+		if (shadowFb.size == size && shadowFb.line_length == fInfo.line_length) {
+			copy_shadow_span(fbPtr, shadowFb.fb_mem, shadowFb.size, false);
+			update_shadow_fb_inversion();
+			return;
+		}
+
+		// Otherwise, our copy is meaningless (and flushing it would overrun one of the buffers), so just drop it.
+		LOG("Framebuffer layout changed, reallocating the shadow buffer");
+		free(fbPtr);
+		fbPtr           = shadowFb.fb_mem;
+		shadowFb.fb_mem = NULL;
+		shadowFb.size   = 0U;
+	}
+
+	unsigned char* buffer = malloc(size);
+	if (!buffer) {
+		PFWARN("Error allocating shadow buffer: %m");
+		free(shadowFb.dirty);
+		shadowFb.dirty = NULL;
+		return;
+	}
+	// NOTE: That's the one and only time we have to read from the (potentially uncached) fb...
+	copy_shadow_span(buffer, fbPtr, size, false);
+
+	shadowFb.fb_mem      = fbPtr;
+	shadowFb.size        = size;
+	shadowFb.line_length = fInfo.line_length;
+	fbPtr                = buffer;
+	update_shadow_fb_inversion();
+	LOG("Drawing to a %zu bytes shadow buffer (%ux%u tiles)", size, shadowFb.tiles_per_row, shadowFb.tile_rows);
+}
+
+// Mark every tile as dirty
+static void
+    damage_full_shadow_fb(void)
+{
+	const size_t tile_count = (size_t) shadowFb.tiles_per_row * shadowFb.tile_rows;
+	memset(shadowFb.dirty, 0xFF, (tile_count + 7U) / 8U);
+}
+
+// Switch to the requested inversion state, which means the whole fb will have to be flushed again
+static void
+    update_shadow_fb_inversion(void)
+{
+	if (shadowFb.is_inverted != shadowFb.want_inverted) {
+		shadowFb.is_inverted = shadowFb.want_inverted;
+		damage_full_shadow_fb();
+		LOG("%s the shadow buffer on its way to the fb",
+		    shadowFb.is_inverted ? "Inverting" : "No longer inverting");
+	}
+}
+
+// Mark the tiles covered by a region (in fb coordinates, i.e., *after* fxpRotateRegion) as dirty
+static void
+    damage_shadow_fb(const struct mxcfb_rect* restrict region)
+{
+	if (!shadowFb.fb_mem) {
+		return;
+	}
+
+	if (region->left >= vInfo.xres || region->top >= vInfo.yres || region->width == 0U || region->height == 0U) {
+		return;
+	}
+	const uint32_t right  = MIN(region->left + region->width, vInfo.xres);
+	const uint32_t bottom = MIN(region->top + region->height, vInfo.yres);
+
+	for (uint32_t ty = region->top / SHADOW_TILE_SIZE; ty <= (bottom - 1U) / SHADOW_TILE_SIZE; ty++) {
+		for (uint32_t tx = region->left / SHADOW_TILE_SIZE; tx <= (right - 1U) / SHADOW_TILE_SIZE; tx++) {
+			const size_t tile = (size_t) ty * shadowFb.tiles_per_row + tx;
+			shadowFb.dirty[tile >> 3U] |= (uint8_t) (1U << (tile & 7U));
+		}
+	}
+}
+
+// Push the dirty tiles to the actual fb, coalescing horizontal runs of dirty tiles into a single copy per scanline
+// (and full-width runs into a single copy for the whole band), because that's what uncached/write-combined memory likes.
+static void
+    flush_shadow_fb(void)
+{
+	if (!shadowFb.fb_mem) {
+		return;
+	}
+
+	for (uint32_t ty = 0U; ty < shadowFb.tile_rows; ty++) {
+		const uint32_t y0 = ty * SHADOW_TILE_SIZE;
+		const uint32_t y1 = MIN(y0 + SHADOW_TILE_SIZE, vInfo.yres);
+		uint32_t       tx = 0U;
+		while (tx < shadowFb.tiles_per_row) {
+			size_t tile = (size_t) ty * shadowFb.tiles_per_row + tx;
+			if (!(shadowFb.dirty[tile >> 3U] & (1U << (tile & 7U)))) {
+				tx++;
+				continue;
+			}
+
+			// Consume the full run of dirty tiles
+			const uint32_t run_start = tx;
+			while (tx < shadowFb.tiles_per_row && (shadowFb.dirty[tile >> 3U] & (1U << (tile & 7U)))) {
+				shadowFb.dirty[tile >> 3U] &= (uint8_t) ~(1U << (tile & 7U));
+				tx++;
+				tile++;
+			}
+
+			if (run_start == 0U && tx == shadowFb.tiles_per_row) {
+				// Full scanlines, copy the whole band in one go
+				const size_t offset = (size_t) fInfo.line_length * y0;
+				copy_shadow_span(shadowFb.fb_mem + offset,
+						 fbPtr + offset,
+						 (size_t) fInfo.line_length * (y1 - y0),
+						 true);
+			} else {
+				const uint32_t x0 = run_start * SHADOW_TILE_SIZE;
+				const uint32_t x1 = MIN(tx * SHADOW_TILE_SIZE, vInfo.xres);
+				// NOTE: Round outwards, to handle sub-byte pixels (i.e., 4bpp)
+				const size_t start = ((size_t) x0 * vInfo.bits_per_pixel) >> 3U;
+				const size_t len   = ((((size_t) x1 * vInfo.bits_per_pixel) + 7U) >> 3U) - start;
+				for (uint32_t y = y0; y < y1; y++) {
+					const size_t offset = (size_t) fInfo.line_length * y + start;
+					copy_shadow_span(shadowFb.fb_mem + offset, fbPtr + offset, len, true);
+				}
+			}
+		}
+	}
+	blit_fence(true);
+}
+
+// Flush the shadow buffer one last time, and point fbPtr back to the actual fb
+static void
+    release_shadow_fb(void)
+{
+	if (shadowFb.fb_mem) {
+		flush_shadow_fb();
+		free(fbPtr);
+		fbPtr           = shadowFb.fb_mem;
+		shadowFb.fb_mem = NULL;
+		shadowFb.size   = 0U;
+	}
+
+	free(shadowFb.dirty);
+	shadowFb.dirty = NULL;
+}
+
 // Memory map the framebuffer
 static int
     memmap_fb(int fbfd)
 {
 #ifdef FBINK_FOR_KOBO
 	if (deviceQuirks.isSunxi) {
-		return memmap_ion();
+		const int rv = memmap_ion();
+		if (rv != EXIT_SUCCESS) {
+			return rv;
+		}
+
+		setup_shadow_fb();
+		return EXIT_SUCCESS;
 	}
 #endif
 
@@ -5932,6 +7654,9 @@ static int
 		isFbMapped = true;
 	}
 
+	// If requested, we'll actually draw to a shadow copy
+	setup_shadow_fb();
+
 	return EXIT_SUCCESS;
 }
 
@@ -6071,6 +7796,9 @@ cleanup:
 static int
     unmap_fb(void)
 {
+	// Make sure nothing we've drawn gets lost, and get back to the actual mapping
+	release_shadow_fb();
+
 #ifdef FBINK_FOR_KOBO
 	if (deviceQuirks.isSunxi) {
 		return unmap_ion();
@@ -6176,8 +7904,13 @@ int
 		}
 	}
 
-#ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
+#ifdef FBINK_WITH_BITMAP
+	glyph_cache_reset();
+	release_font_pack();
+#endif
+
+#ifdef FBINK_FOR_KOBO
+	if (deviceQuirks.isSunxi) {
 		if (close_accelerometer_i2c() != EXIT_SUCCESS) {
 			WARN("Failed to close accelerometer I²C handle");
 			return ERRCODE(EXIT_FAILURE);
@@ -6420,33 +8153,8 @@ int
 	}
 
 	// Similar in spirit to clear_screen, but closer to KOReader's BB_invert_rect ;).
-	if (unlikely(vInfo.bits_per_pixel == 16U)) {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wcast-align"
-		uint16_t* p = (uint16_t*) fbPtr;
-#pragma GCC diagnostic pop
-		size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
-		while (px_count--) {
-			// NOTE: Not actually accurate, but I don't care about RGB565 ;).
-			*p++ ^= 0xFFFFu;
-		}
-	} else if (vInfo.bits_per_pixel == 32U) {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wcast-align"
-		uint32_t* p = (uint32_t*) fbPtr;
-#pragma GCC diagnostic pop
-		size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
-		while (px_count--) {
-			*p++ ^= 0x00FFFFFFu;
-		}
-	} else {
-		// Byte per byte should do the trick for the other bitdepths
-		uint8_t* p          = fbPtr;
-		size_t   byte_count = (size_t) fInfo.line_length * vInfo.yres;
-		while (byte_count--) {
-			*p++ ^= 0xFFu;
-		}
-	}
+	// NOTE: At 32bpp, xor_span keeps the alpha channel intact.
+	xor_span(fbPtr, fbPtr, (size_t) fInfo.line_length * vInfo.yres, fb_inversion_mask());
 
 	// We'll need a matching region for the refresh...
 	struct mxcfb_rect region = { 0U };
@@ -6525,93 +8233,415 @@ int
 	}
 
 	// Do the thing...
+	const uint32_t mask = fb_inversion_mask();
 	if (full_clear) {
 		// Basically, fbink_invert_screen but without a refresh
-		if (unlikely(vInfo.bits_per_pixel == 16U)) {
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wcast-align"
-			uint16_t* p = (uint16_t*) fbPtr;
-#	pragma GCC diagnostic pop
-			size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
-			while (px_count--) {
-				*p++ ^= 0xFFFFu;
+		xor_span(fbPtr, fbPtr, (size_t) fInfo.line_length * vInfo.yres, mask);
+	} else if (unlikely(vInfo.bits_per_pixel == 4U)) {
+		// Two pixels per byte: handle the odd nibbles on either edge separately, and invert whole bytes in between.
+		const uint32_t right = region.left + region.width;
+		for (size_t j = region.top; j < region.top + region.height; j++) {
+			uint8_t* restrict p     = fbPtr + (fInfo.line_length * j);
+			uint32_t          start = region.left;
+			uint32_t          end   = right;
+			if (start & 0x01u) {
+				// Odd first pixel: low nibble
+				p[start >> 1U] ^= 0x0Fu;
+				start++;
 			}
-		} else if (vInfo.bits_per_pixel == 32U) {
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wcast-align"
-			uint32_t* p = (uint32_t*) fbPtr;
-#	pragma GCC diagnostic pop
-			size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
-			while (px_count--) {
-				*p++ ^= 0x00FFFFFFu;
+			if ((end & 0x01u) && end > start) {
+				// Odd pixel count left: the last one is a high nibble
+				end--;
+				p[end >> 1U] ^= 0xF0u;
 			}
-		} else {
-			// Byte per byte should do the trick for the other bitdepths
-			uint8_t* p          = fbPtr;
-			size_t   byte_count = (size_t) fInfo.line_length * vInfo.yres;
-			while (byte_count--) {
-				*p++ ^= 0xFFu;
+			if (end > start) {
+				xor_span(p + (start >> 1U), p + (start >> 1U), (end - start) >> 1U, mask);
 			}
 		}
 	} else {
-		// Based on their fill_rect counterparts
-		if (unlikely(vInfo.bits_per_pixel == 16U)) {
-			for (size_t j = region.top; j < region.top + region.height; j++) {
-				const size_t scanline_offset = fInfo.line_length * j;
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wcast-align"
-				uint16_t* restrict p = (uint16_t*) (fbPtr + scanline_offset) + region.left;
-#	pragma GCC diagnostic pop
-				size_t px_count = region.width;
+		// Scanline per scanline, much like their fill_rect counterparts
+		const size_t bpp         = vInfo.bits_per_pixel >> 3U;
+		const size_t left_offset = region.left * bpp;
+		const size_t len         = region.width * bpp;
+		for (size_t j = region.top; j < region.top + region.height; j++) {
+			uint8_t* restrict p = fbPtr + (fInfo.line_length * j) + left_offset;
+			xor_span(p, p, len, mask);
+		}
+	}
 
-				while (px_count--) {
-					*p++ ^= 0xFFFFu;
-				}
+	// We don't refresh, but the shadow buffer still needs to know about it
+	if (full_clear) {
+		fullscreen_region(&region);
+	}
+	damage_shadow_fb(&region);
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+#ifdef FBINK_WITH_DRAW
+// Read a single pixel from a 4bpp scanline (the even pixel of each byte lives in the high nibble)
+static inline __attribute__((always_inline)) uint8_t
+    get_nibble(const uint8_t* row, uint32_t x)
+{
+	return (x & 0x01u) ? (uint8_t) (row[x >> 1U] & 0x0Fu) : (uint8_t) (row[x >> 1U] >> 4U);
+}
+
+// Write a single pixel to a 4bpp scanline, leaving its neighbor alone
+static inline __attribute__((always_inline)) void
+    set_nibble(uint8_t* row, uint32_t x, uint8_t v)
+{
+	uint8_t* p = &row[x >> 1U];
+	*p         = (x & 0x01u) ? (uint8_t) ((*p & 0xF0u) | v) : (uint8_t) ((*p & 0x0Fu) | (v << 4U));
+}
+
+// Check that a region (in fb coordinates, i.e., *after* fxpRotateRegion) actually fits in the fb.
+// NOTE: Written that way to catch regions that wrapped around during rotation, too.
+static bool
+    is_region_in_fb(const struct mxcfb_rect* restrict region)
+{
+	return region->width != 0U && region->height != 0U && region->left < vInfo.xres && region->top < vInfo.yres &&
+	       region->width <= vInfo.xres - region->left && region->height <= vInfo.yres - region->top;
+}
+
+// Move a region of the fb to (x, y), both in fb coordinates (i.e., *after* fxpRotateRegion).
+// Source & destination may overlap: scanlines are walked in whichever direction won't clobber the ones we've yet to read,
+// and a scanline that overlaps itself (i.e., on a purely horizontal move) goes through memmove.
+static int
+    move_fb_region(const struct mxcfb_rect* restrict src, uint32_t x, uint32_t y)
+{
+	const bool same_row  = (y == src->top);
+	const bool bottom_up = (y > src->top);
+	// Distinct scanlines never overlap, so those can go through the blit engine
+	const bool stream    = !same_row && blit_wants_stream();
+
+	if (unlikely(vInfo.bits_per_pixel == 4U)) {
+		// If both sides don't share the same nibble alignment, every single pixel has to be shifted by half a byte,
+		// so, go through a scratch scanline for those.
+		uint8_t* scratch = NULL;
+		if ((src->left ^ x) & 0x01u) {
+			scratch = malloc(src->width);
+			if (!scratch) {
+				PFWARN("Error allocating scanline buffer: %m");
+				return ERRCODE(ENOMEM);
 			}
-		} else if (unlikely(vInfo.bits_per_pixel == 4U)) {
-			// I don't particularly care about doing this in a smarter way either...
-			for (uint32_t cy = 0U; cy < region.height; cy++) {
-				for (uint32_t cx = 0U; cx < region.width; cx++) {
-					const FBInkCoordinates coords = {
-						.x = (unsigned short int) (region.left + cx),
-						.y = (unsigned short int) (region.top + cy),
-					};
-					FBInkPixel px = { 0 };
-					get_pixel_Gray4(&coords, &px);
-					px.gray8 ^= 0xFFu;
-					put_pixel_Gray4(&coords, &px);
+		}
+
+		const uint32_t start = src->left;
+		const uint32_t end   = src->left + src->width;
+		// First & last pixel that can be moved as whole bytes (i.e., even pixels)
+		const uint32_t first = (start + 1U) & ~0x01u;
+		const uint32_t last  = end & ~0x01u;
+		for (uint32_t i = 0U; i < src->height; i++) {
+			const uint32_t j = bottom_up ? src->height - 1U - i : i;
+			const uint8_t* s = fbPtr + (fInfo.line_length * (src->top + j));
+			uint8_t*       d = fbPtr + (fInfo.line_length * (y + j));
+
+			if (scratch) {
+				for (uint32_t k = 0U; k < src->width; k++) {
+					scratch[k] = get_nibble(s, start + k);
 				}
+				for (uint32_t k = 0U; k < src->width; k++) {
+					set_nibble(d, x + k, scratch[k]);
+				}
+				continue;
 			}
-		} else if (vInfo.bits_per_pixel == 32U) {
-			for (size_t j = region.top; j < region.top + region.height; j++) {
-				const size_t scanline_offset = fInfo.line_length * j;
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wcast-align"
-				uint32_t* p = (uint32_t*) (fbPtr + scanline_offset) + region.left;
-#	pragma GCC diagnostic pop
-				size_t px_count = region.width;
 
-				while (px_count--) {
-					*p++ ^= 0x00FFFFFFu;
+			// Odd pixels on either edge share their byte with a pixel outside the region, so, grab them first...
+			const uint8_t lead  = (start & 0x01u) ? get_nibble(s, start) : 0U;
+			const uint8_t trail = (end & 0x01u) ? get_nibble(s, end - 1U) : 0U;
+			// ... move the whole bytes in between...
+			if (last > first) {
+				const size_t len = (last - first) >> 1U;
+				uint8_t*     dp  = d + ((x + first - start) >> 1U);
+				if (same_row) {
+					memmove(dp, s + (first >> 1U), len);
+				} else {
+					blit_copy(dp, s + (first >> 1U), len, stream);
 				}
 			}
+			// ... and put the edges back in their new home.
+			if (start & 0x01u) {
+				set_nibble(d, x, lead);
+			}
+			if (end & 0x01u) {
+				set_nibble(d, x + (end - 1U - start), trail);
+			}
+		}
+		blit_fence(stream);
+
+		free(scratch);
+		return EXIT_SUCCESS;
+	}
+
+	// Scanline per scanline, much like their fill_rect counterparts
+	const size_t bpp = vInfo.bits_per_pixel >> 3U;
+	const size_t len = src->width * bpp;
+	for (uint32_t i = 0U; i < src->height; i++) {
+		const uint32_t       j = bottom_up ? src->height - 1U - i : i;
+		const unsigned char* s = fbPtr + (fInfo.line_length * (src->top + j)) + (src->left * bpp);
+		unsigned char*       d = fbPtr + (fInfo.line_length * (y + j)) + (x * bpp);
+		if (same_row) {
+			memmove(d, s, len);
 		} else {
-			// Byte per byte should do the trick for the other bitdepths
-			for (size_t j = region.top; j < region.top + region.height; j++) {
-				// NOTE: Go with a cheap memset32 in order to preserve the alpha value of our input pixel...
-				//       The compiler should be able to turn that into something as fast as a plain memset ;).
-				const size_t scanline_offset = fInfo.line_length * j;
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wcast-align"
-				uint8_t* p = (uint8_t*) (fbPtr + scanline_offset) + region.left;
-#	pragma GCC diagnostic pop
-				size_t px_count = region.width;
+			blit_copy(d, s, len, stream);
+		}
+	}
+	blit_fence(stream);
 
-				while (px_count--) {
-					*p++ ^= 0xFFu;
-				}
+	return EXIT_SUCCESS;
+}
+
+// Rotate & validate both ends of a copy, then move the pixels. dst is set to the rotated destination region.
+static int
+    copy_rect(const FBInkRect* restrict rect, unsigned short int x, unsigned short int y, struct mxcfb_rect* restrict dst)
+{
+	struct mxcfb_rect src = {
+		.top    = rect->top,
+		.left   = rect->left,
+		.width  = rect->width,
+		.height = rect->height,
+	};
+	*dst = (struct mxcfb_rect){
+		.top    = y,
+		.left   = x,
+		.width  = rect->width,
+		.height = rect->height,
+	};
+	(*fxpRotateRegion)(&src);
+	(*fxpRotateRegion)(dst);
+
+	if (!is_region_in_fb(&src) || !is_region_in_fb(dst)) {
+		WARN("Cannot copy a %hux%hu rectangle from (%hu, %hu) to (%hu, %hu): empty or out of bounds",
+		     rect->width,
+		     rect->height,
+		     rect->left,
+		     rect->top,
+		     x,
+		     y);
+		return ERRCODE(EINVAL);
+	}
+
+	return move_fb_region(&src, dst->left, dst->top);
+}
+#endif    // FBINK_WITH_DRAW
+
+// Copies the content of a region of the framebuffer to another spot of the framebuffer.
+// NOTE: Like fbink_invert_rect, this does *not* trigger a refresh.
+int
+    fbink_copy_rect(int fbfd                       UNUSED_BY_NODRAW,
+		    const FBInkRect* restrict rect UNUSED_BY_NODRAW,
+		    unsigned short int x           UNUSED_BY_NODRAW,
+		    unsigned short int y           UNUSED_BY_NODRAW,
+		    bool no_rota                   UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// If we requested to disable rotation tricks, just fudge fxpRotateRegion for the call's duration...
+	void (*actual_region_rotate_fxp)(struct mxcfb_rect* restrict) = fxpRotateRegion;
+	if (no_rota) {
+		fxpRotateRegion = &rotate_region_nop;
+	}
+
+	struct mxcfb_rect region = { 0U };
+	rv                       = copy_rect(rect, x, y, &region);
+
+	if (no_rota) {
+		fxpRotateRegion = actual_region_rotate_fxp;
+	}
+
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+
+	// Remember the destination rect...
+	set_last_rect(&(const struct mxcfb_rect){ .top = y, .left = x, .width = rect->width, .height = rect->height });
+	// We don't refresh, but the shadow buffer still needs to know about it
+	damage_shadow_fb(&region);
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+// Scrolls the content of a region of the framebuffer, without re-rendering any of it.
+int
+    fbink_scroll_rect(int fbfd                              UNUSED_BY_NODRAW,
+		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
+		      const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
+		      short int dx                          UNUSED_BY_NODRAW,
+		      short int dy                          UNUSED_BY_NODRAW,
+		      FBInkRect* restrict exposed           UNUSED_BY_NODRAW,
+		      bool no_rota                          UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	if (dx != 0 && dy != 0) {
+		WARN("Cannot scroll along both axes at once");
+		return ERRCODE(EINVAL);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// If we requested to disable rotation tricks, just fudge fxpRotateRegion for the call's duration...
+	void (*actual_region_rotate_fxp)(struct mxcfb_rect* restrict) = fxpRotateRegion;
+	if (no_rota) {
+		fxpRotateRegion = &rotate_region_nop;
+	}
+
+	struct mxcfb_rect region = {
+		.top    = rect->top,
+		.left   = rect->left,
+		.width  = rect->width,
+		.height = rect->height,
+	};
+	(*fxpRotateRegion)(&region);
+	if (!is_region_in_fb(&region)) {
+		WARN("Cannot scroll a %hux%hu rectangle @ (%hu, %hu): empty or out of bounds",
+		     rect->width,
+		     rect->height,
+		     rect->left,
+		     rect->top);
+		rv = ERRCODE(EINVAL);
+		goto restore_rota;
+	}
+
+	// Split the rect between the part that survives the scroll (src, which moves to x, y),
+	// and the strip it leaves behind (gap).
+	FBInkRect          src   = *rect;
+	FBInkRect          gap   = { 0U };
+	unsigned short int x     = rect->left;
+	unsigned short int y     = rect->top;
+	const unsigned int shift = (unsigned int) abs(dx != 0 ? dx : dy);
+	if (dy != 0) {
+		gap = *rect;
+		if (shift < rect->height) {
+			src.height = (unsigned short int) (rect->height - shift);
+			gap.height = (unsigned short int) shift;
+			if (dy < 0) {
+				src.top = (unsigned short int) (rect->top + shift);
+				gap.top = (unsigned short int) (rect->top + src.height);
+			} else {
+				y = (unsigned short int) (rect->top + shift);
+			}
+		} else {
+			src.height = 0U;
+		}
+	} else if (dx != 0) {
+		gap = *rect;
+		if (shift < rect->width) {
+			src.width = (unsigned short int) (rect->width - shift);
+			gap.width = (unsigned short int) shift;
+			if (dx < 0) {
+				src.left = (unsigned short int) (rect->left + shift);
+				gap.left = (unsigned short int) (rect->left + src.width);
+			} else {
+				x = (unsigned short int) (rect->left + shift);
 			}
+		} else {
+			src.width = 0U;
+		}
+	}
+
+	// Move what's left...
+	if (gap.width != 0U && src.width != 0U && src.height != 0U) {
+		struct mxcfb_rect moved = { 0U };
+		rv                      = copy_rect(&src, x, y, &moved);
+		if (rv != EXIT_SUCCESS) {
+			goto restore_rota;
+		}
+	}
+	// ... and clear what's been exposed.
+	if (gap.width != 0U) {
+		FBInkPixel px = penBGPixel;
+		if (fbink_cfg->is_inverted) {
+			px.p ^= 0x00FFFFFFu;
 		}
+		(*fxpFillRectChecked)(gap.left, gap.top, gap.width, gap.height, &px);
+	}
+	LOG("Scrolled a %hux%hu rectangle @ (%hu, %hu) by (%hd, %hd), exposing %hux%hu @ (%hu, %hu)",
+	    rect->width,
+	    rect->height,
+	    rect->left,
+	    rect->top,
+	    dx,
+	    dy,
+	    gap.width,
+	    gap.height,
+	    gap.left,
+	    gap.top);
+	if (exposed) {
+		*exposed = gap;
+	}
+
+	// Remember the rect...
+	set_last_rect(&(const struct mxcfb_rect){
+	    .top = rect->top, .left = rect->left, .width = rect->width, .height = rect->height });
+
+	// A single refresh for the whole thing
+	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
+		rv = ERRCODE(EXIT_FAILURE);
+	}
+
+restore_rota:
+	if (no_rota) {
+		fxpRotateRegion = actual_region_rotate_fxp;
 	}
 
 	// Cleanup
@@ -6630,6 +8660,50 @@ cleanup:
 #endif
 }
 
+// Computes the pen adjustments shared by every cell of a line (i.e., like fbink_print()'s draw()):
+// returns the subcell offset in pixels, and clamps the h/v offsets to safe values.
+static unsigned short int
+    cell_pen_offsets(bool halfcell_offset,
+		     const FBInkConfig* restrict fbink_cfg,
+		     short int* restrict hoffset,
+		     short int* restrict voffset)
+{
+	// Compute our actual subcell offset in pixels
+	unsigned short int pixel_offset = 0U;
+	// Do we have a centering induced halfcell adjustment to correct?
+	if (halfcell_offset) {
+		pixel_offset = FONTW / 2U;
+		LOG("Incrementing pixel_offset by %hu pixels to account for a halfcell centering tweak", pixel_offset);
+	}
+	// Do we have a permanent adjustment to make because of dead space on the right edge?
+	if (!deviceQuirks.isPerfectFit) {
+		// We correct by half of said dead space, since we want perfect centering ;).
+		unsigned short int deadzone_offset =
+		    (unsigned short int) (viewWidth - (unsigned short int) (MAXCOLS * FONTW)) / 2U;
+		pixel_offset = (unsigned short int) (pixel_offset + deadzone_offset);
+		LOG("Incrementing pixel_offset by %hu pixels to compensate for dead space on the right edge",
+		    deadzone_offset);
+	}
+
+	// Clamp h/v offset to safe values
+	*voffset = fbink_cfg->voffset;
+	*hoffset = fbink_cfg->hoffset;
+	// NOTE: This test isn't perfect, but then, if you play with this, you do it knowing the risks...
+	//       It's mainly there so that stupidly large values don't wrap back on screen because of overflow wraparound.
+	if ((uint32_t) abs(*voffset) >= viewHeight) {
+		LOG("The specified vertical offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
+		    *voffset);
+		*voffset = 0;
+	}
+	if ((uint32_t) abs(*hoffset) >= viewWidth) {
+		LOG("The specified horizontal offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
+		    *hoffset);
+		*hoffset = 0;
+	}
+
+	return pixel_offset;
+}
+
 // Handle cls & refresh, but for grid-based coordinates (i.e., like fbink_print()'s draw())
 static int
     grid_to_region(int                fbfd,
@@ -6765,38 +8839,10 @@ static int
 	}
 
 	// NOTE: And then, the truly insane draw() bits...
-	// Compute our actual subcell offset in pixels
-	unsigned short int pixel_offset = 0U;
-	// Do we have a centering induced halfcell adjustment to correct?
-	if (halfcell_offset) {
-		pixel_offset = FONTW / 2U;
-		LOG("Incrementing pixel_offset by %hu pixels to account for a halfcell centering tweak", pixel_offset);
-	}
-	// Do we have a permanent adjustment to make because of dead space on the right edge?
-	if (!deviceQuirks.isPerfectFit) {
-		// We correct by half of said dead space, since we want perfect centering ;).
-		unsigned short int deadzone_offset =
-		    (unsigned short int) (viewWidth - (unsigned short int) (MAXCOLS * FONTW)) / 2U;
-		pixel_offset = (unsigned short int) (pixel_offset + deadzone_offset);
-		LOG("Incrementing pixel_offset by %hu pixels to compensate for dead space on the right edge",
-		    deadzone_offset);
-	}
-
-	// Clamp h/v offset to safe values
-	short int voffset = fbink_cfg->voffset;
-	short int hoffset = fbink_cfg->hoffset;
-	// NOTE: This test isn't perfect, but then, if you play with this, you do it knowing the risks...
-	//       It's mainly there so that stupidly large values don't wrap back on screen because of overflow wraparound.
-	if ((uint32_t) abs(voffset) >= viewHeight) {
-		LOG("The specified vertical offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
-		    voffset);
-		voffset = 0;
-	}
-	if ((uint32_t) abs(hoffset) >= viewWidth) {
-		LOG("The specified horizontal offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
-		    hoffset);
-		hoffset = 0;
-	}
+	// Compute our actual subcell offset in pixels, and clamp h/v offset to safe values
+	short int                voffset;
+	short int                hoffset;
+	const unsigned short int pixel_offset = cell_pen_offsets(halfcell_offset, fbink_cfg, &hoffset, &voffset);
 
 	// Compute the dimension of the screen region we'll paint to
 	struct mxcfb_rect region = {
@@ -6964,55 +9010,112 @@ static void
 	lastRect.top    = (unsigned short int) region->top;
 	lastRect.width  = (unsigned short int) region->width;
 	lastRect.height = (unsigned short int) region->height;
+
+	// And remember it for fbink_refresh_damage, too
+	record_damage(&lastRect);
 }
 
-// Magic happens here!
-int
-    fbink_print(int fbfd                     UNUSED_BY_NOBITMAP,
-		const char* restrict string  UNUSED_BY_NOBITMAP,
-		const FBInkConfig* fbink_cfg UNUSED_BY_NOBITMAP)
+// Grow dst so that it also covers src
+static void
+    merge_rects(FBInkRect* restrict dst, const FBInkRect* restrict src)
 {
-#ifdef FBINK_WITH_BITMAP
-	// Abort if we were passed an empty string
-	if (!*string) {
-		// Unless we just want a clear, in which case, bypass everything and just do that.
-		if (fbink_cfg->is_cleared) {
-			return fbink_cls(fbfd, fbink_cfg, NULL, false);
-		} else {
-			PFWARN("Cannot print an empty string");
-			return ERRCODE(EINVAL);
+	const uint32_t left   = MIN((uint32_t) dst->left, (uint32_t) src->left);
+	const uint32_t top    = MIN((uint32_t) dst->top, (uint32_t) src->top);
+	const uint32_t right  = MAX((uint32_t) dst->left + dst->width, (uint32_t) src->left + src->width);
+	const uint32_t bottom = MAX((uint32_t) dst->top + dst->height, (uint32_t) src->top + src->height);
+
+	dst->left   = (unsigned short int) left;
+	dst->top    = (unsigned short int) top;
+	dst->width  = (unsigned short int) (right - left);
+	dst->height = (unsigned short int) (bottom - top);
+}
+
+// Append a drawn region to the damage list
+static void
+    record_damage(const FBInkRect* restrict rect)
+{
+	if (rect->width == 0U || rect->height == 0U) {
+		return;
+	}
+
+	// Skip it entirely if it's already covered (common when redrawing the same element over & over)
+	for (uint8_t i = 0U; i < damageCount; i++) {
+		const FBInkRect* d = &damageRects[i];
+		if (rect->left >= d->left && rect->top >= d->top &&
+		    (uint32_t) rect->left + rect->width <= (uint32_t) d->left + d->width &&
+		    (uint32_t) rect->top + rect->height <= (uint32_t) d->top + d->height) {
+			return;
 		}
 	}
 
-	// Abort if we were passed an invalid UTF-8 sequence
-	const size_t len       = strlen(string);    // Flawfinder: ignore
-	const size_t charcount = u8_strlen2(string);
-	if (charcount == 0) {
-		PFWARN("Cannot print an invalid UTF-8 sequence");
-		return ERRCODE(EILSEQ);
+	if (damageCount < DAMAGE_MAX_RECTS) {
+		damageRects[damageCount++] = *rect;
+		return;
 	}
 
-	// If we open a fd now, we'll only keep it open for this single print call!
-	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
+	// We're out of room: merge it with whichever entry grows the least from it.
+	uint8_t  best        = 0U;
+	uint64_t best_growth = UINT64_MAX;
+	for (uint8_t i = 0U; i < damageCount; i++) {
+		FBInkRect merged = damageRects[i];
+		merge_rects(&merged, rect);
+		const uint64_t growth = (uint64_t) merged.width * merged.height -
+					(uint64_t) damageRects[i].width * damageRects[i].height;
+		if (growth < best_growth) {
+			best_growth = growth;
+			best        = i;
+		}
 	}
+	merge_rects(&damageRects[best], rect);
+}
 
-	// Assume success, until shit happens ;)
-	int rv              = EXIT_SUCCESS;
-	// We need to declare this early (& sentinel it to NULL) to make our cleanup jumps safe
-	char* restrict line = NULL;
+#ifndef FBINK_FOR_LINUX
+// Whether two rectangles overlap, or are at most slack pixels apart on both axes
+static bool
+    are_rects_close(const FBInkRect* restrict a, const FBInkRect* restrict b, uint32_t slack)
+{
+	return (uint32_t) a->left <= (uint32_t) b->left + b->width + slack &&
+	       (uint32_t) b->left <= (uint32_t) a->left + a->width + slack &&
+	       (uint32_t) a->top <= (uint32_t) b->top + b->height + slack &&
+	       (uint32_t) b->top <= (uint32_t) a->top + a->height + slack;
+}
 
-	// map fb to user mem
-	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
+// Merge every damage rectangle that overlaps (or is within slack pixels of) another one, until nothing moves anymore.
+// NOTE: This is quadratic (well, cubic, in the worst case), but we're dealing with at most DAMAGE_MAX_RECTS entries,
+//       and that's peanuts compared to the cost of refreshing a larger region than necessary.
+static void
+    coalesce_damage(uint32_t slack)
+{
+	bool merged;
+	do {
+		merged = false;
+		for (uint8_t i = 0U; i < damageCount; i++) {
+			for (uint8_t j = (uint8_t) (i + 1U); j < damageCount;) {
+				if (are_rects_close(&damageRects[i], &damageRects[j], slack)) {
+					merge_rects(&damageRects[i], &damageRects[j]);
+					// Swap-remove j
+					damageRects[j] = damageRects[--damageCount];
+					merged         = true;
+				} else {
+					j++;
+				}
+			}
 		}
-	}
+	} while (merged);
+}
+#endif    // !FBINK_FOR_LINUX
 
+#ifdef FBINK_WITH_BITMAP
+// Lays out string on the cell grid, exactly like fbink_print() would, without touching the fb at all
+// (meaning it only relies on the state computed by fbink_init).
+// The lines themselves are then formatted one by one by next_cell_line.
+static void
+    layout_cells(FBInkCellLayout* restrict layout,
+		 const char* restrict string,
+		 size_t             len,
+		 size_t             charcount,
+		 const FBInkConfig* restrict fbink_cfg)
+{
 	// NOTE: Make copies of these so we don't wreck our original struct, since we passed it by reference,
 	//       and we *will* heavily mangle these two...
 	short int col = fbink_cfg->col;
@@ -7030,19 +9133,6 @@ int
 		LOG("Adjusted row to %hd for vertical centering", row);
 	}
 
-	struct mxcfb_rect  region           = { 0U };
-	// We declare that a bit early, because that'll hold our return value on success.
-	unsigned short int multiline_offset = 0U;
-
-	// Clear screen?
-	if (fbink_cfg->is_cleared) {
-		FBInkPixel bgP = penBGPixel;
-		if (fbink_cfg->is_inverted) {
-			bgP.p ^= 0x00FFFFFFu;
-		}
-		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
-	}
-
 	// See if want to position our text relative to the edge of the screen, and not the beginning
 	if (col < 0) {
 		col = (short int) MAX(MAXCOLS + col, 0);
@@ -7126,69 +9216,98 @@ int
 	}
 	LOG("Final position: column %hd, row %hd", col, row);
 
-	// We'll copy our text in chunks of formatted line...
-	// NOTE: Store that on the heap, we've had some wacky adventures with automatic VLAs...
-	// NOTE: UTF-8 is at most 4 bytes per sequence, make sure we can fit a full line of UTF-8,
-	//       (+ 1 'wide' NULL, wide to make sure u8_strlen won't skip over it).
-	line = calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
-	if (line == NULL) {
-		PFWARN("line calloc: %m");
-		rv = ERRCODE(EXIT_FAILURE);
-		goto cleanup;
-	}
-	// NOTE: This makes sure it's always full of NULLs, to avoid weird shit happening later with u8_strlen()
-	//       and uninitialized or re-used memory...
-	//       Namely, a single NULL immediately followed by something that *might* be interpreted as an UTF-8
-	//       sequence would trip it into counting bogus characters.
-	//       And as snprintf() only NULL-terminates what it expects to be a non-wide string,
-	//       it's not filling the end of the buffer with NULLs, it just outputs a single one!
-	//       That's why we're also using calloc here.
-	//       Plus, the OS will ensure that'll always be smarter than malloc + memset ;).
-	// NOTE: Since we re-use line on each iteration of the loop,
-	//       we do also need to clear it at the end of the loop, in preparation of the next iteration.
-
 	LOG("Need %hu lines to print %zu characters over %hu available columns", lines, charcount, available_cols);
 
-	// Do the initial computation outside the loop,
-	// so we'll be able to re-use line_len to accurately compute chars_left when looping.
 	// NOTE: This is where it gets tricky. With multibyte sequences, 1 byte doesn't necessarily mean 1 char.
 	//       And we need to work both in amount of characters for column/width arithmetic,
 	//       and in bytes for snprintf...
-	size_t chars_left  = charcount;
-	size_t line_len    = 0U;
-	size_t line_bytes  = 0U;
-	size_t line_offset = 0U;
-	// If we have multiple lines worth of stuff to print, draw it line per line
-	while (chars_left > line_len) {
-		LOG("Line %hu (of ~%hu), previous line was %zu characters long and there were %zu characters left to print",
-		    (unsigned short int) (multiline_offset + 1U),
-		    lines,
-		    line_len,
-		    chars_left);
-		// Make sure we don't try to draw off-screen...
-		if (row + multiline_offset >= MAXROWS) {
-			LOG("Can only print %hu lines, discarding the %zu characters left!",
-			    MAXROWS,
-			    chars_left - line_len);
-			// And that's it, we're done.
-			break;
-		}
-
-		// Compute the amount of characters left to print...
-		chars_left -= line_len;
-		// And use it to compute the amount of characters to print on *this* line
-		line_len    = (size_t) MIN(chars_left, available_cols);
-		LOG("Characters to print: %zu out of the %zu remaining ones", line_len, chars_left);
-
-		// NOTE: Now we just have to switch from characters to bytes, both for line_len & chars_left...
-		// First, get the byte offset of this section of our string (i.e., this line)...
-		line_offset       += line_bytes;
-		// ... then compute how many bytes we'll need to store it.
-		line_bytes         = 0U;
-		size_t   cn        = 0U;
-		uint32_t ch        = 0U;
-		bool     caught_lf = false;
-		while ((ch = u8_nextchar2(string + line_offset, &line_bytes)) != 0U) {
+	//       Which is why we keep track of both, and re-use line_len to accurately compute chars_left when looping.
+	*layout = (FBInkCellLayout){
+		.string         = string,
+		// One byte per character means plain ASCII, which makes splitting it into lines trivial
+		.is_ascii       = (len == charcount),
+		.wrapped_line   = wrapped_line,
+		.col            = col,
+		.row            = row,
+		.available_cols = available_cols,
+		.lines          = lines,
+		.chars_left     = charcount,
+	};
+}
+
+// Formats the next line of a layout_cells layout into line (padding, centering, LF & wraparound marker included),
+// and decodes it into codepoints (if non-NULL).
+// Returns the length of the line in characters, or 0 once we're done.
+// On success, layout->col, layout->multiline_offset & layout->halfcell_offset describe where that line goes.
+// NOTE: line must be able to hold (MAXCOLS + 1) * 4 bytes, and MUST start out full of NULLs (c.f., fbink_print),
+//       codepoints must be able to hold MAXCOLS + 1 elements.
+static size_t
+    next_cell_line(FBInkCellLayout* restrict layout,
+		   char* restrict     line,
+		   uint32_t* restrict codepoints,
+		   const FBInkConfig* restrict fbink_cfg)
+{
+	// If we have multiple lines worth of stuff to print, lay it out line per line
+	if (layout->chars_left <= layout->line_len) {
+		return 0U;
+	}
+
+	// NOTE: If we've actually written something for the previous line, clear it,
+	//       to get back a pristine NULL-filled buffer, so u8_nextchar() has zero chance to skip a NULL this time.
+	//       See the comments around the initial calloc() call in fbink_print for more details.
+	if (layout->bytes_printed > 0) {
+		LOG("We have more stuff to print, clearing the line buffer for re-use!");
+		memset(line, 0, (size_t) layout->bytes_printed);
+		layout->bytes_printed = 0;
+	}
+	// The nuclear option is simply to unconditonally zero the *full* buffer ;).
+	//memset(line, 0, ((MAXCOLS + 1U) * 4U) * sizeof(*line));
+
+	// Next line!
+	layout->multiline_offset = layout->printed;
+	LOG("Line %hu (of ~%hu), previous line was %zu characters long and there were %zu characters left to print",
+	    (unsigned short int) (layout->multiline_offset + 1U),
+	    layout->lines,
+	    layout->line_len,
+	    layout->chars_left);
+	// Make sure we don't try to draw off-screen...
+	if (layout->row + layout->multiline_offset >= MAXROWS) {
+		LOG("Can only print %hu lines, discarding the %zu characters left!",
+		    MAXROWS,
+		    layout->chars_left - layout->line_len);
+		// And that's it, we're done.
+		return 0U;
+	}
+
+	// Compute the amount of characters left to print...
+	layout->chars_left -= layout->line_len;
+	// And use it to compute the amount of characters to print on *this* line
+	layout->line_len    = (size_t) MIN(layout->chars_left, layout->available_cols);
+	LOG("Characters to print: %zu out of the %zu remaining ones", layout->line_len, layout->chars_left);
+
+	// NOTE: Now we just have to switch from characters to bytes, both for line_len & chars_left...
+	// First, get the byte offset of this section of our string (i.e., this line)...
+	layout->line_offset += layout->line_bytes;
+	// ... then compute how many bytes we'll need to store it.
+	layout->line_bytes   = 0U;
+	size_t   cn          = 0U;
+	uint32_t ch          = 0U;
+	bool     caught_lf   = false;
+	if (layout->is_ascii) {
+		// Bytes are characters, so we just have to look for a LF (c.f., below for the details)
+		const char* lf = memchr(layout->string + layout->line_offset, 0x0A, layout->line_len);
+		if (lf) {
+			caught_lf = true;
+			LOG("Caught a linefeed!");
+			layout->lines++;
+			const size_t lf_len = (size_t) (lf - (layout->string + layout->line_offset)) + 1U;
+			LOG("Line length was %zu characters, but LF is character number %zu", layout->line_len, lf_len);
+			layout->line_len = lf_len;
+			LOG("Adjusted lines to %hu & line_len to %zu", layout->lines, layout->line_len);
+		}
+		layout->line_bytes = layout->line_len;
+	} else {
+		while ((ch = u8_nextchar2(layout->string + layout->line_offset, &layout->line_bytes)) != 0U) {
 			cn++;
 			// NOTE: Honor linefeeds...
 			//       The main use-case for this is throwing tail'ed logfiles at us and having them
@@ -7206,180 +9325,310 @@ int
 				//       line_len being accurate (for padding & centering), the choice is easy.
 				// Increment lines, because of course we're adding a line,
 				// even if the reflowing changes that'll cause mean we might not end up using it.
-				lines++;
+				layout->lines++;
 				// Don't decrement the byte index, we want to print the LF,
 				// (which we'll replace with a blank space, to account for fonts with a visible LF glyph),
 				// mostly to make padding look nicer,
 				// but also so that line_bytes matches line_len ;).
 				// And finally, as we've explained earlier, trim line_len to where we stopped.
-				LOG("Line length was %zu characters, but LF is character number %zu", line_len, cn);
-				line_len = cn;
+				LOG("Line length was %zu characters, but LF is character number %zu",
+				    layout->line_len,
+				    cn);
+				layout->line_len = cn;
 				// Don't touch line_offset, the beginning of our line has not changed,
 				// only its length was cut short.
-				LOG("Adjusted lines to %hu & line_len to %zu", lines, line_len);
+				LOG("Adjusted lines to %hu & line_len to %zu", layout->lines, layout->line_len);
 				// And of course we break, because that was the whole point of this shenanigan!
 				break;
 			}
 			// We've walked our full line, stop!
-			if (cn >= line_len) {
+			if (cn >= layout->line_len) {
 				break;
 			}
 		}
-		LOG("Line takes up %zu bytes", line_bytes);
-		int bytes_printed = 0;
+	}
+	LOG("Line takes up %zu bytes", layout->line_bytes);
 
-		// Just fudge the column for centering...
-		bool halfcell_offset = false;
-		if (fbink_cfg->is_centered) {
-			col = (short int) ((unsigned short int) (MAXCOLS - line_len) / 2U);
-
-			// NOTE: If the line itself is not a perfect fit, ask draw to start drawing half a cell
-			//       to the right to compensate, in order to achieve perfect centering...
-			//       This piggybacks a bit on the !isPerfectFit compensation done in draw,
-			//       which already does subcell placement ;).
-			if (((unsigned short int) col * 2U) + line_len != MAXCOLS) {
-				LOG("Line is not a perfect fit, fudging centering by one half of a cell to the right");
-				// NOTE: Flag it for correction in draw
-				halfcell_offset = true;
-			}
-			LOG("Adjusted column to %hd for centering", col);
-		}
-
-		// We don't need any padding if the line is already full...
-		// (except when centering is involved, because that implies extra trickery that ensures *some* padding).
-		bool can_be_padded = !!(line_len < available_cols);
-		// When centered & padded, we need to split the padding in two, left & right.
-		if (fbink_cfg->is_centered && (fbink_cfg->is_padded || fbink_cfg->is_rpadded)) {
-			// We always want full padding
-			col = 0;
-
-			// Compute our padding length
-			unsigned short int left_pad  = (unsigned short int) (MAXCOLS - line_len) / 2U;
-			// As for the right padding, we basically just have to print 'til the edge of the screen
-			unsigned short int right_pad = (unsigned short int) (MAXCOLS - line_len - left_pad);
-			// Leave a space for the wraparound marker
-			if (wrapped_line) {
-				// Prefer clipping from the *right* edge
-				if (right_pad > 0U) {
-					right_pad = (unsigned short int) (right_pad - 1U);
-				} else if (left_pad > 0U) {
-					left_pad = (unsigned short int) (left_pad - 1U);
-				}
-				// NOTE: We enforce a MAXCOLS of at least 2 in fbink_init when centering,
-				//       so the earlier available_cols tweaks when centering ensure we'll *always* have at least
-				//       1 byte to clip from one of the padding edge.
-			}
-
-			// Compute the effective right padding value for science!
-			LOG("Total size: %hu + %zu + %hu = %hu",
-			    left_pad,
-			    line_len,
-			    right_pad,
-			    (unsigned short int) (left_pad + line_len + right_pad));
-
-			// NOTE: To recap:
-			//       Copy at most (MAXCOLS * 4) + 1 bytes into line
-			//       (thus ensuring both that its NULL-terminated, and fits a full UTF-8 string)
-			//       Left-pad a blank with spaces for left_pad characters
-			//       Print line_len characters of our string at the correct position for this line
-			//       Right pad a blank with spaces for right_pad characters
-			//           Given that we split this in three sections,
-			//           left-padding would have had a similar effect.
-			bytes_printed = snprintf(line,
+	// Just fudge the column for centering...
+	layout->halfcell_offset = false;
+	if (fbink_cfg->is_centered) {
+		layout->col = (short int) ((unsigned short int) (MAXCOLS - layout->line_len) / 2U);
+
+		// NOTE: If the line itself is not a perfect fit, ask draw to start drawing half a cell
+		//       to the right to compensate, in order to achieve perfect centering...
+		//       This piggybacks a bit on the !isPerfectFit compensation done in draw,
+		//       which already does subcell placement ;).
+		if (((unsigned short int) layout->col * 2U) + layout->line_len != MAXCOLS) {
+			LOG("Line is not a perfect fit, fudging centering by one half of a cell to the right");
+			// NOTE: Flag it for correction in draw
+			layout->halfcell_offset = true;
+		}
+		LOG("Adjusted column to %hd for centering", layout->col);
+	}
+
+	// We don't need any padding if the line is already full...
+	// (except when centering is involved, because that implies extra trickery that ensures *some* padding).
+	bool can_be_padded = !!(layout->line_len < layout->available_cols);
+	// When centered & padded, we need to split the padding in two, left & right.
+	if (fbink_cfg->is_centered && (fbink_cfg->is_padded || fbink_cfg->is_rpadded)) {
+		// We always want full padding
+		layout->col = 0;
+
+		// Compute our padding length
+		unsigned short int left_pad  = (unsigned short int) (MAXCOLS - layout->line_len) / 2U;
+		// As for the right padding, we basically just have to print 'til the edge of the screen
+		unsigned short int right_pad = (unsigned short int) (MAXCOLS - layout->line_len - left_pad);
+		// Leave a space for the wraparound marker
+		if (layout->wrapped_line) {
+			// Prefer clipping from the *right* edge
+			if (right_pad > 0U) {
+				right_pad = (unsigned short int) (right_pad - 1U);
+			} else if (left_pad > 0U) {
+				left_pad = (unsigned short int) (left_pad - 1U);
+			}
+			// NOTE: We enforce a MAXCOLS of at least 2 in fbink_init when centering,
+			//       so the earlier available_cols tweaks when centering ensure we'll *always* have at least
+			//       1 byte to clip from one of the padding edge.
+		}
+
+		// Compute the effective right padding value for science!
+		LOG("Total size: %hu + %zu + %hu = %hu",
+		    left_pad,
+		    layout->line_len,
+		    right_pad,
+		    (unsigned short int) (left_pad + layout->line_len + right_pad));
+
+		// NOTE: To recap:
+		//       Copy at most (MAXCOLS * 4) + 1 bytes into line
+		//       (thus ensuring both that its NULL-terminated, and fits a full UTF-8 string)
+		//       Left-pad a blank with spaces for left_pad characters
+		//       Print line_len characters of our string at the correct position for this line
+		//       Right pad a blank with spaces for right_pad characters
+		//           Given that we split this in three sections,
+		//           left-padding would have had a similar effect.
+		layout->bytes_printed = snprintf(line,
 						 (MAXCOLS * 4U) + 1U,
 						 "%*s%.*s%-*s",
 						 (int) left_pad,
 						 "",
-						 (int) line_bytes,
-						 string + line_offset,
+						 (int) layout->line_bytes,
+						 layout->string + layout->line_offset,
 						 (int) right_pad,
 						 "");
-		} else if (fbink_cfg->is_padded && can_be_padded) {
-			// NOTE: Rely on the field width for padding ;).
-			// Padding character is a space, which is 1 byte, so that's good enough ;).
-			size_t padded_bytes = line_bytes + (size_t) (available_cols - line_len);
-			// Leave a space for the wraparound marker (can_be_padded ensures we *can* clip a byte here)
-			if (wrapped_line) {
-				padded_bytes -= 1U;
-			}
-			// NOTE: Don't touch line_len, because we're *adding* new blank characters,
-			//       we're still printing the exact same amount of characters *from our string*.
-			LOG("Left padded %zu bytes to %zu to cover %hu columns",
-			    line_bytes,
-			    padded_bytes,
-			    available_cols);
-			bytes_printed = snprintf(
-			    line, padded_bytes + 1U, "%*.*s", (int) padded_bytes, (int) line_bytes, string + line_offset);
-		} else if (fbink_cfg->is_rpadded && can_be_padded) {
-			// NOTE: Rely on the field width for padding ;).
-			// Padding character is a space, which is 1 byte, so that's good enough ;).
-			size_t padded_bytes = line_bytes + (size_t) (available_cols - line_len);
-			// Leave a space for the wraparound marker (can_be_padded ensures we *can* clip a byte here)
-			if (wrapped_line) {
-				padded_bytes -= 1U;
-			}
-			// NOTE: Don't touch line_len, because we're *adding* new blank characters,
-			//       we're still printing the exact same amount of characters *from our string*.
-			LOG("Right padded %zu bytes to %zu to cover %hu columns",
-			    line_bytes,
-			    padded_bytes,
-			    available_cols);
-			bytes_printed = snprintf(line,
+	} else if (fbink_cfg->is_padded && can_be_padded) {
+		// NOTE: Rely on the field width for padding ;).
+		// Padding character is a space, which is 1 byte, so that's good enough ;).
+		size_t padded_bytes = layout->line_bytes + (size_t) (layout->available_cols - layout->line_len);
+		// Leave a space for the wraparound marker (can_be_padded ensures we *can* clip a byte here)
+		if (layout->wrapped_line) {
+			padded_bytes -= 1U;
+		}
+		// NOTE: Don't touch line_len, because we're *adding* new blank characters,
+		//       we're still printing the exact same amount of characters *from our string*.
+		LOG("Left padded %zu bytes to %zu to cover %hu columns",
+		    layout->line_bytes,
+		    padded_bytes,
+		    layout->available_cols);
+		layout->bytes_printed = snprintf(line,
+						 padded_bytes + 1U,
+						 "%*.*s",
+						 (int) padded_bytes,
+						 (int) layout->line_bytes,
+						 layout->string + layout->line_offset);
+	} else if (fbink_cfg->is_rpadded && can_be_padded) {
+		// NOTE: Rely on the field width for padding ;).
+		// Padding character is a space, which is 1 byte, so that's good enough ;).
+		size_t padded_bytes = layout->line_bytes + (size_t) (layout->available_cols - layout->line_len);
+		// Leave a space for the wraparound marker (can_be_padded ensures we *can* clip a byte here)
+		if (layout->wrapped_line) {
+			padded_bytes -= 1U;
+		}
+		// NOTE: Don't touch line_len, because we're *adding* new blank characters,
+		//       we're still printing the exact same amount of characters *from our string*.
+		LOG("Right padded %zu bytes to %zu to cover %hu columns",
+		    layout->line_bytes,
+		    padded_bytes,
+		    layout->available_cols);
+		layout->bytes_printed = snprintf(line,
 						 padded_bytes + 1U,
 						 "%-*.*s",
 						 (int) padded_bytes,
-						 (int) line_bytes,
-						 string + line_offset);
+						 (int) layout->line_bytes,
+						 layout->string + layout->line_offset);
+	} else {
+		// NOTE: Enforce precision for safety.
+		layout->bytes_printed = snprintf(line,
+						 layout->line_bytes + 1U,
+						 "%*.*s",
+						 (int) layout->line_bytes,
+						 (int) layout->line_bytes,
+						 layout->string + layout->line_offset);
+	}
+	// NOTE: We don't check for snprintf failure or truncation,
+	//       because I'm fairly confident that truncation is not a risk here...
+	LOG("snprintf wrote %d bytes", layout->bytes_printed);
+
+	// NOTE: If we caught a LF, replace it with a space to make it behave with fonts that have a visible LF glyph...
+	if (caught_lf) {
+		// We can't rely on line_bytes as the exact position of the LF, since padding may have moved it...
+		char* lf = strrchr(line, 0x0A);
+		if (lf) {
+			// LF -> space
+			*lf = 0x20u;
+		}
+	}
+
+	// NOTE: And don't forget our wraparound marker (U+2588, a solid black block).
+	//       We don't need nor even *want* to add it if the line is already full,
+	//       (since the idea is to make it clearer when we're potentially mixing up content from two different lines).
+	//       Plus, that'd bork the region in the following draw call, and potentially risk a buffer overflow anyway.
+	if (layout->wrapped_line && can_be_padded) {
+		LOG("Capping the line with a solid block to make it clearer it has wrapped around...");
+		strcat(line, "\u2588");
+		// NOTE: U+2588 (█) is a multibyte sequence, namely, it takes 3 bytes
+		layout->bytes_printed += 3;
+	}
+
+	layout->printed++;
+	// Decode it once and for all, draw only deals in codepoints
+	if (codepoints) {
+		return u8_decode2(line, codepoints, MAXCOLS + 1U);
+	} else {
+		return u8_strlen2(line);
+	}
+}
+
+// Computes the area covered by the cells of the line next_cell_line just laid out,
+// with the same pen positioning as draw (i.e., honoring subcell centering, h/v offsets & the viewport),
+// clipped to the screen.
+static FBInkRect
+    cell_line_rect(const FBInkCellLayout* restrict layout, size_t charcount, const FBInkConfig* restrict fbink_cfg)
+{
+	short int                voffset;
+	short int                hoffset;
+	const unsigned short int pixel_offset = cell_pen_offsets(layout->halfcell_offset, fbink_cfg, &hoffset, &voffset);
+
+	// Do the maths signed, since h/v offsets can push part of the line off-screen
+	const int x  = (layout->col * FONTW) + pixel_offset + hoffset + viewHoriOrigin;
+	const int y  = ((layout->row + layout->multiline_offset) * FONTH) + voffset + viewVertOrigin;
+	const int x0 = MAX(x, 0);
+	const int y0 = MAX(y, 0);
+	const int x1 = MIN(x + (int) (charcount * FONTW), (int) screenWidth);
+	const int y1 = MIN(y + FONTH, (int) screenHeight);
+
+	FBInkRect rect = { 0U };
+	if (x1 > x0 && y1 > y0) {
+		rect.left   = (unsigned short int) x0;
+		rect.top    = (unsigned short int) y0;
+		rect.width  = (unsigned short int) (x1 - x0);
+		rect.height = (unsigned short int) (y1 - y0);
+	}
+	return rect;
+}
+#endif    // FBINK_WITH_BITMAP
+
+// Magic happens here!
+int
+    fbink_print(int fbfd                     UNUSED_BY_NOBITMAP,
+		const char* restrict string  UNUSED_BY_NOBITMAP,
+		const FBInkConfig* fbink_cfg UNUSED_BY_NOBITMAP)
+{
+#ifdef FBINK_WITH_BITMAP
+	// Abort if we were passed an empty string
+	if (!*string) {
+		// Unless we just want a clear, in which case, bypass everything and just do that.
+		if (fbink_cfg->is_cleared) {
+			return fbink_cls(fbfd, fbink_cfg, NULL, false);
 		} else {
-			// NOTE: Enforce precision for safety.
-			bytes_printed = snprintf(
-			    line, line_bytes + 1U, "%*.*s", (int) line_bytes, (int) line_bytes, string + line_offset);
+			PFWARN("Cannot print an empty string");
+			return ERRCODE(EINVAL);
 		}
-		// NOTE: We don't check for snprintf failure or truncation,
-		//       because I'm fairly confident that truncation is not a risk here...
-		LOG("snprintf wrote %d bytes", bytes_printed);
+	}
 
-		// NOTE: If we caught a LF, replace it with a space to make it behave with fonts that have a visible LF glyph...
-		if (caught_lf) {
-			// We can't rely on line_bytes as the exact position of the LF, since padding may have moved it...
-			char* lf = strrchr(line, 0x0A);
-			if (lf) {
-				// LF -> space
-				*lf = 0x20u;
-			}
+	// Abort if we were passed an invalid UTF-8 sequence
+	const size_t len       = strlen(string);    // Flawfinder: ignore
+	const size_t charcount = u8_strlen2(string);
+	if (charcount == 0) {
+		PFWARN("Cannot print an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single print call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv              = EXIT_SUCCESS;
+	// We need to declare these early (& sentinel them to NULL) to make our cleanup jumps safe
+	char* restrict     line       = NULL;
+	uint32_t* restrict codepoints = NULL;
+
+	// map fb to user mem
+	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
 		}
+	}
+
+	struct mxcfb_rect region = { 0U };
+	FBInkCellLayout   layout;
 
-		// NOTE: And don't forget our wraparound marker (U+2588, a solid black block).
-		//       We don't need nor even *want* to add it if the line is already full,
-		//       (since the idea is to make it clearer when we're potentially mixing up content from two different lines).
-		//       Plus, that'd bork the region in the following draw call, and potentially risk a buffer overflow anyway.
-		if (wrapped_line && can_be_padded) {
-			LOG("Capping the line with a solid block to make it clearer it has wrapped around...");
-			strcat(line, "\u2588");
-			// NOTE: U+2588 (█) is a multibyte sequence, namely, it takes 3 bytes
-			bytes_printed += 3;
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		FBInkPixel bgP = penBGPixel;
+		if (fbink_cfg->is_inverted) {
+			bgP.p ^= 0x00FFFFFFu;
 		}
+		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
+	}
 
-		region = draw(line,
-			      (unsigned short int) row,
-			      (unsigned short int) col,
-			      multiline_offset,
-			      halfcell_offset,
-			      fbink_cfg);
+	// Figure out where everything goes...
+	layout_cells(&layout, string, len, charcount, fbink_cfg);
 
-		// Next line!
-		multiline_offset++;
+	// We'll copy our text in chunks of formatted line...
+	// NOTE: Store that on the heap, we've had some wacky adventures with automatic VLAs...
+	// NOTE: UTF-8 is at most 4 bytes per sequence, make sure we can fit a full line of UTF-8,
+	//       (+ 1 'wide' NULL, wide to make sure u8_strlen won't skip over it).
+	line = calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
+	if (line == NULL) {
+		PFWARN("line calloc: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	// NOTE: This makes sure it's always full of NULLs, to avoid weird shit happening later with u8_strlen()
+	//       and uninitialized or re-used memory...
+	//       Namely, a single NULL immediately followed by something that *might* be interpreted as an UTF-8
+	//       sequence would trip it into counting bogus characters.
+	//       And as snprintf() only NULL-terminates what it expects to be a non-wide string,
+	//       it's not filling the end of the buffer with NULLs, it just outputs a single one!
+	//       That's why we're also using calloc here.
+	//       Plus, the OS will ensure that'll always be smarter than malloc + memset ;).
+	// NOTE: Since we re-use line for each line, next_cell_line also needs to clear it before formatting the next one.
+	// NOTE: And each line is then decoded to codepoints in there, so that draw doesn't have to deal with UTF-8 at all.
+	//       Even after padding, a line can't be longer than MAXCOLS characters, but one spare doesn't hurt.
+	codepoints = calloc(MAXCOLS + 1U, sizeof(*codepoints));
+	if (codepoints == NULL) {
+		PFWARN("codepoints calloc: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
 
-		// NOTE: If we've actually written something, and we're not the final line,
-		//       clear what we've just written, to get back a pristine NULL-filled buffer,
-		//       so u8_nextchar() has zero chance to skip a NULL on the next iteration.
-		//       See the comments around the initial calloc() call for more details.
-		if (bytes_printed > 0 && line_len < chars_left) {
-			LOG("We have more stuff to print, clearing the line buffer for re-use!");
-			memset(line, 0, (size_t) bytes_printed);
-		}
-		// The nuclear option is simply to unconditonally zero the *full* buffer ;).
-		//memset(line, 0, ((MAXCOLS + 1U) * 4U) * sizeof(*line));
+	// ... and then draw it line per line
+	size_t line_chars;
+	while ((line_chars = next_cell_line(&layout, line, codepoints, fbink_cfg)) > 0U) {
+		region = draw(line,
+			      codepoints,
+			      line_chars,
+			      (unsigned short int) layout.row,
+			      (unsigned short int) layout.col,
+			      layout.multiline_offset,
+			      layout.halfcell_offset,
+			      fbink_cfg);
 	}
 
 	// Handle the last rect stuff...
@@ -7401,11 +9650,12 @@ int
 	}
 
 	// On success, we return the total amount of lines we occupied on screen
-	rv = (int) multiline_offset;
+	rv = (int) layout.printed;
 
 	// Cleanup
 cleanup:
 	free(line);
+	free(codepoints);
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -7420,6 +9670,54 @@ cleanup:
 #endif    // FBINK_WITH_BITMAP
 }
 
+// Run fbink_print's layout logic, without printing anything
+int
+    fbink_measure_text(const char* restrict string  UNUSED_BY_NOBITMAP,
+		       const FBInkConfig* fbink_cfg UNUSED_BY_NOBITMAP,
+		       FBInkRect* restrict rects    UNUSED_BY_NOBITMAP,
+		       size_t max_rects             UNUSED_BY_NOBITMAP)
+{
+#ifdef FBINK_WITH_BITMAP
+	// Same early aborts as fbink_print
+	if (!*string) {
+		PFWARN("Cannot measure an empty string");
+		return ERRCODE(EINVAL);
+	}
+
+	const size_t len       = strlen(string);    // Flawfinder: ignore
+	const size_t charcount = u8_strlen2(string);
+	if (charcount == 0) {
+		PFWARN("Cannot measure an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+
+	FBInkCellLayout layout;
+	layout_cells(&layout, string, len, charcount, fbink_cfg);
+
+	// c.f., fbink_print for the details regarding line's size & why it needs to be NULL-filled.
+	// NOTE: We only need the length of each line, so we can skip decoding them to codepoints.
+	char* restrict line = calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
+	if (line == NULL) {
+		PFWARN("line calloc: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	size_t line_chars;
+	while ((line_chars = next_cell_line(&layout, line, NULL, fbink_cfg)) > 0U) {
+		if (rects && layout.multiline_offset < max_rects) {
+			rects[layout.multiline_offset] = cell_line_rect(&layout, line_chars, fbink_cfg);
+		}
+	}
+	free(line);
+
+	// Like fbink_print, return the total amount of lines we'd occupy on screen
+	return (int) layout.printed;
+#else
+	WARN("Fixed cell font support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_BITMAP
+}
+
 #ifdef FBINK_WITH_OPENTYPE
 // An extremely rudimentry "markdown" parser. It would probably be wise to cook up something better at some point...
 // (c.f., https://github.com/commonmark/commonmark-spec/wiki/List-of-CommonMark-Implementations for inspiration ^^)
@@ -7570,73 +9868,25 @@ cleanup:
 	return rv;
 }
 
-int
-    fbink_print_ot(int fbfd                              UNUSED_BY_MINIMAL,
-		   const char* restrict string           UNUSED_BY_MINIMAL,
-		   const FBInkOTConfig* restrict cfg     UNUSED_BY_MINIMAL,
-		   const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
-		   FBInkOTFit* restrict fit              UNUSED_BY_MINIMAL)
-{
 #ifdef FBINK_WITH_OPENTYPE
-	// Abort if we were passed an empty string
-	if (!*string) {
-		// Unless we just want a clear, in which case, bypass everything and just do that.
-		if (fbink_cfg->is_cleared) {
-			return fbink_cls(fbfd, fbink_cfg, NULL, false);
-		} else {
-			PFWARN("Cannot print an empty string");
-			return ERRCODE(EINVAL);
-		}
-	}
-
-	// Abort if we were passed an invalid UTF-8 sequence
-	const size_t str_len_bytes = strlen(string);    // Flawfinder: ignore
-	if (!u8_isvalid2(string)) {
-		PFWARN("Cannot print an invalid UTF-8 sequence");
-		return ERRCODE(EILSEQ);
-	}
-
-	// Has fbink_add_ot_font() been successfully called yet?
-	if (!otInit) {
-		WARN("No fonts have been loaded");
-		return ERRCODE(ENODATA);
-	}
-
-	// Just in case we receive a NULL pointer to the cfg struct
-	if (!cfg) {
-		WARN("FBInkOTConfig expected. Got NULL pointer instead");
-		return ERRCODE(EXIT_FAILURE);
-	}
-
-	// If we open a fd now, we'll only keep it open for this single print call!
-	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
-	}
-
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
-
-	// Declare buffers early to make cleanup easier
-	FBInkOTLine* restrict lines        = NULL;
-	char* restrict brk_buff            = NULL;
-	unsigned char* restrict fmt_buff   = NULL;
-	unsigned char* restrict line_buff  = NULL;
-	unsigned char* restrict glyph_buff = NULL;
-	// This also needs to be declared early, as we refresh on cleanup.
-	struct mxcfb_rect region           = { 0U };
-	bool              is_flashing      = false;
-	bool              is_cleared       = false;
-
-	// map fb to user mem
-	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
-	}
+// Lay out a string for fbink_print_ot & fbink_ot_layout_new: resolve fonts & metrics, find our lines,
+// and shape every glyph in them, so that ot_render has nothing left to do but paint.
+// NOTE: layout must be zero-initialized. On failure, it may still hold a few buffers: release it via ot_layout_release.
+static int
+    ot_layout(const char* restrict          string,
+	      const FBInkOTConfig* restrict cfg,
+	      FBInkOTFit* restrict          fit,
+	      FBInkOTLayout* restrict       layout)
+{
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// Declare buffers early to make cleanup easier
+	const size_t str_len_bytes       = strlen(string);    // Flawfinder: ignore
+	FBInkOTLine* restrict lines      = NULL;
+	char* restrict brk_buff          = NULL;
+	unsigned char* restrict fmt_buff = NULL;
+	FBInkOTRun* restrict runs        = NULL;
 
 	// Make sure we return accurate data in case the fit struct is being recycled...
 	if (unlikely(fit)) {
@@ -7645,8 +9895,6 @@ int
 		fit->truncated      = false;
 	}
 
-	LOG("Printing OpenType text.");
-
 	// Handle negative margins (meaning count backwards from the opposite edge)
 	// NOTE: Obviously makes more sense for top & left than for bottom & right.
 	unsigned short int top_margin = 0U;
@@ -7722,7 +9970,7 @@ int
 	}
 
 	// This is a pointer to whichever font is currently active. It gets updated for every character in the loop, as needed.
-	stbtt_fontinfo* restrict curr_font = NULL;
+	FBInkOTFace* restrict curr_font = NULL;
 
 	int max_row_height = 0;
 	// Calculate some metrics for every font we have loaded.
@@ -7754,8 +10002,8 @@ int
 	}
 
 	if (ot_fonts->otRegular) {
-		rgSF = stbtt_ScaleForPixelHeight(ot_fonts->otRegular, (float) font_size_px);
-		stbtt_GetFontVMetrics(ot_fonts->otRegular, &asc, &desc, &lg);
+		rgSF = stbtt_ScaleForPixelHeight(&ot_fonts->otRegular->info, (float) font_size_px);
+		stbtt_GetFontVMetrics(&ot_fonts->otRegular->info, &asc, &desc, &lg);
 		scaled_bl   = iceilf(rgSF * (float) asc);
 		scaled_desc = iceilf(rgSF * (float) desc);
 		scaled_lg   = iceilf(rgSF * (float) lg);
@@ -7770,8 +10018,8 @@ int
 		}
 	}
 	if (ot_fonts->otItalic) {
-		itSF = stbtt_ScaleForPixelHeight(ot_fonts->otItalic, (float) font_size_px);
-		stbtt_GetFontVMetrics(ot_fonts->otItalic, &asc, &desc, &lg);
+		itSF = stbtt_ScaleForPixelHeight(&ot_fonts->otItalic->info, (float) font_size_px);
+		stbtt_GetFontVMetrics(&ot_fonts->otItalic->info, &asc, &desc, &lg);
 		scaled_bl   = iceilf(itSF * (float) asc);
 		scaled_desc = iceilf(itSF * (float) desc);
 		scaled_lg   = iceilf(itSF * (float) lg);
@@ -7786,8 +10034,8 @@ int
 		}
 	}
 	if (ot_fonts->otBold) {
-		bdSF = stbtt_ScaleForPixelHeight(ot_fonts->otBold, (float) font_size_px);
-		stbtt_GetFontVMetrics(ot_fonts->otBold, &asc, &desc, &lg);
+		bdSF = stbtt_ScaleForPixelHeight(&ot_fonts->otBold->info, (float) font_size_px);
+		stbtt_GetFontVMetrics(&ot_fonts->otBold->info, &asc, &desc, &lg);
 		scaled_bl   = iceilf(bdSF * (float) asc);
 		scaled_desc = iceilf(bdSF * (float) desc);
 		scaled_lg   = iceilf(bdSF * (float) lg);
@@ -7802,8 +10050,8 @@ int
 		}
 	}
 	if (ot_fonts->otBoldItalic) {
-		bditSF = stbtt_ScaleForPixelHeight(ot_fonts->otBoldItalic, (float) font_size_px);
-		stbtt_GetFontVMetrics(ot_fonts->otBoldItalic, &asc, &desc, &lg);
+		bditSF = stbtt_ScaleForPixelHeight(&ot_fonts->otBoldItalic->info, (float) font_size_px);
+		stbtt_GetFontVMetrics(&ot_fonts->otBoldItalic->info, &asc, &desc, &lg);
 		scaled_bl   = iceilf(bditSF * (float) asc);
 		scaled_desc = iceilf(bditSF * (float) desc);
 		scaled_lg   = iceilf(bditSF * (float) lg);
@@ -7899,22 +10147,27 @@ int
 		parse_simple_md(string, str_len_bytes, fmt_buff);
 		LOG("Finished parsing formatting markup");
 	}
+	// Where we'll remember the metrics of every character we lay out, so we don't have to query them again to render it.
+	runs = calloc(str_len_bytes, sizeof(*runs));
+	if (!runs) {
+		PFWARN("Glyph runs buffer could not be allocated: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
 	// Lets find our lines! Nothing fancy, just a simple first fit algorithm, but we do our best not to break inside a word.
 
 	size_t             c_index     = 0U;
 	size_t             tmp_c_index = c_index;
 	uint32_t           c;
-	int                gi;
+	FBInkOTRun*        run    = NULL;
 	unsigned short int max_lw = (unsigned short int) (area.br.x - area.tl.x);
 	unsigned int       line;
 	int                max_line_height = max_row_height - max_lg;
-	// adv = advance: the horizontal distance along the baseline to the origin of the next glyph
-	// lsb = left side bearing: The horizontal distance from the origin point to left edge of the glyph
-	// NOTE: We're not doing anything with lsb, we're honoring stbtt_GetGlyphBitmapBox's x0 instead.
+	// NOTE: We're not doing anything with the left side bearing, we're honoring stbtt_GetGlyphBitmapBox's x0 instead.
 	//       Rounding method aside, they should roughly match.
-	int                adv, lsb, curr_x;
+	int                curr_x;
 	bool               complete_str = false;
-	int                x0, y0, x1, y1, gw, gh, cx, cy;
+	int                x0, y0, x1, y1, gw, cx;
 	unsigned int       lw = 0U;
 	for (line = 0U; line < num_lines; line++) {
 		// Every line has a start character index and an end char index.
@@ -7981,14 +10234,17 @@ int
 				// And we're done processing this line
 				break;
 			}
-			c  = u8_nextchar2(string, &c_index);
-			// Get the glyph index now, instead of having to look it up each time
-			gi = stbtt_FindGlyphIndex(curr_font, (int) c);
-			// Note, these metrics are unscaled,
-			// we need to use our previously obtained scale factor (sf) to get the metrics as pixels
-			stbtt_GetGlyphHMetrics(curr_font, gi, &adv, &lsb);
-			// But these are already scaled
-			stbtt_GetGlyphBitmapBox(curr_font, gi, sf, sf, &x0, &y0, &x1, &y1);
+			run = &runs[c_index];
+			c   = u8_nextchar2(string, &c_index);
+			// Shape it, unless we already did (e.g., when backtracking to a break opportunity),
+			// so we don't have to look anything up again in the render pass.
+			if (!run->is_shaped) {
+				shape_ot_glyph(run, curr_font, sf, c, string, c_index, str_len_bytes);
+			}
+			x0 = run->x0;
+			y0 = run->y0;
+			x1 = run->x1;
+			y1 = run->y1;
 			gw = x1 - x0;
 			// Ensure that curr_x never goes negative
 			cx = curr_x;
@@ -8080,15 +10336,8 @@ int
 					break;
 				}
 			}
-			curr_x += iroundf(sf * (float) adv);
-			// Adjust our x position for kerning, because we can (assuming there's a next char, of course) :)
-			if (c_index < str_len_bytes) {
-				tmp_c_index   = c_index;
-				uint32_t c2   = u8_nextchar2(string, &tmp_c_index);
-				int      g2i  = stbtt_FindGlyphIndex(curr_font, (int) c2);
-				int      xadv = stbtt_GetGlyphKernAdvance(curr_font, gi, g2i);
-				curr_x       += iroundf(sf * (float) xadv);
-			}
+			// Adjust our x position for kerning, too, because we can (it's 0 when there's no next char) :)
+			curr_x += run->adv + run->kern;
 		}
 		// Remember the widest line
 		if (unlikely(fit)) {
@@ -8154,13 +10403,124 @@ int
 		goto cleanup;
 	}
 
-	// If we only asked for a computation pass, abort now (successfully).
-	if (unlikely(cfg->compute_only)) {
-		LOG("Requested early abort after computation pass");
-		rv = EXIT_SUCCESS;
-		goto cleanup;
+
+	// We're good to go! Keep track of everything ot_render will need.
+	layout->string            = string;
+	layout->str_len_bytes     = str_len_bytes;
+	layout->num_lines         = num_lines;
+	layout->computed_lines    = computed_lines_amount;
+	layout->fonts             = *ot_fonts;
+	// NOTE: For unformatted text, that's still the default style, and formatted text switches fonts for every character.
+	layout->font              = curr_font;
+	layout->sf                = sf;
+	layout->rgSF              = rgSF;
+	layout->itSF              = itSF;
+	layout->bdSF              = bdSF;
+	layout->bditSF            = bditSF;
+	layout->tl                = area.tl;
+	layout->br                = area.br;
+	layout->print_height      = print_height;
+	layout->curr_print_height = curr_print_height;
+	layout->max_line_height   = max_line_height;
+	layout->max_baseline      = max_baseline;
+	layout->max_lw            = max_lw;
+	layout->font_size_px      = font_size_px;
+	layout->padding           = cfg->padding;
+	layout->is_formatted      = cfg->is_formatted;
+	layout->is_centered       = cfg->is_centered;
+	layout->no_truncation     = cfg->no_truncation;
+
+	// Make sure our fonts outlive us, even if they're released or replaced in the meantime
+	const FBInkOTFonts* fonts   = &layout->fonts;
+	FBInkOTFace*        faces[] = { fonts->otRegular, fonts->otItalic, fonts->otBold, fonts->otBoldItalic };
+	for (size_t i = 0U; i < sizeof(faces) / sizeof(*faces); i++) {
+		if (faces[i]) {
+			faces[i]->refs++;
+		}
 	}
 
+cleanup:
+	// The line & glyph metadata is ours to release now
+	layout->lines    = lines;
+	layout->fmt_buff = fmt_buff;
+	layout->runs     = runs;
+	free(brk_buff);
+	return rv;
+}
+
+// Release everything ot_layout left in layout (but not layout itself)
+static void
+    ot_layout_release(FBInkOTLayout* restrict layout)
+{
+	free(layout->lines);
+	free(layout->fmt_buff);
+	free(layout->runs);
+	free_ot_font(&layout->fonts.otRegular);
+	free_ot_font(&layout->fonts.otItalic);
+	free_ot_font(&layout->fonts.otBold);
+	free_ot_font(&layout->fonts.otBoldItalic);
+	layout->lines    = NULL;
+	layout->fmt_buff = NULL;
+	layout->runs     = NULL;
+}
+
+// Paint a layout (c.f., ot_layout), with the top-left corner of its drawing area @ origin (in fb coordinates).
+// The caller is responsible for making sure that the full drawing area fits on screen,
+// and for refreshing region (which is left empty if nothing was drawn).
+static int
+    ot_render(int                           fbfd,
+	      const FBInkOTLayout* restrict layout,
+	      FBInkCoordinates              origin,
+	      const FBInkConfig* restrict   fbink_cfg,
+	      FBInkOTFit* restrict          fit,
+	      struct mxcfb_rect* restrict   out_region)
+{
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// Declare buffers early to make cleanup easier
+	unsigned char* restrict line_buff   = NULL;
+	unsigned char* restrict glyph_buff  = NULL;
+	struct mxcfb_rect       region      = { 0U };
+	bool                    is_flashing = false;
+	bool                    is_cleared  = false;
+
+	// Unpack the layout
+	const char* restrict          string                = layout->string;
+	const size_t                  str_len_bytes         = layout->str_len_bytes;
+	const FBInkOTLine* restrict   lines                 = layout->lines;
+	const unsigned char* restrict fmt_buff              = layout->fmt_buff;
+	FBInkOTRun* restrict          runs                  = layout->runs;
+	const unsigned int            num_lines             = layout->num_lines;
+	const unsigned int            computed_lines_amount = layout->computed_lines;
+	const unsigned int            print_height          = layout->print_height;
+	const unsigned int            curr_print_height     = layout->curr_print_height;
+	const int                     max_line_height       = layout->max_line_height;
+	const int                     max_baseline          = layout->max_baseline;
+	const unsigned short int      max_lw                = layout->max_lw;
+	const unsigned short int      font_size_px          = layout->font_size_px;
+	FBInkOTFace* restrict         curr_font             = layout->font;
+	float                         sf                    = layout->sf;
+
+	// Move the drawing area to origin
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wmissing-braces"
+	struct
+	{
+		FBInkCoordinates tl;
+		FBInkCoordinates br;
+	} area = { 0U };
+#	pragma GCC diagnostic pop
+	area.tl   = origin;
+	area.br.x = (unsigned short int) (origin.x + (layout->br.x - layout->tl.x));
+	area.br.y = (unsigned short int) (origin.y + (layout->br.y - layout->tl.y));
+
+	unsigned int line;
+	unsigned int lw = 0U;
+	uint32_t     c;
+	FBInkOTRun*  run = NULL;
+	int          x0, y0, x1, y1, gw, gh, cx, cy;
+
 	// Let's get some rendering options from FBInkConfig
 	uint8_t valign      = NONE;
 	uint8_t halign      = NONE;
@@ -8182,7 +10542,7 @@ int
 		is_centered = fbink_cfg->is_centered;
 		is_halfway  = fbink_cfg->is_halfway;
 	} else {
-		is_centered = cfg->is_centered;
+		is_centered = layout->is_centered;
 	}
 
 	// Hopefully, we have some lines to render!
@@ -8238,11 +10598,11 @@ int
 	}
 
 	// Handle padding related region tweaks
-	if (cfg->padding == HORI_PADDING) {
+	if (layout->padding == HORI_PADDING) {
 		region.left = area.tl.x;
-	} else if (cfg->padding == VERT_PADDING) {
+	} else if (layout->padding == VERT_PADDING) {
 		region.top = area.tl.y;
-	} else if (cfg->padding == FULL_PADDING) {
+	} else if (layout->padding == FULL_PADDING) {
 		region.left = area.tl.x;
 		region.top  = area.tl.y;
 		// That's easy enough, simply fill the drawing area with the bg color before rendering anything
@@ -8255,11 +10615,10 @@ int
 		}
 	}
 
-	uint32_t tmp_c;
-	int      tmp_gi;
-	unsigned char* restrict lnPtr = NULL;
-	unsigned char* restrict glPtr = NULL;
-	unsigned short int start_x    = area.tl.x;
+	FBInkOTGlyph* glyph                 = NULL;
+	unsigned char* restrict lnPtr       = NULL;
+	const unsigned char* restrict glPtr = NULL;
+	unsigned short int start_x          = area.tl.x;
 
 	bool abort_line = false;
 	// Render!
@@ -8274,36 +10633,42 @@ int
 		lw        = 0U;
 		size_t ci = lines[line].startCharIndex;
 		while (ci <= lines[line].endCharIndex) {
-			if (cfg->is_formatted) {
+			if (layout->is_formatted) {
 				if (fmt_buff[ci] == CH_IGNORE) {
 					u8_inc(string, &ci);
 					continue;
 				} else {
 					switch (fmt_buff[ci]) {
 						case CH_REGULAR:
-							curr_font = ot_fonts->otRegular;
-							sf        = rgSF;
+							curr_font = layout->fonts.otRegular;
+							sf        = layout->rgSF;
 							break;
 						case CH_ITALIC:
-							curr_font = ot_fonts->otItalic;
-							sf        = itSF;
+							curr_font = layout->fonts.otItalic;
+							sf        = layout->itSF;
 							break;
 						case CH_BOLD:
-							curr_font = ot_fonts->otBold;
-							sf        = bdSF;
+							curr_font = layout->fonts.otBold;
+							sf        = layout->bdSF;
 							break;
 						case CH_BOLD_ITALIC:
-							curr_font = ot_fonts->otBoldItalic;
-							sf        = bditSF;
+							curr_font = layout->fonts.otBoldItalic;
+							sf        = layout->bditSF;
 							break;
 					}
 				}
 			}
 			curr_point.y = ins_point.y = (unsigned short int) max_baseline;
+			run                        = &runs[ci];
 			c                          = u8_nextchar2(string, &ci);
-			gi                         = stbtt_FindGlyphIndex(curr_font, (int) c);
-			stbtt_GetGlyphHMetrics(curr_font, gi, &adv, &lsb);
-			stbtt_GetGlyphBitmapBox(curr_font, gi, sf, sf, &x0, &y0, &x1, &y1);
+			// NOTE: The layout pass should have shaped everything we print, but better be safe than sorry...
+			if (!run->is_shaped) {
+				shape_ot_glyph(run, curr_font, sf, c, string, ci, str_len_bytes);
+			}
+			x0 = run->x0;
+			y0 = run->y0;
+			x1 = run->x1;
+			y1 = run->y1;
 			gw = x1 - x0;
 			gh = y1 - y0;
 			// Ensure that our glyph size does not exceed the buffer size. Resize the buffer if it does
@@ -8395,17 +10760,23 @@ int
 				goto cleanup;
 			}
 			if (gw != 0 && fgcolor != bgcolor) {
-				// Because the stbtt_MakeGlyphBitmap documentation is a bit vague on this point,
-				// the parameter 'out_stride' should be the width of the surface in our buffer.
-				// It's designed so that the glyph can be rendered directly to a screen buffer.
-				// For example, if we were rendering directly to a 1080x1440 screen,
-				// out_stride should be set to 1080.
-				// In this case however, we want to render to a 'box' of the dimensions of the glyph,
-				// so we set 'out_stride' to the glyph width.
-				stbtt_MakeGlyphBitmap(curr_font, glyph_buff, gw, gh, gw, sf, sf, gi);
+				// Reuse the coverage mask from the glyph cache if we can.
+				// NOTE: If the glyph was clipped, we only use its first gh rows, just like stbtt would.
+				glyph = ot_cache_fetch(&curr_font->info, sf, run->gi);
+				glPtr = glyph ? ot_cache_bitmap(glyph) : NULL;
+				if (!glPtr) {
+					// Because the stbtt_MakeGlyphBitmap documentation is a bit vague on this point,
+					// the parameter 'out_stride' should be the width of the surface in our buffer.
+					// It's designed so that the glyph can be rendered directly to a screen buffer.
+					// For example, if we were rendering directly to a 1080x1440 screen,
+					// out_stride should be set to 1080.
+					// In this case however, we want to render to a 'box' of the dimensions of the glyph,
+					// so we set 'out_stride' to the glyph width.
+					stbtt_MakeGlyphBitmap(&curr_font->info, glyph_buff, gw, gh, gw, sf, sf, run->gi);
+					glPtr = glyph_buff;
+				}
 				// paint our glyph into the line buffer
 				lnPtr = line_buff + ins_point.x + (max_lw * ins_point.y);
-				glPtr = glyph_buff;
 				// NOTE: We keep storing it as an alpha coverage mask, we'll blend it in the final rendering stage
 				for (int j = 0; j < gh; j++) {
 					for (int k = 0; k < gw; k++) {
@@ -8429,14 +10800,8 @@ int
 					lnPtr += max_lw;
 				}
 			}
-			curr_point.x = (unsigned short int) (curr_point.x + iroundf(sf * (float) adv));
-			if (ci < str_len_bytes) {
-				size_t tmp_i = ci;
-				tmp_c        = u8_nextchar2(string, &tmp_i);
-				tmp_gi       = stbtt_FindGlyphIndex(curr_font, (int) tmp_c);
-				int xadv     = stbtt_GetGlyphKernAdvance(curr_font, gi, tmp_gi);
-				curr_point.x = (unsigned short int) (curr_point.x + iroundf(sf * (float) xadv));
-			}
+			curr_point.x = (unsigned short int) (curr_point.x + run->adv);
+			curr_point.x = (unsigned short int) (curr_point.x + run->kern);
 		}
 		curr_point.x = 0U;
 		// Right, we've rendered a line to a bitmap, time to display it.
@@ -8456,7 +10821,7 @@ int
 			region.width = lw;
 		}
 		// Handle padding...
-		if (cfg->padding == HORI_PADDING) {
+		if (layout->padding == HORI_PADDING) {
 			region.left  = area.tl.x;
 			region.width = max_lw;
 			// Unless we're in a backgroundless drawing mode, draw the padding rectangles...
@@ -8475,7 +10840,7 @@ int
 					       (unsigned short int) max_line_height,
 					       &bgP);
 			}
-		} else if (cfg->padding == VERT_PADDING) {
+		} else if (layout->padding == VERT_PADDING) {
 			region.top    = area.tl.y;
 			region.height = print_height;
 			if (!is_overlay && !is_bgless) {
@@ -8488,255 +10853,43 @@ int
 						       &bgP);
 				}
 			}
-		} else if (cfg->padding == FULL_PADDING) {
+		} else if (layout->padding == FULL_PADDING) {
 			region.left   = area.tl.x;
 			region.top    = area.tl.y;
 			region.width  = max_lw;
 			region.height = print_height;
 		}
 
-		FBInkPixel pixel;
-		pixel.bgra.color.a = 0xFFu;
-		start_x            = paint_point.x;
-		lnPtr              = line_buff;
-		// Normal painting to framebuffer. Please forgive the code repetition. Performance...
-		// What we get from stbtt is an alpha coverage mask, hence the need for alpha-blending for anti-aliasing.
-		// As it's obviously expensive, we try to avoid it if possible (on fully opaque & fully transparent pixels).
-		if (!is_overlay && !is_fgless && !is_bgless) {
-			if (abs(layer_diff) == 0xFFu) {
-				// If we're painting in B&W, use the mask as-is, it's already B&W ;).
-				// We just need to invert it ;).
-				uint8_t ainv = 0xFFu;
+		start_x = paint_point.x;
+		// If we're painting in B&W, we use the mask as-is, we just need to invert it ;).
+		uint8_t ainv = 0xFFu;
 #	ifdef FBINK_FOR_KINDLE
-				if ((deviceQuirks.isKindleLegacy && !is_inverted) ||
-				    (!deviceQuirks.isKindleLegacy && is_inverted)) {
+		if ((deviceQuirks.isKindleLegacy && !is_inverted) || (!deviceQuirks.isKindleLegacy && is_inverted)) {
 #	else
-				if (is_inverted) {
+		if (is_inverted) {
 #	endif
-					ainv = 0U;
-				}
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b =
-						    lnPtr[k] ^ ainv;
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			} else {
-				const uint16_t pmul_bg = (uint16_t) (bgcolor * 0xFFu);
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						if (lnPtr[k] == 0U) {
-							// No coverage (transparent) -> background
-							put_pixel(paint_point, &bgP, true);
-						} else if (lnPtr[k] == 0xFFu) {
-							// Full coverage (opaque) -> foreground
-							put_pixel(paint_point, &fgP, true);
-						} else {
-							// AA, blend it using the coverage mask as alpha
-							pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b =
-							    (uint8_t) DIV255((pmul_bg + (layer_diff * lnPtr[k])));
-							put_pixel(paint_point, &pixel, false);
-						}
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			}
-		} else if (is_fgless) {
-			FBInkPixel     fb_px   = { 0U };
-			const uint16_t pmul_bg = (uint16_t) (bgcolor * 0xFFu);
-			// NOTE: One more branch needed because 4bpp fbs are terrible...
-			if (vInfo.bits_per_pixel > 4U) {
-				// 8, 16, 24 & 32bpp
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						if (lnPtr[k] == 0U) {
-							// No coverage (transparent) -> background
-							put_pixel(paint_point, &bgP, true);
-						} else if (lnPtr[k] != 0xFFu) {
-							// AA, blend it using the coverage mask as alpha,
-							// and the underlying pixel as fg
-							get_pixel(paint_point, &fb_px);
-							if (unlikely(deviceQuirks.isRGB)) {
-								pixel.rgba.color.r = (uint8_t) DIV255(
-								    (pmul_bg +
-								     ((fb_px.rgba.color.r - bgcolor) * lnPtr[k])));
-								pixel.rgba.color.g = (uint8_t) DIV255(
-								    (pmul_bg +
-								     ((fb_px.rgba.color.g - bgcolor) * lnPtr[k])));
-								pixel.rgba.color.b = (uint8_t) DIV255(
-								    (pmul_bg +
-								     ((fb_px.rgba.color.b - bgcolor) * lnPtr[k])));
-							} else {
-								pixel.bgra.color.r = (uint8_t) DIV255(
-								    (pmul_bg +
-								     ((fb_px.bgra.color.r - bgcolor) * lnPtr[k])));
-								pixel.bgra.color.g = (uint8_t) DIV255(
-								    (pmul_bg +
-								     ((fb_px.bgra.color.g - bgcolor) * lnPtr[k])));
-								pixel.bgra.color.b = (uint8_t) DIV255(
-								    (pmul_bg +
-								     ((fb_px.bgra.color.b - bgcolor) * lnPtr[k])));
-							}
-							put_pixel(paint_point, &pixel, false);
-						}
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			} else {
-				// 4bpp... We'll have to alpha-blend *everything* to avoid clobbering pixels...
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						// AA, blend it using the coverage mask as alpha, and the underlying pixel as fg
-						get_pixel(paint_point, &fb_px);
-						pixel.gray8 =
-						    (uint8_t) DIV255((pmul_bg + ((fb_px.gray8 - bgcolor) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			}
-		} else if (is_overlay) {
-			FBInkPixel fb_px = { 0U };
-			if (vInfo.bits_per_pixel > 4U) {
-				// 8, 16, 24 & 32bpp
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						if (lnPtr[k] == 0xFFu) {
-							// Full coverage (opaque) -> foreground
-							get_pixel(paint_point, &fb_px);
-							// We want our foreground to be the inverse of the underlying pixel...
-							pixel.p = fb_px.p ^ 0x00FFFFFFu;
-							put_pixel(paint_point, &pixel, false);
-						} else if (lnPtr[k] != 0U) {
-							// AA, blend it using the coverage mask as alpha,
-							// and the underlying pixel as bg
-							// Without forgetting our foreground color trickery...
-							get_pixel(paint_point, &fb_px);
-							if (unlikely(deviceQuirks.isRGB)) {
-								pixel.rgba.color.r = (uint8_t) DIV255(
-								    (MUL255(fb_px.rgba.color.r) +
-								     (((fb_px.rgba.color.r ^ 0xFF) - fb_px.rgba.color.r) *
-								      lnPtr[k])));
-								pixel.rgba.color.g = (uint8_t) DIV255(
-								    (MUL255(fb_px.rgba.color.g) +
-								     (((fb_px.rgba.color.g ^ 0xFF) - fb_px.rgba.color.g) *
-								      lnPtr[k])));
-								pixel.rgba.color.b = (uint8_t) DIV255(
-								    (MUL255(fb_px.rgba.color.b) +
-								     (((fb_px.rgba.color.b ^ 0xFF) - fb_px.rgba.color.b) *
-								      lnPtr[k])));
-							} else {
-								pixel.bgra.color.r = (uint8_t) DIV255(
-								    (MUL255(fb_px.bgra.color.r) +
-								     (((fb_px.bgra.color.r ^ 0xFF) - fb_px.bgra.color.r) *
-								      lnPtr[k])));
-								pixel.bgra.color.g = (uint8_t) DIV255(
-								    (MUL255(fb_px.bgra.color.g) +
-								     (((fb_px.bgra.color.g ^ 0xFF) - fb_px.bgra.color.g) *
-								      lnPtr[k])));
-								pixel.bgra.color.b = (uint8_t) DIV255(
-								    (MUL255(fb_px.bgra.color.b) +
-								     (((fb_px.bgra.color.b ^ 0xFF) - fb_px.bgra.color.b) *
-								      lnPtr[k])));
-							}
-							put_pixel(paint_point, &pixel, false);
-						}
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			} else {
-				// 4bpp...
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
-						// Without forgetting our foreground color trickery...
-						get_pixel(paint_point, &fb_px);
-						pixel.gray8 =
-						    (uint8_t) DIV255((MUL255(fb_px.gray8) +
-								      (((fb_px.gray8 ^ 0xFF) - fb_px.gray8) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			}
-		} else if (is_bgless) {
-			FBInkPixel fb_px = { 0U };
-			if (vInfo.bits_per_pixel > 4U) {
-				// 8, 16, 24 & 32bpp
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						if (lnPtr[k] == 0xFFu) {
-							// Full coverage (opaque) -> foreground
-							put_pixel(paint_point, &fgP, true);
-						} else if (lnPtr[k] != 0U) {
-							// AA, blend it using the coverage mask as alpha,
-							// and the underlying pixel as bg
-							get_pixel(paint_point, &fb_px);
-							if (unlikely(deviceQuirks.isRGB)) {
-								pixel.rgba.color.r = (uint8_t) DIV255(
-								    (MUL255(fb_px.rgba.color.r) +
-								     ((fgcolor - fb_px.rgba.color.r) * lnPtr[k])));
-								pixel.rgba.color.g = (uint8_t) DIV255(
-								    (MUL255(fb_px.rgba.color.g) +
-								     ((fgcolor - fb_px.rgba.color.g) * lnPtr[k])));
-								pixel.rgba.color.b = (uint8_t) DIV255(
-								    (MUL255(fb_px.rgba.color.b) +
-								     ((fgcolor - fb_px.rgba.color.b) * lnPtr[k])));
-							} else {
-								pixel.bgra.color.r = (uint8_t) DIV255(
-								    (MUL255(fb_px.bgra.color.r) +
-								     ((fgcolor - fb_px.bgra.color.r) * lnPtr[k])));
-								pixel.bgra.color.g = (uint8_t) DIV255(
-								    (MUL255(fb_px.bgra.color.g) +
-								     ((fgcolor - fb_px.bgra.color.g) * lnPtr[k])));
-								pixel.bgra.color.b = (uint8_t) DIV255(
-								    (MUL255(fb_px.bgra.color.b) +
-								     ((fgcolor - fb_px.bgra.color.b) * lnPtr[k])));
-							}
-							put_pixel(paint_point, &pixel, false);
-						}
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			} else {
-				// 4bpp...
-				for (int j = 0; j < max_line_height; j++) {
-					for (unsigned int k = 0U; k < lw; k++) {
-						// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
-						get_pixel(paint_point, &fb_px);
-						pixel.gray8 = (uint8_t) DIV255(
-						    (MUL255(fb_px.gray8) + ((fgcolor - fb_px.gray8) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
-					}
-					lnPtr        += max_lw;
-					paint_point.x = start_x;
-					paint_point.y++;
-				}
-			}
+			ainv = 0U;
+		}
+		// Paint it through the blender specialized for the fb's pixel format
+		const FBInkOTPaint paint = {
+			.mask       = line_buff,
+			.stride     = max_lw,
+			.width      = lw,
+			.height     = max_line_height,
+			.origin     = paint_point,
+			.fgP        = fgP,
+			.bgP        = bgP,
+			.layer_diff = layer_diff,
+			.fgcolor    = fgcolor,
+			.bgcolor    = bgcolor,
+			.ainv       = ainv,
+			.is_overlay = is_overlay,
+			.is_fgless  = is_fgless,
+			.is_bgless  = is_bgless,
+		};
+		(*fxpPaintOTLine)(&paint);
+		if (max_line_height > 0) {
+			paint_point.y = (unsigned short int) (paint_point.y + max_line_height);
 		}
 
 		paint_point.y = (unsigned short int) (paint_point.y + lines[line].line_gap);
@@ -8746,7 +10899,7 @@ int
 			LOG("Ran out of drawing area at the end of line# %u after ~%zu characters!", line, ci);
 		}
 		// Don't fudge region again if we're padding vertically
-		if (cfg->padding != VERT_PADDING && cfg->padding != FULL_PADDING) {
+		if (layout->padding != VERT_PADDING && layout->padding != FULL_PADDING) {
 			region.height += (unsigned int) max_line_height;
 			if (region.top + region.height > screenHeight) {
 				region.height = (screenHeight - region.top);
@@ -8759,7 +10912,7 @@ int
 		memset(line_buff, 0, (max_lw * (size_t) max_line_height * sizeof(*line_buff)));
 	}
 	// Now that we're sure we've got nothing left to print, handle bottom padding...
-	if (cfg->padding == VERT_PADDING) {
+	if (layout->padding == VERT_PADDING) {
 		if (!is_overlay && !is_bgless) {
 			// Final line? Bottom padding (final pen position to bottom edge of the drawing area)
 			// NOTE: Top padding is based on the first line's width, and bottom padding on the last line's width.
@@ -8808,7 +10961,7 @@ int
 		}
 
 		// Abort if the user flagged that as a failure.
-		if (cfg->no_truncation) {
+		if (layout->no_truncation) {
 			LOG("Requested late abort on truncation!");
 			rv = ERRCODE(ENOSPC);
 			// NOTE: Do *NOT* inhibit the pending refresh, to avoid screwing with set_last_rect ;).
@@ -8816,28 +10969,229 @@ int
 		}
 	}
 cleanup:
-	// Rotate our eink refresh region before refreshing
-	LOG("Refreshing region from LEFT: %u, TOP: %u, WIDTH: %u, HEIGHT: %u",
-	    region.left,
-	    region.top,
-	    region.width,
-	    region.height);
+	*out_region = region;
+	free(line_buff);
+	free(glyph_buff);
+	return rv;
+}
+#endif    // FBINK_WITH_OPENTYPE
+
+int
+    fbink_print_ot(int fbfd                              UNUSED_BY_MINIMAL,
+		   const char* restrict string           UNUSED_BY_MINIMAL,
+		   const FBInkOTConfig* restrict cfg     UNUSED_BY_MINIMAL,
+		   const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+		   FBInkOTFit* restrict fit              UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	// Abort if we were passed an empty string
+	if (!*string) {
+		// Unless we just want a clear, in which case, bypass everything and just do that.
+		if (fbink_cfg->is_cleared) {
+			return fbink_cls(fbfd, fbink_cfg, NULL, false);
+		} else {
+			PFWARN("Cannot print an empty string");
+			return ERRCODE(EINVAL);
+		}
+	}
+
+	// Abort if we were passed an invalid UTF-8 sequence
+	if (!u8_isvalid2(string)) {
+		PFWARN("Cannot print an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+
+	// Has fbink_add_ot_font() been successfully called yet?
+	if (!otInit) {
+		WARN("No fonts have been loaded");
+		return ERRCODE(ENODATA);
+	}
+
+	// Just in case we receive a NULL pointer to the cfg struct
+	if (!cfg) {
+		WARN("FBInkOTConfig expected. Got NULL pointer instead");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single print call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// Declare this early to make cleanup easier
+	FBInkOTLayout     layout = { 0 };
+	// This also needs to be declared early, as we refresh on cleanup.
+	struct mxcfb_rect region = { 0U };
+
+	// map fb to user mem
+	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	LOG("Printing OpenType text.");
+
+	rv = ot_layout(string, cfg, fit, &layout);
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+
+	// If we only asked for a computation pass, abort now (successfully).
+	if (unlikely(cfg->compute_only)) {
+		LOG("Requested early abort after computation pass");
+		rv = EXIT_SUCCESS;
+		goto cleanup;
+	}
+
+	rv = ot_render(fbfd, &layout, layout.tl, fbink_cfg, fit, &region);
+
+cleanup:
+	// Rotate our eink refresh region before refreshing
+	LOG("Refreshing region from LEFT: %u, TOP: %u, WIDTH: %u, HEIGHT: %u",
+	    region.left,
+	    region.top,
+	    region.width,
+	    region.height);
+	if (region.width > 0U && region.height > 0U) {
+		// Handle the last rect stuff...
+		set_last_rect(&region);
+		(*fxpRotateRegion)(&region);
+		// NOTE: If we asked for a clear screen, fudge the region at the last moment,
+		// so we don't get mangled by previous adjustments...
+		if (fbink_cfg && fbink_cfg->is_cleared) {
+			fullscreen_region(&region);
+		}
+		refresh_compat(fbfd, region, fbink_cfg ? fbink_cfg->no_refresh : false, fbink_cfg);
+	}
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+	ot_layout_release(&layout);
+	return rv;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+FBInkOTLayout*
+    fbink_ot_layout_new(const char* restrict string       UNUSED_BY_MINIMAL,
+			const FBInkOTConfig* restrict cfg UNUSED_BY_MINIMAL,
+			FBInkOTFit* restrict fit          UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!*string) {
+		PFWARN("Cannot lay out an empty string");
+		return NULL;
+	}
+
+	if (!u8_isvalid2(string)) {
+		PFWARN("Cannot lay out an invalid UTF-8 sequence");
+		return NULL;
+	}
+
+	if (!otInit) {
+		WARN("No fonts have been loaded");
+		return NULL;
+	}
+
+	FBInkOTLayout* layout = calloc(1U, sizeof(*layout));
+	if (!layout) {
+		PFWARN("Error allocating layout: %m");
+		return NULL;
+	}
+
+	// ot_layout only borrows the string, but we'll need it for every render
+	char* str = strdup(string);
+	if (!str) {
+		PFWARN("Error duplicating string: %m");
+		free(layout);
+		return NULL;
+	}
+
+	// NOTE: compute_only is meaningless here, we always stop after the layout pass.
+	if (ot_layout(str, cfg, fit, layout) != EXIT_SUCCESS) {
+		ot_layout_release(layout);
+		free(str);
+		free(layout);
+		return NULL;
+	}
+
+	return layout;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return NULL;
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+int
+    fbink_ot_layout_render(int fbfd                              UNUSED_BY_MINIMAL,
+			   const FBInkOTLayout* restrict layout  UNUSED_BY_MINIMAL,
+			   short int x                           UNUSED_BY_MINIMAL,
+			   short int y                           UNUSED_BY_MINIMAL,
+			   const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	// The whole drawing area has to fit in the viewport, as we don't clip glyphs, only lines.
+	const int width  = layout->br.x - layout->tl.x;
+	const int height = layout->br.y - layout->tl.y;
+	if (x < 0 || y < 0 || x + width > (int) viewWidth || y + height > (int) viewHeight) {
+		WARN("A %dx%d layout @ (%hd, %hd) doesn't fit in a %ux%u viewport",
+		     width,
+		     height,
+		     x,
+		     y,
+		     viewWidth,
+		     viewHeight);
+		return ERRCODE(ERANGE);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// This needs to be declared early, as we refresh on cleanup.
+	struct mxcfb_rect region = { 0U };
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// NOTE: Like the margins in fbink_print_ot, y is relative to the viewport.
+	const FBInkCoordinates origin = { .x = (unsigned short int) x,
+					  .y = (unsigned short int) (y + (viewVertOrigin - viewVertOffset)) };
+	rv = ot_render(fbfd, layout, origin, fbink_cfg, NULL, &region);
+
+cleanup:
 	if (region.width > 0U && region.height > 0U) {
-		// Handle the last rect stuff...
 		set_last_rect(&region);
 		(*fxpRotateRegion)(&region);
-		// NOTE: If we asked for a clear screen, fudge the region at the last moment,
-		// so we don't get mangled by previous adjustments...
-		if (is_cleared) {
+		if (fbink_cfg && fbink_cfg->is_cleared) {
 			fullscreen_region(&region);
 		}
 		refresh_compat(fbfd, region, fbink_cfg ? fbink_cfg->no_refresh : false, fbink_cfg);
 	}
-	free(lines);
-	free(brk_buff);
-	free(fmt_buff);
-	free(line_buff);
-	free(glyph_buff);
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -8851,6 +11205,20 @@ cleanup:
 #endif    // FBINK_WITH_OPENTYPE
 }
 
+void
+    fbink_ot_layout_free(FBInkOTLayout* layout UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!layout) {
+		return;
+	}
+
+	ot_layout_release(layout);
+	free((void*) (uintptr_t) layout->string);
+	free(layout);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
 #ifndef FBINK_FOR_LINUX
 // Convert our public WFM_MODE_INDEX_T values to an appropriate mxcfb waveform mode constant for the current device
 static uint32_t
@@ -9757,6 +12125,85 @@ int
 #endif    // !FBINK_FOR_LINUX
 }
 
+// Refresh everything we've drawn since the last call, in as few (and as small) refreshes as possible
+int
+    fbink_refresh_damage(int fbfd                              UNUSED_BY_LINUX,
+			 unsigned short int slack              UNUSED_BY_LINUX,
+			 const FBInkConfig* restrict fbink_cfg UNUSED_BY_LINUX)
+{
+#ifndef FBINK_FOR_LINUX
+	// Assume success, until shit happens ;)
+	int  rv      = EXIT_SUCCESS;
+	bool keep_fd = true;
+#	ifdef FBINK_FOR_KOBO
+	if (deviceQuirks.isSunxi) {
+		// We need the full monty on sunxi...
+		if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+			return ERRCODE(EXIT_FAILURE);
+		}
+
+		if (!isFbMapped) {
+			if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+		}
+	} else {
+		if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+			return ERRCODE(EXIT_FAILURE);
+		}
+	}
+#	else
+	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
+	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+#	endif    // FBINK_FOR_KOBO
+
+	coalesce_damage(slack);
+	LOG("Refreshing %hhu damaged region(s)", damageCount);
+
+	for (uint8_t i = 0U; i < damageCount; i++) {
+		struct mxcfb_rect region = {
+			.top    = damageRects[i].top,
+			.left   = damageRects[i].left,
+			.width  = damageRects[i].width,
+			.height = damageRects[i].height,
+		};
+		// Unlike fbink_refresh, we're fed unrotated coordinates (like everything else in the drawing API).
+		(*fxpRotateRegion)(&region);
+
+		if (refresh_compat(fbfd, region, false, fbink_cfg) != EXIT_SUCCESS) {
+			PFWARN("Failed to refresh damaged region %hux%hu @ (%hu, %hu)",
+			       damageRects[i].width,
+			       damageRects[i].height,
+			       damageRects[i].left,
+			       damageRects[i].top);
+			rv = ERRCODE(EXIT_FAILURE);
+		}
+	}
+	damageCount = 0U;
+
+#	ifdef FBINK_FOR_KOBO
+cleanup:
+	if (deviceQuirks.isSunxi) {
+		if (isFbMapped && !keep_fd) {
+			unmap_fb();
+		}
+	}
+#	endif
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	damageCount = 0U;
+	WARN("e-Ink screen refreshes require an e-Ink device");
+	return ERRCODE(ENOSYS);
+#endif    // !FBINK_FOR_LINUX
+}
+
 // Small public wrapper around wait_for_submission(), without the caller having to depend on mxcfb headers
 int
     fbink_wait_for_submission(int fbfd UNUSED_BY_NOTKINDLE, uint32_t marker UNUSED_BY_NOTKINDLE)
@@ -10266,7 +12713,16 @@ int
 		}
 
 		// Draw percentage in the middle of the bar...
-		draw(percentage_text, (unsigned short int) row, (unsigned short int) col, 0U, halfcell_offset, fbink_cfg);
+		uint32_t     percentage_cps[sizeof(percentage_text)];
+		const size_t percentage_chars = u8_decode2(percentage_text, percentage_cps, line_len);
+		draw(percentage_text,
+		     percentage_cps,
+		     percentage_chars,
+		     (unsigned short int) row,
+		     (unsigned short int) col,
+		     0U,
+		     halfcell_offset,
+		     fbink_cfg);
 
 		// Don't refresh beyond the borders of the bar if we're backgroundless...
 		// This is especially important w/ A2 wfm mode,
@@ -10723,199 +13179,232 @@ static __attribute__((hot)) uint8_t
 	return (q > UINT8_MAX ? UINT8_MAX : (uint8_t) q);
 }
 
-// Draw image data on screen (we inherit a few of the variable types/names from stbi ;))
-static int
-    draw_image(int fbfd,
-	       const unsigned char* restrict data,
-	       const int w,
-	       const int h,
-	       const int n,
-	       const int req_n,
-	       short int x_off,
-	       short int y_off,
-	       const FBInkConfig* restrict fbink_cfg)
-{
-	// Open the framebuffer if need be...
-	// NOTE: As usual, we *expect* to be initialized at this point!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
-	}
-
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
-
-	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
-	}
-
-	// Clear screen?
-	if (fbink_cfg->is_cleared) {
-		FBInkPixel bgP = penBGPixel;
-		if (fbink_cfg->is_inverted) {
-			bgP.p ^= 0x00FFFFFFu;
-		}
-		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
-	}
-
-	// NOTE: We compute initial offsets from row/col, to help aligning images with text.
-	if (fbink_cfg->col < 0) {
-		x_off = (short int) (viewHoriOrigin + x_off + (MAX(MAXCOLS + fbink_cfg->col, 0) * FONTW));
-	} else {
-		x_off = (short int) (viewHoriOrigin + x_off + (fbink_cfg->col * FONTW));
-	}
-	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
-	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
-	//       but we don't want the extra offset when we don't (in particular, when printing full-screen images).
-	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
-	if (fbink_cfg->row < 0) {
-		y_off = (short int) (viewVertOrigin + y_off + (MAX(MAXROWS + fbink_cfg->row, 0) * FONTH));
-	} else if (fbink_cfg->row == 0) {
-		y_off = (short int) (viewVertOrigin - viewVertOffset + y_off + (fbink_cfg->row * FONTH));
-		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
-		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
-		// The "print full-screen images" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
-		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
-		if (viewVertOffset != 0U) {
-			LOG("Ignoring the %hhupx row offset because row is 0!", viewVertOffset);
-		}
-	} else {
-		y_off = (short int) (viewVertOrigin + y_off + (fbink_cfg->row * FONTH));
-	}
-	LOG("Adjusted image display coordinates to (%hd, %hd), after column %hd & row %hd",
-	    x_off,
-	    y_off,
-	    fbink_cfg->col,
-	    fbink_cfg->row);
-
-	// Handle horizontal alignment...
-	switch (fbink_cfg->halign) {
-		case CENTER:
-			x_off = (short int) (x_off + (int) (viewWidth / 2U));
-			x_off = (short int) (x_off - (w / 2));
-			break;
-		case EDGE:
-			x_off = (short int) (x_off + (int) (viewWidth - (uint32_t) w));
-			break;
-		case NONE:
-		default:
-			break;
-	}
-	if (fbink_cfg->halign != NONE) {
-		LOG("Adjusted image display coordinates to (%hd, %hd) after horizontal alignment", x_off, y_off);
-	}
-
-	// Handle vertical alignment...
-	switch (fbink_cfg->valign) {
-		case CENTER:
-			y_off = (short int) (y_off + (int) (viewHeight / 2U));
-			y_off = (short int) (y_off - (h / 2));
-			break;
-		case EDGE:
-			y_off = (short int) (y_off + (int) (viewHeight - (uint32_t) h));
-			break;
-		case NONE:
-		default:
-			break;
-	}
-	if (fbink_cfg->valign != NONE) {
-		LOG("Adjusted image display coordinates to (%hd, %hd) after vertical alignment", x_off, y_off);
-	}
-
-	// Clamp everything to a safe range, because we can't have *anything* going off-screen here.
-	struct mxcfb_rect region;
-	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
-	if (fbink_cfg->row == 0) {
-		region.top = MIN(screenHeight, (uint32_t) MAX((viewVertOrigin - viewVertOffset), y_off));
-	} else {
-		region.top = MIN(screenHeight, (uint32_t) MAX(viewVertOrigin, y_off));
-	}
-	region.left   = MIN(screenWidth, (uint32_t) MAX(viewHoriOrigin, x_off));
-	region.width  = MIN(screenWidth - region.left, (uint32_t) w);
-	region.height = MIN(screenHeight - region.top, (uint32_t) h);
-
-	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
-	//       when it makes sense to do so,
-	//       but we need to remember the unshaven value for the pixel loop condition,
-	//       to avoid looping on only part of the image.
-	unsigned short int max_width  = (unsigned short int) region.width;
-	unsigned short int max_height = (unsigned short int) region.height;
-	// NOTE: We also need to decide if we start looping at the top left of the image, or if we start later, to
-	//       avoid plotting off-screen pixels when using negative display offsets...
-	unsigned short int img_x_off  = 0;
-	unsigned short int img_y_off  = 0;
-	if (x_off < 0) {
-		// We'll start plotting from the beginning of the *visible* part of the image ;)
-		img_x_off = (unsigned short int) (abs(x_off) + viewHoriOrigin);
-		max_width = (unsigned short int) (max_width + img_x_off);
-		// Make sure we're not trying to loop past the actual width of the image!
-		max_width = (unsigned short int) MIN(w, max_width);
-		// Only if the visible section of the image's width is smaller than our screen's width...
-		if ((uint32_t) (w - img_x_off) < viewWidth) {
-			region.width -= img_x_off;
-		}
-	}
-	if (y_off < 0) {
-		// We'll start plotting from the beginning of the *visible* part of the image ;)
-		if (fbink_cfg->row == 0) {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin - viewVertOffset);
-		} else {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin);
-		}
-		max_height = (unsigned short int) (max_height + img_y_off);
-		// Make sure we're not trying to loop past the actual height of the image!
-		max_height = (unsigned short int) MIN(h, max_height);
-		// Only if the visible section of the image's height is smaller than our screen's height...
-		if ((uint32_t) (h - img_y_off) < viewHeight) {
-			region.height -= img_y_off;
-		}
-	}
-	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
-	LOG("Image becomes visible @ (%hu, %hu), looping 'til (%hu, %hu) out of %dx%d pixels",
-	    img_x_off,
-	    img_y_off,
-	    max_width,
-	    max_height,
-	    w,
-	    h);
-	// Warn if there's an alpha channel, because it's usually a bit more expensive to handle...
-	// NOTE: We look at the *original* pixel format, not whatever we ended up passing to draw_image,
-	//       because we know that when we had to add an alpha layer for compatibility with the framebuffer
-	//       pixel format (i.e., a 24bpp RGB image to a 32bpp RGBA fb), it's actually fully opaque,
-	//       so we don't actually care about that component, it's just essentially padding for addressing purposes.
-	bool img_has_alpha = false;
-	if (n == 2 || n == 4) {
-		img_has_alpha = true;
-		if (fbink_cfg->ignore_alpha) {
-			LOG("Ignoring the image's alpha channel.");
-		} else {
-			LOG("Image has an alpha channel, we'll have to do alpha blending.");
+#	if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
+// Figure out how the current rotation quirk maps an upright (screen) tile @ (x, y) to the fb.
+// Both the pickel & boot quirks are transpositions: a screen column becomes a fb row, and a screen row becomes a fb column,
+// we just need to know where the tile's origin lands, and in which direction we walk along each axis.
+static void
+    get_rotated_tile_mapping(unsigned short int         x,
+			     unsigned short int         y,
+			     FBInkCoordinates* restrict origin,
+			     int* restrict              col_step,
+			     int* restrict              row_step)
+{
+	FBInkCoordinates right = { (unsigned short int) (x + 1U), y };
+	FBInkCoordinates down  = { x, (unsigned short int) (y + 1U) };
+	origin->x              = x;
+	origin->y              = y;
+	(*fxpRotateCoords)(origin);
+	(*fxpRotateCoords)(&right);
+	(*fxpRotateCoords)(&down);
+	// Moving one screen column to the right moves us one fb row up (pickel) or down (boot)
+	*row_step = right.y - origin->y;
+	// Moving one screen row down moves us one fb column right (pickel) or left (boot)
+	*col_step = down.x - origin->x;
+}
+
+#		if defined(FBINK_SIMD_NEON)
+// Transpose an 8x8 block of 16-bit pixels in registers
+static inline __attribute__((always_inline)) void
+    transpose_8x8_u16(uint16x8_t* restrict r)
+{
+	const uint16x8x2_t t01 = vtrnq_u16(r[0], r[1]);
+	const uint16x8x2_t t23 = vtrnq_u16(r[2], r[3]);
+	const uint16x8x2_t t45 = vtrnq_u16(r[4], r[5]);
+	const uint16x8x2_t t67 = vtrnq_u16(r[6], r[7]);
+	// Columns 0 & 4 / 2 & 6
+	const uint32x4x2_t u02 = vtrnq_u32(vreinterpretq_u32_u16(t01.val[0]), vreinterpretq_u32_u16(t23.val[0]));
+	const uint32x4x2_t u46 = vtrnq_u32(vreinterpretq_u32_u16(t45.val[0]), vreinterpretq_u32_u16(t67.val[0]));
+	// Columns 1 & 5 / 3 & 7
+	const uint32x4x2_t u13 = vtrnq_u32(vreinterpretq_u32_u16(t01.val[1]), vreinterpretq_u32_u16(t23.val[1]));
+	const uint32x4x2_t u57 = vtrnq_u32(vreinterpretq_u32_u16(t45.val[1]), vreinterpretq_u32_u16(t67.val[1]));
+	r[0] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u02.val[0]), vget_low_u32(u46.val[0])));
+	r[1] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u13.val[0]), vget_low_u32(u57.val[0])));
+	r[2] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u02.val[1]), vget_low_u32(u46.val[1])));
+	r[3] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u13.val[1]), vget_low_u32(u57.val[1])));
+	r[4] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u02.val[0]), vget_high_u32(u46.val[0])));
+	r[5] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u13.val[0]), vget_high_u32(u57.val[0])));
+	r[6] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u02.val[1]), vget_high_u32(u46.val[1])));
+	r[7] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u13.val[1]), vget_high_u32(u57.val[1])));
+}
+
+static inline __attribute__((always_inline)) uint16x8_t
+    reverse_u16x8(uint16x8_t v)
+{
+	v = vrev64q_u16(v);
+	return vcombine_u16(vget_high_u16(v), vget_low_u16(v));
+}
+#		elif defined(FBINK_SIMD_SSE2) || defined(FBINK_SIMD_AVX2)
+static inline __attribute__((always_inline)) void
+    transpose_8x8_u16(__m128i* restrict r)
+{
+	const __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+	const __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+	const __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+	const __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+	const __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+	const __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+	const __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+	const __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+	const __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+	const __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+	const __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+	const __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+	const __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+	const __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+	const __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+	const __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+	r[0]             = _mm_unpacklo_epi64(b0, b4);
+	r[1]             = _mm_unpackhi_epi64(b0, b4);
+	r[2]             = _mm_unpacklo_epi64(b1, b5);
+	r[3]             = _mm_unpackhi_epi64(b1, b5);
+	r[4]             = _mm_unpacklo_epi64(b2, b6);
+	r[5]             = _mm_unpackhi_epi64(b2, b6);
+	r[6]             = _mm_unpacklo_epi64(b3, b7);
+	r[7]             = _mm_unpackhi_epi64(b3, b7);
+}
+
+static inline __attribute__((always_inline)) __m128i
+    reverse_u16x8(__m128i v)
+{
+	v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+	v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+	return _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+}
+#		endif
+
+// Blit an upright tile of w x h 16bpp pixels (stride pixels per row), whose top-left corner is @ (x, y) in screen coordinates,
+// to a fb affected by the pickel or boot rotation quirks.
+// Instead of rotating (and bounds-checking) every single pixel, which turns each tile row into a strided column write,
+// we transpose 8x8 blocks at once, so that every store is a contiguous run of 8 pixels in a single fb scanline.
+// NOTE: Like the put_pixel_* helpers, this assumes the whole tile is on-screen.
+static __attribute__((hot)) void
+    blit_tile16_rotated(const uint16_t* restrict tile,
+			size_t                   stride,
+			unsigned short int       x,
+			unsigned short int       y,
+			unsigned short int       w,
+			unsigned short int       h)
+{
+	FBInkCoordinates origin;
+	int              col_step;
+	int              row_step;
+	get_rotated_tile_mapping(x, y, &origin, &col_step, &row_step);
+
+	// Each *column* of the tile ends up as a fb scanline
+#		pragma GCC diagnostic push
+#		pragma GCC diagnostic ignored "-Wcast-align"
+#		define TILE16_FB_ROW(c)                                                                                  \
+			((uint16_t*) (fbPtr + (size_t) (origin.y + (row_step * (int) (c))) * fInfo.line_length))
+	unsigned short int bw = 0U;
+	unsigned short int bh = 0U;
+#		if defined(FBINK_SIMD_NEON) || defined(FBINK_SIMD_SSE2) || defined(FBINK_SIMD_AVX2)
+	bw = (unsigned short int) (w & ~7U);
+	bh = (unsigned short int) (h & ~7U);
+	for (unsigned short int r0 = 0U; r0 < bh; r0 = (unsigned short int) (r0 + 8U)) {
+		for (unsigned short int c0 = 0U; c0 < bw; c0 = (unsigned short int) (c0 + 8U)) {
+			const uint16_t* restrict src = tile + (r0 * stride) + c0;
+#			ifdef FBINK_SIMD_NEON
+			uint16x8_t v[8];
+			for (uint8_t k = 0U; k < 8U; k++) {
+				v[k] = vld1q_u16(src + (k * stride));
+			}
+#			else
+			__m128i v[8];
+			for (uint8_t k = 0U; k < 8U; k++) {
+				v[k] = _mm_loadu_si128((const __m128i*) (src + (k * stride)));
+			}
+#			endif
+			transpose_8x8_u16(v);
+			for (uint8_t k = 0U; k < 8U; k++) {
+				uint16_t* restrict dst = TILE16_FB_ROW(c0 + k);
+				// The 8 tile rows r0..r0+7 land in 8 consecutive fb columns, possibly in reverse order
+				if (col_step > 0) {
+					dst += origin.x + r0;
+#			ifdef FBINK_SIMD_NEON
+					vst1q_u16(dst, v[k]);
+#			else
+					_mm_storeu_si128((__m128i*) dst, v[k]);
+#			endif
+				} else {
+					dst += origin.x - r0 - 7;
+#			ifdef FBINK_SIMD_NEON
+					vst1q_u16(dst, reverse_u16x8(v[k]));
+#			else
+					_mm_storeu_si128((__m128i*) dst, reverse_u16x8(v[k]));
+#			endif
+				}
+			}
 		}
 	}
+#		endif
+	// Scalar fallback, for the right & bottom edges that don't fill a whole 8x8 block (or everything, w/o SIMD).
+	// We still walk the tile column by column, to write each fb scanline contiguously.
+	for (unsigned short int c = 0U; c < w; c++) {
+		uint16_t* restrict dst = TILE16_FB_ROW(c);
+		// Rows that were already handled by the SIMD blocks in this column
+		const unsigned short int r_start = (c < bw) ? bh : 0U;
+		for (unsigned short int r = r_start; r < h; r++) {
+			dst[origin.x + (col_step * (int) r)] = tile[(r * stride) + c];
+		}
+	}
+#		undef TILE16_FB_ROW
+#		pragma GCC diagnostic pop
+}
 
-	// Handle inversion if requested, in a way that avoids branching in the loop ;).
-	// And, as an added bonus, plays well with the fact that legacy devices have an inverted color map...
-	uint8_t  inv      = 0U;
-	uint24_t inv_rgb  = { 0U };
-	uint32_t inv_rgba = 0U;
-#	ifdef FBINK_FOR_KINDLE
-	if ((deviceQuirks.isKindleLegacy && !fbink_cfg->is_inverted) ||
-	    (!deviceQuirks.isKindleLegacy && fbink_cfg->is_inverted)) {
-#	else
-	if (fbink_cfg->is_inverted) {
-#	endif
-		inv         = 0xFFu;
-		inv_rgb.u24 = 0xFFFFFFu;
-		inv_rgba    = 0x00FFFFFFu;
+#		ifdef FBINK_FOR_POCKETBOOK
+// Same thing, for 8bpp fbs (i.e., PocketBook)
+// NOTE: No SIMD here, the 8x8 blocking alone is what buys us a cache-friendly access pattern.
+static __attribute__((hot)) void
+    blit_tile8_rotated(const uint8_t* restrict tile,
+		       size_t                  stride,
+		       unsigned short int      x,
+		       unsigned short int      y,
+		       unsigned short int      w,
+		       unsigned short int      h)
+{
+	FBInkCoordinates origin;
+	int              col_step;
+	int              row_step;
+	get_rotated_tile_mapping(x, y, &origin, &col_step, &row_step);
+
+	for (unsigned short int c0 = 0U; c0 < w; c0 = (unsigned short int) (c0 + 8U)) {
+		const unsigned short int c_end = (unsigned short int) MIN(c0 + 8U, (unsigned int) w);
+		for (unsigned short int r0 = 0U; r0 < h; r0 = (unsigned short int) (r0 + 8U)) {
+			const unsigned short int r_end = (unsigned short int) MIN(r0 + 8U, (unsigned int) h);
+			for (unsigned short int c = c0; c < c_end; c++) {
+				uint8_t* restrict dst =
+				    fbPtr + (size_t) (origin.y + (row_step * (int) c)) * fInfo.line_length + origin.x;
+				for (unsigned short int r = r0; r < r_end; r++) {
+					dst[col_step * (int) r] = tile[(r * stride) + c];
+				}
+			}
+		}
 	}
-	// And we'll make 'em constants to eke out a tiny bit of performance...
-	const uint8_t  invert     = inv;
-	const uint24_t invert_24b = inv_rgb;
-	const uint32_t invert_32b = inv_rgba;
+}
+#		endif    // FBINK_FOR_POCKETBOOK
+#	endif    // FBINK_FOR_KOBO || FBINK_FOR_CERVANTES || FBINK_FOR_POCKETBOOK
+
+// Render the [start, end) rows of an image prepared by draw_image (c.f., run_bands)
+static void
+    draw_image_band(const void* ctx, uint32_t start, uint32_t end)
+{
+	const FBInkImageBand*         band          = ctx;
+	const unsigned char* restrict data          = band->data;
+	const FBInkConfig* restrict   fbink_cfg     = band->fbink_cfg;
+	const int                     w             = band->w;
+	const int                     req_n         = band->req_n;
+	const short int               x_off         = band->x_off;
+	const short int               y_off         = band->y_off;
+	const unsigned short int      img_x_off     = band->img_x_off;
+	const unsigned short int      max_width     = band->max_width;
+	const unsigned short int      img_y_off     = (unsigned short int) start;
+	const unsigned short int      max_height    = (unsigned short int) end;
+	const bool                    img_has_alpha = band->img_has_alpha;
+	const uint8_t                 invert        = band->invert;
+	const uint24_t                invert_24b    = band->invert_24b;
+	const uint32_t                invert_32b    = band->invert_32b;
+
 	// NOTE: The *slight* duplication is on purpose, to move the branching outside the loop,
 	//       and make use of a few different blitting tweaks depending on the situation...
 	//       And since we can easily do so from here,
@@ -11033,16 +13522,57 @@ static int
 			// No alpha in image, or ignored
 			// We can do a simple copy if the target is 8bpp, the source is 8bpp (no alpha), we don't invert,
 			// and we don't dither.
+#	ifdef FBINK_FOR_POCKETBOOK
+			if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y8 && fxpRotateCoords != &rotate_coordinates_nop) {
+				// The panel is mounted sideways, which would turn every image row into a strided fb column write:
+				// render upright tiles first, and let blit_tile8_rotated transpose them to the fb.
+				uint8_t tile[ROTA_TILE_SIZE * ROTA_TILE_SIZE];
+				for (unsigned short int ty = img_y_off; ty < max_height;
+				     ty                    = (unsigned short int) (ty + ROTA_TILE_SIZE)) {
+					const unsigned short int th =
+					    (unsigned short int) MIN(ROTA_TILE_SIZE, (unsigned int) (max_height - ty));
+					for (unsigned short int tx = img_x_off; tx < max_width;
+					     tx                    = (unsigned short int) (tx + ROTA_TILE_SIZE)) {
+						const unsigned short int tw =
+						    (unsigned short int) MIN(ROTA_TILE_SIZE,
+									     (unsigned int) (max_width - tx));
+						for (unsigned short int j = ty; j < ty + th; j++) {
+							uint8_t* restrict tile_row = tile + ((j - ty) * ROTA_TILE_SIZE);
+							for (unsigned short int i = tx; i < tx + tw; i++) {
+								const size_t pix_offset =
+								    (size_t) ((j * req_n * w) + (i * req_n));
+								if (fbink_cfg->sw_dithering) {
+									tile_row[i - tx] =
+									    dither_o8x8(i, j, data[pix_offset] ^ invert);
+								} else {
+									tile_row[i - tx] = data[pix_offset] ^ invert;
+								}
+							}
+						}
+						blit_tile8_rotated(tile,
+								   ROTA_TILE_SIZE,
+								   (unsigned short int) (tx + x_off),
+								   (unsigned short int) (ty + y_off),
+								   tw,
+								   th);
+					}
+				}
+			} else if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) && req_n == 1 && invert == 0U &&
+				   !fbink_cfg->sw_dithering) {
+#	else
 			if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) && req_n == 1 && invert == 0U &&
 			    !fbink_cfg->sw_dithering) {
+#	endif
 				// Scanline by scanline, as we usually have input/output x offsets to honor
+				const bool stream = blit_wants_stream();
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
 					// NOTE: Again, assume the fb origin is @ (0, 0), which should hold true at that bitdepth.
 					const size_t pix_offset = (size_t) ((j * w) + img_x_off);
 					const size_t fb_offset  = ((uint32_t) (j + y_off) * fInfo.line_length) +
 								 (unsigned int) (img_x_off + x_off);
-					memcpy(fbPtr + fb_offset, data + pix_offset, max_width);
+					blit_copy(fbPtr + fb_offset, data + pix_offset, max_width, stream);
 				}
+				blit_fence(stream);
 			} else {
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
@@ -11347,56 +13877,78 @@ static int
 				FBInkPixel fb_px;
 				// This is essentially a constant in our case...
 				fb_px.bgra.color.a = 0xFFu;
+				// NOTE: Convert in scanline chunks, so that the fb only ever sees linear bursts (c.f., blit_copy).
+				uint32_t   line[BLIT_LINE_PIXELS];
+				const bool stream = blit_wants_stream();
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
-					for (unsigned short int i = img_x_off; i < max_width; i++) {
-						// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
-						const size_t   img_pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
-						// Gobble the full image pixel (we don't care about alpha if it's there)
-						FBInkPixelRGBA img_px;
-						// NOTE: Overread in an RGB32 pixel because it's ever so slightly faster than a 3 bytes memcpy.
-						//       Yes, this can overread 1 byte over the data buffer for the final pixel if req_n == 3.
+					// NOTE: Again, assume we can safely skip rotation tweaks
+					const size_t fb_scanline_offset =
+					    (uint32_t) ((unsigned short int) (j + y_off) * fInfo.line_length);
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-						img_px.p = *((const uint32_t*) (data + img_pix_offset));
+					uint32_t* fb_line = (uint32_t*) (fbPtr + fb_scanline_offset) + x_off;
 #	pragma GCC diagnostic pop
-						// Handle inversion, BGR swap & SW dithering
-						img_px.p ^= invert_32b;
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
-						    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
-							if (fbink_cfg->sw_dithering) {
-								fb_px.bgra.color.r = dither_o8x8(i, j, img_px.color.r);
-								fb_px.bgra.color.g = dither_o8x8(i, j, img_px.color.g);
-								fb_px.bgra.color.b = dither_o8x8(i, j, img_px.color.b);
-							} else {
-								fb_px.bgra.color.r = img_px.color.r;
-								fb_px.bgra.color.g = img_px.color.g;
-								fb_px.bgra.color.b = img_px.color.b;
-							}
-							// NOTE: The RGB -> BGR dance precludes us from simply doing a 3 bytes memcpy,
-							//       and our union trickery appears to be faster than packing the pixel
-							//       ourselves with something like:
-							//       fb_px.p = 0xFF<<24U | img_px.color.r<<16U | img_px.color.g<<8U | img_px.color.b;
-						} else {
-							if (fbink_cfg->sw_dithering) {
-								fb_px.rgba.color.r = dither_o8x8(i, j, img_px.color.r);
-								fb_px.rgba.color.g = dither_o8x8(i, j, img_px.color.g);
-								fb_px.rgba.color.b = dither_o8x8(i, j, img_px.color.b);
-							} else {
-								// Same pixel order
-								fb_px.p = img_px.p;
-							}
-						}
-
-						// NOTE: Again, assume we can safely skip rotation tweaks
-						const size_t fb_scanline_offset =
-						    (uint32_t) ((unsigned short int) (j + y_off) * fInfo.line_length);
+					for (unsigned short int cx = img_x_off; cx < max_width;
+					     cx                    = (unsigned short int) (cx + BLIT_LINE_PIXELS)) {
+						const unsigned short int cw =
+						    (unsigned short int) MIN(BLIT_LINE_PIXELS,
+									     (unsigned int) (max_width - cx));
+						for (unsigned short int i = cx; i < cx + cw; i++) {
+							// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
+							const size_t   img_pix_offset =
+							    (size_t) ((j * req_n * w) + (i * req_n));
+							// Gobble the full image pixel (we don't care about alpha if it's there)
+							FBInkPixelRGBA img_px;
+							// NOTE: Overread in an RGB32 pixel because it's ever so slightly faster than a 3 bytes memcpy.
+							//       Yes, this can overread 1 byte over the data buffer for the final pixel if req_n == 3.
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-						// Write the full pixel to the fb (all 4 bytes)
-						*((uint32_t*) (fbPtr + fb_scanline_offset) + (i + x_off)) = fb_px.p;
+							img_px.p = *((const uint32_t*) (data + img_pix_offset));
 #	pragma GCC diagnostic pop
+							// Handle inversion, BGR swap & SW dithering
+							img_px.p ^= invert_32b;
+							if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+							    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
+								if (fbink_cfg->sw_dithering) {
+									fb_px.bgra.color.r =
+									    dither_o8x8(i, j, img_px.color.r);
+									fb_px.bgra.color.g =
+									    dither_o8x8(i, j, img_px.color.g);
+									fb_px.bgra.color.b =
+									    dither_o8x8(i, j, img_px.color.b);
+								} else {
+									fb_px.bgra.color.r = img_px.color.r;
+									fb_px.bgra.color.g = img_px.color.g;
+									fb_px.bgra.color.b = img_px.color.b;
+								}
+								// NOTE: The RGB -> BGR dance precludes us from simply doing a 3 bytes memcpy,
+								//       and our union trickery appears to be faster than packing the pixel
+								//       ourselves with something like:
+								//       fb_px.p = 0xFF<<24U | img_px.color.r<<16U | img_px.color.g<<8U | img_px.color.b;
+							} else {
+								if (fbink_cfg->sw_dithering) {
+									fb_px.rgba.color.r =
+									    dither_o8x8(i, j, img_px.color.r);
+									fb_px.rgba.color.g =
+									    dither_o8x8(i, j, img_px.color.g);
+									fb_px.rgba.color.b =
+									    dither_o8x8(i, j, img_px.color.b);
+								} else {
+									// Same pixel order
+									fb_px.p = img_px.p;
+								}
+							}
+
+							line[i - cx] = fb_px.p;
+						}
+						// Write the full chunk to the fb (all 4 bytes of every pixel)
+						blit_copy((unsigned char*) (fb_line + cx),
+							  (const unsigned char*) line,
+							  (size_t) cw << 2U,
+							  stream);
 					}
 				}
+				blit_fence(stream);
 			} else {
 				// 24bpp
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
@@ -11503,100 +14055,381 @@ static int
 						(*fxpRotateCoords)(&coords);
 						FBInkPixel bg_px;
 
-						// Deal with pixel order
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
-							get_pixel_BGR565(&coords, &bg_px);
+						// Deal with pixel order
+						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+							get_pixel_BGR565(&coords, &bg_px);
+
+							// Blend it ;).
+							pixel.bgra.color.r =
+							    (uint8_t) DIV255(((img_px.color.r * img_px.color.a) +
+									      (bg_px.bgra.color.r * ainv)));
+							pixel.bgra.color.g =
+							    (uint8_t) DIV255(((img_px.color.g * img_px.color.a) +
+									      (bg_px.bgra.color.g * ainv)));
+							pixel.bgra.color.b =
+							    (uint8_t) DIV255(((img_px.color.b * img_px.color.a) +
+									      (bg_px.bgra.color.b * ainv)));
+							// SW dithering
+							if (fbink_cfg->sw_dithering) {
+								pixel.bgra.color.r =
+								    dither_o8x8(i, j, pixel.bgra.color.r);
+								pixel.bgra.color.g =
+								    dither_o8x8(i, j, pixel.bgra.color.g);
+								pixel.bgra.color.b =
+								    dither_o8x8(i, j, pixel.bgra.color.b);
+							}
+							// Pack it
+							pixel.rgb565 = pack_bgr565(
+							    pixel.bgra.color.r, pixel.bgra.color.g, pixel.bgra.color.b);
+						} else {
+							get_pixel_RGB565(&coords, &bg_px);
+
+							// Blend it ;).
+							pixel.rgba.color.r =
+							    (uint8_t) DIV255(((img_px.color.r * img_px.color.a) +
+									      (bg_px.rgba.color.r * ainv)));
+							pixel.rgba.color.g =
+							    (uint8_t) DIV255(((img_px.color.g * img_px.color.a) +
+									      (bg_px.rgba.color.g * ainv)));
+							pixel.rgba.color.b =
+							    (uint8_t) DIV255(((img_px.color.b * img_px.color.a) +
+									      (bg_px.rgba.color.b * ainv)));
+							// SW dithering
+							if (fbink_cfg->sw_dithering) {
+								pixel.rgba.color.r =
+								    dither_o8x8(i, j, pixel.rgba.color.r);
+								pixel.rgba.color.g =
+								    dither_o8x8(i, j, pixel.rgba.color.g);
+								pixel.rgba.color.b =
+								    dither_o8x8(i, j, pixel.rgba.color.b);
+							}
+							// Pack it
+							pixel.rgb565 = pack_rgb565(
+							    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
+						}
+
+						put_pixel_RGB565(&coords, &pixel);
+					}
+				}
+			}
+#	if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
+		} else if (fxpRotateCoords != &rotate_coordinates_nop) {
+			// No alpha in image, or ignored, but we're affected by a rotation quirk...
+			// Rotating every pixel would turn each image row into a strided fb column write,
+			// so, render upright tiles first, and let blit_tile16_rotated transpose them to the fb.
+			uint16_t tile[ROTA_TILE_SIZE * ROTA_TILE_SIZE];
+			for (unsigned short int ty = img_y_off; ty < max_height;
+			     ty                    = (unsigned short int) (ty + ROTA_TILE_SIZE)) {
+				const unsigned short int th =
+				    (unsigned short int) MIN(ROTA_TILE_SIZE, (unsigned int) (max_height - ty));
+				for (unsigned short int tx = img_x_off; tx < max_width;
+				     tx                    = (unsigned short int) (tx + ROTA_TILE_SIZE)) {
+					const unsigned short int tw =
+					    (unsigned short int) MIN(ROTA_TILE_SIZE, (unsigned int) (max_width - tx));
+					for (unsigned short int j = ty; j < ty + th; j++) {
+						uint16_t* restrict tile_row = tile + ((j - ty) * ROTA_TILE_SIZE);
+						for (unsigned short int i = tx; i < tx + tw; i++) {
+							// NOTE: Same as below ;)
+							const size_t pix_offset =
+							    (size_t) ((j * req_n * w) + (i * req_n));
+							if (fbink_cfg->sw_dithering) {
+								pixel.rgba.color.r =
+								    dither_o8x8(i, j, data[pix_offset + 0U] ^ invert);
+								pixel.rgba.color.g =
+								    dither_o8x8(i, j, data[pix_offset + 1U] ^ invert);
+								pixel.rgba.color.b =
+								    dither_o8x8(i, j, data[pix_offset + 2U] ^ invert);
+							} else {
+								pixel.rgba.color.r = data[pix_offset + 0U] ^ invert;
+								pixel.rgba.color.g = data[pix_offset + 1U] ^ invert;
+								pixel.rgba.color.b = data[pix_offset + 2U] ^ invert;
+							}
+							if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+								tile_row[i - tx] = pack_bgr565(pixel.rgba.color.r,
+											       pixel.rgba.color.g,
+											       pixel.rgba.color.b);
+							} else {
+								tile_row[i - tx] = pack_rgb565(pixel.rgba.color.r,
+											       pixel.rgba.color.g,
+											       pixel.rgba.color.b);
+							}
+						}
+					}
+					blit_tile16_rotated(tile,
+							    ROTA_TILE_SIZE,
+							    (unsigned short int) (tx + x_off),
+							    (unsigned short int) (ty + y_off),
+							    tw,
+							    th);
+				}
+			}
+#	endif
+		} else {
+			// No alpha in image, or ignored
+			// NOTE: For some reason, reading the image 3 or 4 bytes at once doesn't win us anything, here...
+			// NOTE: Rotation quirks were handled above, so, we can write linear chunks of a scanline (c.f., blit_copy).
+			uint16_t   line[BLIT_LINE_PIXELS];
+			const bool stream = blit_wants_stream();
+			for (unsigned short int j = img_y_off; j < max_height; j++) {
+				const size_t fb_scanline_offset =
+				    (uint32_t) ((unsigned short int) (j + y_off) * fInfo.line_length);
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+				uint16_t* fb_line = (uint16_t*) (fbPtr + fb_scanline_offset) + x_off;
+#	pragma GCC diagnostic pop
+				for (unsigned short int cx = img_x_off; cx < max_width;
+				     cx                    = (unsigned short int) (cx + BLIT_LINE_PIXELS)) {
+					const unsigned short int cw =
+					    (unsigned short int) MIN(BLIT_LINE_PIXELS, (unsigned int) (max_width - cx));
+					for (unsigned short int i = cx; i < cx + cw; i++) {
+						// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
+						const size_t pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
+						// SW dithering
+						if (fbink_cfg->sw_dithering) {
+							pixel.rgba.color.r =
+							    dither_o8x8(i, j, data[pix_offset + 0U] ^ invert);
+							pixel.rgba.color.g =
+							    dither_o8x8(i, j, data[pix_offset + 1U] ^ invert);
+							pixel.rgba.color.b =
+							    dither_o8x8(i, j, data[pix_offset + 2U] ^ invert);
+						} else {
+							pixel.rgba.color.r = data[pix_offset + 0U] ^ invert;
+							pixel.rgba.color.g = data[pix_offset + 1U] ^ invert;
+							pixel.rgba.color.b = data[pix_offset + 2U] ^ invert;
+						}
+						// Pack it in the right pixel order
+						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+							line[i - cx] = pack_bgr565(
+							    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
+						} else {
+							line[i - cx] = pack_rgb565(
+							    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
+						}
+					}
+					blit_copy((unsigned char*) (fb_line + cx),
+						  (const unsigned char*) line,
+						  (size_t) cw << 1U,
+						  stream);
+				}
+			}
+			blit_fence(stream);
+		}
+	}
+}
+
+// Returns the XOR mask to apply to each color component of an image for inversion,
+// which, as an added bonus, plays well with the fact that legacy devices have an inverted color map...
+static uint8_t
+    image_invert_mask(const FBInkConfig* restrict fbink_cfg)
+{
+#	ifdef FBINK_FOR_KINDLE
+	if ((deviceQuirks.isKindleLegacy && !fbink_cfg->is_inverted) ||
+	    (!deviceQuirks.isKindleLegacy && fbink_cfg->is_inverted)) {
+#	else
+	if (fbink_cfg->is_inverted) {
+#	endif
+		return 0xFFu;
+	}
+
+	return 0U;
+}
+
+// Draw image data on screen (we inherit a few of the variable types/names from stbi ;))
+static int
+    draw_image(int fbfd,
+	       const unsigned char* restrict data,
+	       const int w,
+	       const int h,
+	       const int n,
+	       const int req_n,
+	       short int x_off,
+	       short int y_off,
+	       const FBInkConfig* restrict fbink_cfg)
+{
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		FBInkPixel bgP = penBGPixel;
+		if (fbink_cfg->is_inverted) {
+			bgP.p ^= 0x00FFFFFFu;
+		}
+		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
+	}
+
+	// NOTE: We compute initial offsets from row/col, to help aligning images with text.
+	if (fbink_cfg->col < 0) {
+		x_off = (short int) (viewHoriOrigin + x_off + (MAX(MAXCOLS + fbink_cfg->col, 0) * FONTW));
+	} else {
+		x_off = (short int) (viewHoriOrigin + x_off + (fbink_cfg->col * FONTW));
+	}
+	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
+	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
+	//       but we don't want the extra offset when we don't (in particular, when printing full-screen images).
+	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
+	if (fbink_cfg->row < 0) {
+		y_off = (short int) (viewVertOrigin + y_off + (MAX(MAXROWS + fbink_cfg->row, 0) * FONTH));
+	} else if (fbink_cfg->row == 0) {
+		y_off = (short int) (viewVertOrigin - viewVertOffset + y_off + (fbink_cfg->row * FONTH));
+		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
+		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
+		// The "print full-screen images" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
+		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
+		if (viewVertOffset != 0U) {
+			LOG("Ignoring the %hhupx row offset because row is 0!", viewVertOffset);
+		}
+	} else {
+		y_off = (short int) (viewVertOrigin + y_off + (fbink_cfg->row * FONTH));
+	}
+	LOG("Adjusted image display coordinates to (%hd, %hd), after column %hd & row %hd",
+	    x_off,
+	    y_off,
+	    fbink_cfg->col,
+	    fbink_cfg->row);
+
+	// Handle horizontal alignment...
+	switch (fbink_cfg->halign) {
+		case CENTER:
+			x_off = (short int) (x_off + (int) (viewWidth / 2U));
+			x_off = (short int) (x_off - (w / 2));
+			break;
+		case EDGE:
+			x_off = (short int) (x_off + (int) (viewWidth - (uint32_t) w));
+			break;
+		case NONE:
+		default:
+			break;
+	}
+	if (fbink_cfg->halign != NONE) {
+		LOG("Adjusted image display coordinates to (%hd, %hd) after horizontal alignment", x_off, y_off);
+	}
 
-							// Blend it ;).
-							pixel.bgra.color.r =
-							    (uint8_t) DIV255(((img_px.color.r * img_px.color.a) +
-									      (bg_px.bgra.color.r * ainv)));
-							pixel.bgra.color.g =
-							    (uint8_t) DIV255(((img_px.color.g * img_px.color.a) +
-									      (bg_px.bgra.color.g * ainv)));
-							pixel.bgra.color.b =
-							    (uint8_t) DIV255(((img_px.color.b * img_px.color.a) +
-									      (bg_px.bgra.color.b * ainv)));
-							// SW dithering
-							if (fbink_cfg->sw_dithering) {
-								pixel.bgra.color.r =
-								    dither_o8x8(i, j, pixel.bgra.color.r);
-								pixel.bgra.color.g =
-								    dither_o8x8(i, j, pixel.bgra.color.g);
-								pixel.bgra.color.b =
-								    dither_o8x8(i, j, pixel.bgra.color.b);
-							}
-							// Pack it
-							pixel.rgb565 = pack_bgr565(
-							    pixel.bgra.color.r, pixel.bgra.color.g, pixel.bgra.color.b);
-						} else {
-							get_pixel_RGB565(&coords, &bg_px);
+	// Handle vertical alignment...
+	switch (fbink_cfg->valign) {
+		case CENTER:
+			y_off = (short int) (y_off + (int) (viewHeight / 2U));
+			y_off = (short int) (y_off - (h / 2));
+			break;
+		case EDGE:
+			y_off = (short int) (y_off + (int) (viewHeight - (uint32_t) h));
+			break;
+		case NONE:
+		default:
+			break;
+	}
+	if (fbink_cfg->valign != NONE) {
+		LOG("Adjusted image display coordinates to (%hd, %hd) after vertical alignment", x_off, y_off);
+	}
 
-							// Blend it ;).
-							pixel.rgba.color.r =
-							    (uint8_t) DIV255(((img_px.color.r * img_px.color.a) +
-									      (bg_px.rgba.color.r * ainv)));
-							pixel.rgba.color.g =
-							    (uint8_t) DIV255(((img_px.color.g * img_px.color.a) +
-									      (bg_px.rgba.color.g * ainv)));
-							pixel.rgba.color.b =
-							    (uint8_t) DIV255(((img_px.color.b * img_px.color.a) +
-									      (bg_px.rgba.color.b * ainv)));
-							// SW dithering
-							if (fbink_cfg->sw_dithering) {
-								pixel.rgba.color.r =
-								    dither_o8x8(i, j, pixel.rgba.color.r);
-								pixel.rgba.color.g =
-								    dither_o8x8(i, j, pixel.rgba.color.g);
-								pixel.rgba.color.b =
-								    dither_o8x8(i, j, pixel.rgba.color.b);
-							}
-							// Pack it
-							pixel.rgb565 = pack_rgb565(
-							    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
-						}
+	// Clamp everything to a safe range, because we can't have *anything* going off-screen here.
+	struct mxcfb_rect region;
+	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
+	if (fbink_cfg->row == 0) {
+		region.top = MIN(screenHeight, (uint32_t) MAX((viewVertOrigin - viewVertOffset), y_off));
+	} else {
+		region.top = MIN(screenHeight, (uint32_t) MAX(viewVertOrigin, y_off));
+	}
+	region.left   = MIN(screenWidth, (uint32_t) MAX(viewHoriOrigin, x_off));
+	region.width  = MIN(screenWidth - region.left, (uint32_t) w);
+	region.height = MIN(screenHeight - region.top, (uint32_t) h);
 
-						put_pixel_RGB565(&coords, &pixel);
-					}
-				}
-			}
+	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
+	//       when it makes sense to do so,
+	//       but we need to remember the unshaven value for the pixel loop condition,
+	//       to avoid looping on only part of the image.
+	unsigned short int max_width  = (unsigned short int) region.width;
+	unsigned short int max_height = (unsigned short int) region.height;
+	// NOTE: We also need to decide if we start looping at the top left of the image, or if we start later, to
+	//       avoid plotting off-screen pixels when using negative display offsets...
+	unsigned short int img_x_off  = 0;
+	unsigned short int img_y_off  = 0;
+	if (x_off < 0) {
+		// We'll start plotting from the beginning of the *visible* part of the image ;)
+		img_x_off = (unsigned short int) (abs(x_off) + viewHoriOrigin);
+		max_width = (unsigned short int) (max_width + img_x_off);
+		// Make sure we're not trying to loop past the actual width of the image!
+		max_width = (unsigned short int) MIN(w, max_width);
+		// Only if the visible section of the image's width is smaller than our screen's width...
+		if ((uint32_t) (w - img_x_off) < viewWidth) {
+			region.width -= img_x_off;
+		}
+	}
+	if (y_off < 0) {
+		// We'll start plotting from the beginning of the *visible* part of the image ;)
+		if (fbink_cfg->row == 0) {
+			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin - viewVertOffset);
 		} else {
-			// No alpha in image, or ignored
-			// NOTE: For some reason, reading the image 3 or 4 bytes at once doesn't win us anything, here...
-			for (unsigned short int j = img_y_off; j < max_height; j++) {
-				for (unsigned short int i = img_x_off; i < max_width; i++) {
-					// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
-					const size_t pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
-					// SW dithering
-					if (fbink_cfg->sw_dithering) {
-						pixel.rgba.color.r = dither_o8x8(i, j, data[pix_offset + 0U] ^ invert);
-						pixel.rgba.color.g = dither_o8x8(i, j, data[pix_offset + 1U] ^ invert);
-						pixel.rgba.color.b = dither_o8x8(i, j, data[pix_offset + 2U] ^ invert);
-					} else {
-						pixel.rgba.color.r = data[pix_offset + 0U] ^ invert;
-						pixel.rgba.color.g = data[pix_offset + 1U] ^ invert;
-						pixel.rgba.color.b = data[pix_offset + 2U] ^ invert;
-					}
-					// Pack it in the right pixel order
-					if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
-						pixel.rgb565 = pack_bgr565(
-						    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
-					} else {
-						pixel.rgb565 = pack_rgb565(
-						    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
-					}
-
-					FBInkCoordinates coords;
-					coords.x = (unsigned short int) (i + x_off);
-					coords.y = (unsigned short int) (j + y_off);
-					// NOTE: Again, we can only skip the OOB checks at this bpp.
-					(*fxpRotateCoords)(&coords);
-					put_pixel_RGB565(&coords, &pixel);
-				}
-			}
+			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin);
+		}
+		max_height = (unsigned short int) (max_height + img_y_off);
+		// Make sure we're not trying to loop past the actual height of the image!
+		max_height = (unsigned short int) MIN(h, max_height);
+		// Only if the visible section of the image's height is smaller than our screen's height...
+		if ((uint32_t) (h - img_y_off) < viewHeight) {
+			region.height -= img_y_off;
+		}
+	}
+	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
+	LOG("Image becomes visible @ (%hu, %hu), looping 'til (%hu, %hu) out of %dx%d pixels",
+	    img_x_off,
+	    img_y_off,
+	    max_width,
+	    max_height,
+	    w,
+	    h);
+	// Warn if there's an alpha channel, because it's usually a bit more expensive to handle...
+	// NOTE: We look at the *original* pixel format, not whatever we ended up passing to draw_image,
+	//       because we know that when we had to add an alpha layer for compatibility with the framebuffer
+	//       pixel format (i.e., a 24bpp RGB image to a 32bpp RGBA fb), it's actually fully opaque,
+	//       so we don't actually care about that component, it's just essentially padding for addressing purposes.
+	bool img_has_alpha = false;
+	if (n == 2 || n == 4) {
+		img_has_alpha = true;
+		if (fbink_cfg->ignore_alpha) {
+			LOG("Ignoring the image's alpha channel.");
+		} else {
+			LOG("Image has an alpha channel, we'll have to do alpha blending.");
 		}
 	}
 
+	// Handle inversion if requested, in a way that avoids branching in the loop ;).
+	// And we'll make 'em constants to eke out a tiny bit of performance...
+	const uint8_t  invert     = image_invert_mask(fbink_cfg);
+	const uint24_t invert_24b = { .u24 = invert ? 0xFFFFFFu : 0U };
+	const uint32_t invert_32b = invert ? 0x00FFFFFFu : 0U;
+	// NOTE: The actual pixel loops live in draw_image_band, so that large images can be split across threads.
+	FBInkImageBand band = {
+		.data          = data,
+		.fbink_cfg     = fbink_cfg,
+		.w             = w,
+		.req_n         = req_n,
+		.x_off         = x_off,
+		.y_off         = y_off,
+		.img_x_off     = img_x_off,
+		.max_width     = max_width,
+		.img_has_alpha = img_has_alpha,
+		.invert        = invert,
+		.invert_24b    = invert_24b,
+		.invert_32b    = invert_32b,
+	};
+	run_bands(&draw_image_band, &band, img_y_off, max_height, WORKERS_BAND_GRANULE, WORKERS_MIN_BAND_ROWS);
+
 	// Handle the last rect stuff...
 	set_last_rect(&region);
 
@@ -11624,17 +14457,36 @@ cleanup:
 
 	return rv;
 }
-#endif    // FBINK_WITH_IMAGE
 
-// Draw an image on screen
-int
-    fbink_print_image(int fbfd                              UNUSED_BY_MINIMAL,
-		      const char* filename                  UNUSED_BY_MINIMAL,
-		      short int x_off                       UNUSED_BY_MINIMAL,
-		      short int y_off                       UNUSED_BY_MINIMAL,
-		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+// Either draw image data on screen, or convert it to a sprite (c.f., fbink_sprite_*), if one was passed
+static int
+    output_image(int fbfd,
+		 const unsigned char* restrict data,
+		 const int w,
+		 const int h,
+		 const int n,
+		 const int req_n,
+		 short int x_off,
+		 short int y_off,
+		 const FBInkConfig* restrict fbink_cfg,
+		 FBInkSprite* restrict sprite)
+{
+	if (sprite) {
+		return sprite_convert(sprite, data, w, h, n, req_n, fbink_cfg);
+	}
+
+	return draw_image(fbfd, data, w, h, n, req_n, x_off, y_off, fbink_cfg);
+}
+
+// Decode an image file, and pass it along to output_image (c.f., fbink_print_image & fbink_sprite_new_from_image)
+static int
+    print_image(int         fbfd,
+		const char* filename,
+		short int   x_off,
+		short int   y_off,
+		const FBInkConfig* restrict fbink_cfg,
+		FBInkSprite* restrict sprite)
 {
-#ifdef FBINK_WITH_IMAGE
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
 
@@ -11754,7 +14606,7 @@ int
 		}
 
 		// We're drawing the scaled data, at the requested scaled resolution
-		if (draw_image(fbfd, sdata, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg) !=
+		if (output_image(fbfd, sdata, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg, sprite) !=
 		    EXIT_SUCCESS) {
 			PFWARN("Failed to display image data on screen");
 			rv = ERRCODE(EXIT_FAILURE);
@@ -11762,7 +14614,7 @@ int
 		}
 	} else {
 		// We're drawing the original unscaled data at its native resolution
-		if (draw_image(fbfd, data, w, h, n, req_n, x_off, y_off, fbink_cfg) != EXIT_SUCCESS) {
+		if (output_image(fbfd, data, w, h, n, req_n, x_off, y_off, fbink_cfg, sprite) != EXIT_SUCCESS) {
 			PFWARN("Failed to display image data on screen");
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
@@ -11776,24 +14628,20 @@ cleanup:
 	free(sdata);
 
 	return rv;
-#else
-	WARN("Image support is disabled in this FBInk build");
-	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
 }
 
-// Draw raw (supposedly image) data on screen
-int
-    fbink_print_raw_data(int fbfd                              UNUSED_BY_MINIMAL,
-			 const unsigned char* restrict data    UNUSED_BY_MINIMAL,
-			 const int w                           UNUSED_BY_MINIMAL,
-			 const int h                           UNUSED_BY_MINIMAL,
-			 const size_t len                      UNUSED_BY_MINIMAL,
-			 short int x_off                       UNUSED_BY_MINIMAL,
-			 short int y_off                       UNUSED_BY_MINIMAL,
-			 const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+// Massage raw image data, and pass it along to output_image (c.f., fbink_print_raw_data & fbink_sprite_new_from_raw_data)
+static int
+    print_raw_data(int fbfd,
+		   const unsigned char* restrict data,
+		   const int    w,
+		   const int    h,
+		   const size_t len,
+		   short int    x_off,
+		   short int    y_off,
+		   const FBInkConfig* restrict fbink_cfg,
+		   FBInkSprite* restrict sprite)
 {
-#ifdef FBINK_WITH_IMAGE
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
 
@@ -11930,7 +14778,8 @@ int
 		}
 
 		// We're drawing the scaled data, at the requested scaled resolution
-		if (draw_image(fbfd, scaled_data, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg) !=
+		if (output_image(
+			fbfd, scaled_data, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg, sprite) !=
 		    EXIT_SUCCESS) {
 			PFWARN("Failed to display image data on screen");
 			rv = ERRCODE(EXIT_FAILURE);
@@ -11938,7 +14787,7 @@ int
 		}
 	} else {
 		// We should now be able to draw that on screen, knowing that it probably won't horribly implode ;p
-		if (draw_image(fbfd, img_data, w, h, n, req_n, x_off, y_off, fbink_cfg) != EXIT_SUCCESS) {
+		if (output_image(fbfd, img_data, w, h, n, req_n, x_off, y_off, fbink_cfg, sprite) != EXIT_SUCCESS) {
 			PFWARN("Failed to display image data on screen");
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
@@ -11953,6 +14802,38 @@ cleanup:
 	free(scaled_data);
 
 	return rv;
+}
+#endif    // FBINK_WITH_IMAGE
+
+// Draw an image on screen
+int
+    fbink_print_image(int fbfd                              UNUSED_BY_MINIMAL,
+		      const char* filename                  UNUSED_BY_MINIMAL,
+		      short int x_off                       UNUSED_BY_MINIMAL,
+		      short int y_off                       UNUSED_BY_MINIMAL,
+		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	return print_image(fbfd, filename, x_off, y_off, fbink_cfg, NULL);
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+// Draw raw (supposedly image) data on screen
+int
+    fbink_print_raw_data(int fbfd                              UNUSED_BY_MINIMAL,
+			 const unsigned char* restrict data    UNUSED_BY_MINIMAL,
+			 const int w                           UNUSED_BY_MINIMAL,
+			 const int h                           UNUSED_BY_MINIMAL,
+			 const size_t len                      UNUSED_BY_MINIMAL,
+			 short int x_off                       UNUSED_BY_MINIMAL,
+			 short int y_off                       UNUSED_BY_MINIMAL,
+			 const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	return print_raw_data(fbfd, data, w, h, len, x_off, y_off, fbink_cfg, NULL);
 #else
 	WARN("Image support is disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -12458,10 +15339,11 @@ int
 
 	// We'll need a region...
 	struct mxcfb_rect region;
+	const bool        stream = blit_wants_stream();
 
 	if (dump->is_full) {
 		// Full dump, easy enough
-		memcpy(fbPtr, dump->data, dump->size);
+		blit_copy(fbPtr, dump->data, dump->size, stream);
 		fullscreen_region(&region);
 	} else {
 		// NOTE: The crop codepath is perfectly safe with no cropping, it's just a little bit hairier to follow...
@@ -12471,8 +15353,10 @@ int
 				for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
 					size_t fb_offset   = (size_t) (dump->area.left >> 1U) + (j * fInfo.line_length);
 					size_t dump_offset = (size_t) (l * dump->stride);
-					memcpy(
-					    fbPtr + fb_offset, dump->data + dump_offset, (size_t) dump->area.width >> 1U);
+					blit_copy(fbPtr + fb_offset,
+						  dump->data + dump_offset,
+						  (size_t) dump->area.width >> 1U,
+						  stream);
 				}
 			} else {
 				// We're going to need the amount of bytes taken per pixel...
@@ -12480,8 +15364,10 @@ int
 				for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
 					size_t fb_offset   = (size_t) (dump->area.left * bpp) + (j * fInfo.line_length);
 					size_t dump_offset = (size_t) (l * dump->stride);
-					memcpy(
-					    fbPtr + fb_offset, dump->data + dump_offset, (size_t) dump->area.width * bpp);
+					blit_copy(fbPtr + fb_offset,
+						  dump->data + dump_offset,
+						  (size_t) dump->area.width * bpp,
+						  stream);
 				}
 			}
 			region.left   = dump->area.left;
@@ -12524,7 +15410,7 @@ int
 				for (unsigned short int j = y, l = 0U; l < h; j++, l++) {
 					size_t fb_offset   = (size_t) (x >> 1U) + (j * fInfo.line_length);
 					size_t dump_offset = (x_skip >> 1U) + ((size_t) (y_skip + l) * dump->stride);
-					memcpy(fbPtr + fb_offset, dump->data + dump_offset, (size_t) w >> 1U);
+					blit_copy(fbPtr + fb_offset, dump->data + dump_offset, (size_t) w >> 1U, stream);
 				}
 			} else {
 				// We're going to need the amount of bytes taken per pixel...
@@ -12533,7 +15419,7 @@ int
 					size_t fb_offset = (size_t) (x * bpp) + (j * fInfo.line_length);
 					size_t dump_offset =
 					    (size_t) (x_skip * bpp) + ((size_t) (y_skip + l) * dump->stride);
-					memcpy(fbPtr + fb_offset, dump->data + dump_offset, (size_t) w * bpp);
+					blit_copy(fbPtr + fb_offset, dump->data + dump_offset, (size_t) w * bpp, stream);
 				}
 			}
 			region.left   = x;
@@ -12542,6 +15428,7 @@ int
 			region.height = h;
 		}
 	}
+	blit_fence(stream);
 
 	// And now, we can refresh the screen
 	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
@@ -12629,6 +15516,11 @@ unsigned char*
 #else
 	*buffer_size = fInfo.smem_len;
 #endif
+	// We have no idea what the caller will do with the shadow buffer, so, make sure the next flush is a full one.
+	struct mxcfb_rect region = { 0U };
+	fullscreen_region(&region);
+	damage_shadow_fb(&region);
+
 	return fbPtr;
 
 failure:
@@ -12656,38 +15548,76 @@ void
 // Extra fonts
 #ifdef FBINK_WITH_FONTS
 // Viznut's Unscii (http://pelulamu.net/unscii)
-#	include "fbink_unscii.c"
+#	ifdef FBINK_WITH_FONT_UNSCII
+#		include "fbink_unscii.c"
+#	endif
 // PoP's Block font, c.f., https://www.mobileread.com/forums/showpost.php?p=3736203&postcount=26 and earlier ;).
-#	include "fbink_block.c"
+#	ifdef FBINK_WITH_FONT_BLOCK
+#		include "fbink_block.c"
+#	endif
 // Wiktor Kerr's Leggie (https://memleek.org/leggie)
-#	include "fbink_leggie.c"
+#	ifdef FBINK_WITH_FONT_LEGGIE
+#		include "fbink_leggie.c"
+#	endif
 // Micah Elliott's Orp (https://github.com/MicahElliott/Orp-Font)
-#	include "fbink_orp.c"
+#	ifdef FBINK_WITH_FONT_ORP
+#		include "fbink_orp.c"
+#	endif
 // Nerdy Pepper's Scientifica (https://github.com/NerdyPepper/scientifica)
-#	include "fbink_scientifica.c"
+#	ifdef FBINK_WITH_FONT_SCIENTIFICA
+#		include "fbink_scientifica.c"
+#	endif
 // Dimitar Toshkov Zhekov's Terminus (http://terminus-font.sourceforge.net)
-#	include "fbink_terminus.c"
+#	ifdef FBINK_WITH_FONT_TERMINUS
+#		include "fbink_terminus.c"
+#	endif
 // Tomi Ollila's Fatty (https://github.com/domo141/fatty-bitmap-font)
-#	include "fbink_fatty.c"
+#	ifdef FBINK_WITH_FONT_FATTY
+#		include "fbink_fatty.c"
+#	endif
 // Frederic Cambus's Spleen (https://github.com/fcambus/spleen)
-#	include "fbink_spleen.c"
+#	ifdef FBINK_WITH_FONT_SPLEEN
+#		include "fbink_spleen.c"
+#	endif
 // Lucy Luz's Tewi (https://github.com/lucy/tewi-font)
-#	include "fbink_tewi.c"
+#	ifdef FBINK_WITH_FONT_TEWI
+#		include "fbink_tewi.c"
+#	endif
 // Various other small fonts (c.f., CREDITS for details)
-#	include "fbink_misc_fonts.c"
+#	if defined(FBINK_WITH_FONT_KATES) || defined(FBINK_WITH_FONT_FKP) || defined(FBINK_WITH_FONT_CTRLD)
+#		include "fbink_misc_fonts.c"
+#	endif
 // Amiga fonts (https://www.trueschool.se/html/fonts.html)
-#	include "fbink_topaz.c"
-#	include "fbink_microknight.c"
+#	ifdef FBINK_WITH_FONT_TOPAZ
+#		include "fbink_topaz.c"
+#	endif
+#	ifdef FBINK_WITH_FONT_MICROKNIGHT
+#		include "fbink_microknight.c"
+#	endif
 // VGA variant of the IBM font (https://farsil.github.io/ibmfonts & https://int10h.org/oldschool-pc-fonts)
-#	include "fbink_vga.c"
+#	ifdef FBINK_WITH_FONT_VGA
+#		include "fbink_vga.c"
+#	endif
 // GNU Unifont glyphs (http://unifoundry.com/unifont/index.html)
 #	ifdef FBINK_WITH_UNIFONT
 #		include "fbink_unifont.c"
 #	endif
 // Slavfox's Cozette (https://github.com/slavfox/Cozette)
-#	include "fbink_cozette.c"
+#	ifdef FBINK_WITH_FONT_COZETTE
+#		include "fbink_cozette.c"
+#	endif
 #endif
 // Contains fbink_button_scan's implementation, Kobo only, and has a bit of Linux MT input thrown in ;).
 #include "fbink_button_scan.c"
 // Contains the Kobo only native/canonical rotation conversion helpers
 #include "fbink_rota_quirks.c"
+// Command lists (i.e., batched drawing calls)
+#include "fbink_cmdlist.c"
+// Banded multi-threaded rendering
+#include "fbink_workers.c"
+// Bitmap font packs
+#include "fbink_fontpack.c"
+// Cell-grid terminal mode
+#include "fbink_term.c"
+// Pre-converted images, blitted by handle
+#include "fbink_sprite.c"
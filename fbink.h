@@ -635,6 +635,22 @@ typedef struct
 	bool no_merge;       // Set the EINK_NO_MERGE flag (Kobo sunxi only)
 	bool is_animated;    // Enable refresh animation, following fbink_mtk_set_swipe_data (Kindle MTK only)
 	bool to_syslog;      // Send messages & errors to the syslog instead of stdout/stderr
+	bool use_shadow_fb;    // Draw into a cached shadow copy of the fb, only flushing what changed right before a refresh.
+	//			  Honored by fbink_init & fbink_reinit.
+	//			  NOTE: Only worth it when keeping the fb around (c.f., fbink_open),
+	//			        as the shadow copy needs to be seeded from the (slow) fb on every mmap.
+	bool is_shadow_inverted;    // Invert the shadow copy on its way to the fb (i.e., a software nightmode, for free).
+	//			       Requires use_shadow_fb. Honored by fbink_init & fbink_reinit.
+	//			       NOTE: Toggling it flushes the whole screen on the next refresh,
+	//			             so you'll probably want that one to be a full-screen flashing refresh.
+	uint8_t threads;    // Split large image draws & full-screen fills in horizontal bands, rendered by up to that many threads.
+	//		       0 or 1 means single-threaded (the default), and it's capped to 8. Honored by fbink_init & fbink_reinit.
+	//		       NOTE: Only large enough workloads are split (e.g., a full-screen image), the rest stays single-threaded.
+	const char* font_pack;    // Render fixed-cell text with a bitmap font pack (c.f., tools/hextopack.py) instead of fontname.
+	//			     Either a path, or a bare name, looked up as $FBINK_FONTPACK_DIR/NAME.fbf
+	//			     (FBINK_FONTPACK_DIR defaults to /usr/share/fbink/fonts). NULL (the default) to use fontname.
+	//			     Honored by fbink_init & fbink_reinit. Falls back to fontname if the pack can't be loaded.
+	//			     NOTE: Works in MINIMAL builds, as long as they support fixed-cell fonts (i.e., BITMAP=1).
 } FBInkConfig;
 
 // Same, but for OT/TTF specific stuff. MUST be zero-initialized.
@@ -669,6 +685,12 @@ typedef struct
 	//                             In particular, broken metrics may yield a late truncation at rendering time.
 	bool no_truncation;    // Abort as early as possible (but not necessarily before the rendering pass),
 			       // if the string cannot fit in the available area at the current font size.
+	bool cmap_lut;    // Give the fonts loaded via fbink_add_ot_font_v2() a codepoint to glyph index lookup table,
+	//                   so that resolving a codepoint only has to search the font's cmap the first time it's seen.
+	//                   Memory is allocated lazily, per block of 256 codepoints (512 bytes each), plus a fixed
+	//                   ~17KB (~34KB on 64-bit) of page pointers per font. Worth it for CJK-heavy content.
+	//                   NOTE: Only honored at load time (i.e., by fbink_add_ot_font_v2()).
+	//                         Since loaded fonts are shared, so is the table, with everyone using that font file.
 } FBInkOTConfig;
 
 // Optionally used with fbink_print_ot, if you need more details about the line-breaking computations,
@@ -710,6 +732,18 @@ typedef struct
 	bool      is_full;
 } FBInkDump;
 
+// Opaque handle for fbink_cmdlist_*
+typedef struct FBInkCmdList FBInkCmdList;
+
+// Opaque handle for fbink_term_*
+typedef struct FBInkTerm FBInkTerm;
+
+// Opaque handle for fbink_sprite_*
+typedef struct FBInkSprite FBInkSprite;
+
+// Opaque handle for fbink_ot_layout_*
+typedef struct FBInkOTLayout FBInkOTLayout;
+
 //
 ////
 //
@@ -796,6 +830,30 @@ FBINK_API void fbink_get_state(const FBInkConfig* restrict fbink_cfg, FBInkState
 FBINK_API int fbink_print(int fbfd, const char* restrict string, const FBInkConfig* restrict fbink_cfg)
     __attribute__((nonnull));
 
+// Measure a string as fbink_print would print it, without printing anything.
+// This runs the exact same layout logic (wrapping, linefeeds, centering, padding, row wraparound, ...),
+// but never touches the framebuffer (it doesn't need to be opened, let alone mmap'ed).
+// NOTE: It does rely on the state computed by fbink_init, though (font, fontmult, viewport, ...),
+//       so results are only valid until the next fbink_init/fbink_reinit call that changes it.
+// Returns the amount of lines fbink_print would print on success (i.e., the same thing fbink_print itself returns).
+// Returns -(EINVAL) if string is empty.
+// Returns -(EILSEQ) if string is not a valid UTF-8 sequence.
+// Returns -(ENOSYS) when fixed-cell font support is disabled (MINIMAL build w/o BITMAP).
+// string:		UTF-8 encoded string to measure.
+// fbink_cfg:		Pointer to an FBInkConfig struct.
+//				Honors the same layout fields as fbink_print (i.e., row, col, hoffset, voffset,
+//				is_halfway, is_centered, is_padded & is_rpadded).
+// rects:		Optional pointer to an array of FBInkRect, which will be set to the area covered by the cells of
+//				each line, in order, clipped to the screen.
+//				Coordinates match those of fbink_get_last_rect(false) (i.e., unrotated).
+//				Lines past max_rects are still counted, but not stored.
+//				Pass a NULL pointer if unneeded.
+// max_rects:		Amount of elements in the rects array.
+FBINK_API int fbink_measure_text(const char* restrict string,
+				 const FBInkConfig* restrict fbink_cfg,
+				 FBInkRect* restrict rects,
+				 size_t max_rects) __attribute__((nonnull(1, 2)));
+
 //
 // Add an OpenType font to FBInk.
 // NOTE: At least one font must be added in order to use fbink_print_ot().
@@ -803,6 +861,10 @@ FBINK_API int fbink_print(int fbfd, const char* restrict string, const FBInkConf
 // style:		Defines the specific style of the specified font (FNT_REGULAR, FNT_ITALIC, FNT_BOLD or FNT_BOLD_ITALIC).
 // NOTE: You MUST free the fonts loaded when you are done with all of them by calling fbink_free_ot_fonts().
 // NOTE: You MAY replace a font without first calling fbink_free_ot_fonts().
+// NOTE: Font files are mapped read-only instead of being read in memory, and a file that's already loaded
+//       (be it for another style, the global pool, or any FBInkOTConfig, via any path) is simply shared.
+//       As such, you MUST NOT truncate or rewrite a font file in place while it's loaded (replacing it is fine).
+//       Memory is only released once every style using that file has been freed.
 // NOTE: Default fonts are secreted away in /usr/java/lib/fonts on Kindle,
 //       and in /usr/local/Trolltech/QtEmbedded-4.6.2-arm/lib/fonts on Kobo,
 //       but you can't use the Kobo ones because they're obfuscated...
@@ -825,6 +887,14 @@ FBINK_API int fbink_free_ot_fonts(void);
 // NOTE: Safe to call even if no fonts were actually loaded, in which case it'll return -(EINVAL)!
 FBINK_API int fbink_free_ot_fonts_v2(FBInkOTConfig* restrict cfg) __attribute__((nonnull));
 
+// Set the memory budget of the glyph cache used by fbink_print_ot (1MB by default).
+// Glyphs are cached per font, size & glyph index, so re-rendering text in a font & size that was already used
+// mostly boils down to blending coverage masks, instead of rasterizing every glyph again.
+// The least recently used glyphs are evicted as needed to stay under budget.
+// NOTE: Freeing a font (via fbink_free_ot_fonts, fbink_free_ot_fonts_v2, or by replacing it) evicts its glyphs.
+// bytes:		Budget, in bytes. 0 disables the cache, and releases everything it currently holds.
+FBINK_API int fbink_set_ot_cache_budget(size_t bytes);
+
 // Print a string using an OpenType font.
 // NOTE: The caller MUST have loaded at least one font via fbink_add_ot_font() FIRST.
 // This function uses margins (in pixels) instead of rows/columns for positioning and setting the printable area.
@@ -864,6 +934,42 @@ FBINK_API int fbink_print_ot(int fbfd,
 			     const FBInkConfig* restrict fbink_cfg,
 			     FBInkOTFit* restrict fit) __attribute__((nonnull(2)));
 
+// Lay out a string once, so that it can then be rendered as many times as needed via fbink_ot_layout_render,
+// without paying for the font lookups, line-breaking & glyph shaping again.
+// Returns an opaque handle on success, or NULL on failure (for the same reasons fbink_print_ot would, plus ENOMEM).
+// The handle MUST be released via fbink_ot_layout_free().
+// NOTE: FBInk MUST have been initialized FIRST, as the layout depends on the current viewport.
+//       It holds onto the fonts it uses, so, those may safely be freed or replaced in the meantime.
+// string:		UTF-8 encoded string to lay out (copied).
+// cfg:			Pointer to an FBInkOTConfig struct. Honored like in fbink_print_ot, except for compute_only.
+//				The margins only define the size of the drawing area, and its default position.
+// fit:			Optional pointer to an FBInkOTFit struct, filled like after a compute_only fbink_print_ot call.
+//				Pass a NULL pointer if unneeded.
+FBINK_API FBInkOTLayout* fbink_ot_layout_new(const char* restrict string,
+					     const FBInkOTConfig* restrict cfg,
+					     FBInkOTFit* restrict fit) __attribute__((nonnull(1, 2)));
+
+// Render a layout created by fbink_ot_layout_new, with its drawing area's top-left corner @ (x, y) in the viewport.
+// The drawing area is as large as the one left by the layout's margins (i.e., the defaults are x = left_margin, y = top_margin).
+// Returns the same things as fbink_print_ot (i.e., a new top margin if positive).
+// Returns -(ERANGE) if the drawing area doesn't fit in the viewport at those coordinates.
+// Returns -(ENOSPC) if the layout's no_truncation is true, and broken metrics led to an unforeseen truncation.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// layout:		Opaque handle, as returned by fbink_ot_layout_new.
+// x, y:		Coordinates of the top-left corner of the drawing area, in pixels.
+// fbink_cfg:		Optional pointer to an FBInkConfig struct, honored like in fbink_print_ot.
+//				As such, colors, alignment or refresh settings may differ between renders of the same layout.
+FBINK_API int fbink_ot_layout_render(int fbfd,
+				     const FBInkOTLayout* restrict layout,
+				     short int x,
+				     short int y,
+				     const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull(2)));
+
+// Release the resources held by a layout created by fbink_ot_layout_new.
+// Passing a NULL pointer is a no-op.
+FBINK_API void fbink_ot_layout_free(FBInkOTLayout* layout);
+
 //
 // Brings printf formatting to fbink_print and fbink_print_ot ;).
 // fbfd:		Open file descriptor to the framebuffer character device,
@@ -920,6 +1026,22 @@ FBINK_API int fbink_refresh(int      fbfd,
 FBINK_API int fbink_refresh_rect(int fbfd, const FBInkRect* restrict rect, const FBInkConfig* restrict fbink_cfg)
     __attribute__((nonnull));
 
+//
+// Refresh everything that was drawn since the last call to this function, using as little screen area as possible.
+// Every region drawn to (i.e., what fbink_get_last_rect would have returned after each call) is recorded,
+// regardless of no_refresh, so this is mainly useful after a batch of no_refresh draws.
+// Returns -(ENOSYS) on non-eInk devices (i.e., pure Linux builds)
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened for the duration of this call.
+// slack:		Regions that overlap, or are at most this many pixels apart (on both axes), are merged in a single refresh.
+//				0 only merges overlapping or touching regions.
+// fbink_cfg:		Pointer to an FBInkConfig struct. Honors wfm_mode, dithering_mode, is_nightmode, is_flashing.
+// NOTE: Unlike fbink_refresh, this deals with unrotated coordinates, just like the drawing functions do.
+// NOTE: Up to 32 regions are tracked, beyond that, new ones are merged into whichever tracked region grows the least.
+// NOTE: The damage list is reset on return, even on failure.
+FBINK_API int fbink_refresh_damage(int fbfd, unsigned short int slack, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+
 // A simple wrapper around the MXCFB_WAIT_FOR_UPDATE_SUBMISSION ioctl, without requiring you to include mxcfb headers.
 // Returns -(EINVAL) when the update marker is invalid.
 // Returns -(ENOSYS) on devices where this ioctl is unsupported.
@@ -1415,6 +1537,59 @@ FBINK_API int fbink_invert_screen(int fbfd, const FBInkConfig* restrict fbink_cf
 //       i.e., this will only apply to stuff drawn via FBInk's own framebuffer pointer (be it by FBInk or yourself).
 FBINK_API int fbink_invert_rect(int fbfd, const FBInkRect* restrict rect, bool no_rota);
 
+//
+// Copies the *existing* content of a specific *region* of the screen to another spot of the screen.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when either the source or the destination rectangle is empty or OOB.
+// NOTE: Like fbink_invert_rect, this does *NOT* trigger a refresh!
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// rect:		Pointer to an FBInkRect rectangle describing the region of screen to copy (in absolute coordinates).
+// x:			Destination coordinates, x (of the top-left corner of the copy).
+// y:			Destination coordinates, y (of the top-left corner of the copy).
+// no_rota:		Optional, and only useful in very limited cases. When in doubt, set to false.
+//				c.f., fbink_invert_rect.
+// NOTE: The source and destination are allowed to overlap.
+// NOTE: On Kobo devices with a sunxi SoC, you will not be able to affect content that you haven't drawn yourself first.
+//       i.e., this will only apply to stuff drawn via FBInk's own framebuffer pointer (be it by FBInk or yourself).
+FBINK_API int fbink_copy_rect(int                fbfd,
+			      const FBInkRect* restrict rect,
+			      unsigned short int x,
+			      unsigned short int y,
+			      bool               no_rota) __attribute__((nonnull(2)));
+
+//
+// Scrolls the *existing* content of a specific *region* of the screen, without having to redraw any of it.
+// Content scrolled out of the rectangle is lost, and the strip it exposes on the other side is cleared to the background color.
+// The intended use case is scrolling text (e.g., a log viewer): scroll by a row's height,
+// and only the new row needs to be drawn in the exposed strip.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when the rectangle is empty or OOB, or when trying to scroll along both axes at once.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors is_inverted for the cleared strip,
+//				as well as wfm_mode, dithering_mode, is_nightmode, is_flashing & no_refresh).
+// rect:		Pointer to an FBInkRect rectangle describing the region of screen to scroll (in absolute coordinates).
+// dx:			Horizontal offset, in pixels (negative scrolls content to the left).
+// dy:			Vertical offset, in pixels (negative scrolls content up).
+//				Only one of dx or dy can be non-zero.
+// exposed:		Optional pointer to an FBInkRect, which will be set to the strip that was exposed by the scroll
+//				(or to the full rect if the offset exceeds its size).
+// no_rota:		Optional, and only useful in very limited cases. When in doubt, set to false.
+//				c.f., fbink_invert_rect.
+// NOTE: The whole rect is refreshed at once (unless no_refresh is set).
+//       To get away with a single refresh for the scroll *and* the new content,
+//       set no_refresh, draw in the exposed strip, then refresh the rect yourself (e.g., via fbink_refresh_rect).
+// NOTE: On Kobo devices with a sunxi SoC, you will not be able to affect content that you haven't drawn yourself first.
+//       i.e., this will only apply to stuff drawn via FBInk's own framebuffer pointer (be it by FBInk or yourself).
+FBINK_API int fbink_scroll_rect(int fbfd,
+				const FBInkConfig* restrict fbink_cfg,
+				const FBInkRect* restrict rect,
+				short int dx,
+				short int dy,
+				FBInkRect* restrict exposed,
+				bool no_rota) __attribute__((nonnull(2, 3)));
+
 //
 // The functions below are much lower level than the rest of the API:
 // outside of GUI toolkit implementations and very specific workflows, you shouldn't need to rely on them.
@@ -1428,6 +1603,8 @@ FBINK_API int fbink_invert_rect(int fbfd, const FBInkRect* restrict rect, bool n
 // NOTE: This *may* need to be refreshed after a framebuffer state change, c.f., fbink_reinit!
 //       (In practice, though, the pointer itself is stable;
 //        only the buffer/mapping size may change on some quirky platforms (usually, PB)).
+// NOTE: When use_shadow_fb is enabled, this is the shadow copy, *not* the actual fb!
+//       Anything you write to it will only make it to the fb on the next refresh covering it (or on fbink_close).
 // fbfd:		Open file descriptor to the framebuffer character device,
 //				cannot be set to FBFD_AUTO!
 // buffer_size:		Out parameter. On success, will be set to the buffer's size, in bytes.
@@ -1550,6 +1727,154 @@ FBINK_API int fbink_fill_rect(int fbfd,
 // c.f., `fbink_put_pixel_*` & `fbink_fill_rect_*` for documentation of the initial parameters they share.
 // px:                   pointer to a packed pixel, as provided by the fbink_pack_pixel_* family of functions.
 
+// Bulk variants of fbink_put_pixel*, for when you need to plot a lot of points at once (e.g., pen strokes or plots).
+// Every point goes through the same rotation & bounds checks as fbink_put_pixel, but we only branch on the pixel format once.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// xy:			Array of count packed (x, y) coordinates pairs (i.e., x0, y0, x1, y1, ...).
+// count:		Number of points (i.e., half the number of elements in xy).
+// v:			8-bit luminance value, used for every point if values is NULL
+// values:		Optional array of count 8-bit luminance values, one per point (takes precedence over v).
+// NOTE: Like fbink_put_pixel*, this does *not* trigger a refresh,
+//       but fbink_get_last_rect will return the bounding box of the points.
+FBINK_API int fbink_put_pixels_gray(int fbfd,
+				    const uint16_t* restrict xy,
+				    size_t  count,
+				    uint8_t v,
+				    const uint8_t* restrict values) __attribute__((nonnull(2)));
+// px:			pointer to a packed pixel, as provided by the fbink_pack_pixel_* family of functions.
+FBINK_API int fbink_put_pixels(int fbfd, const uint16_t* restrict xy, size_t count, void* px) __attribute__((nonnull));
+
+//
+// Command lists: record a batch of drawing calls, and execute them all at once, with a single refresh.
+// Mainly useful when going through an FFI, where the per-call overhead of the functions above adds up quickly.
+// Returns NULL on failure.
+// NOTE: Must be released with fbink_cmdlist_free.
+FBINK_API FBInkCmdList* fbink_cmdlist_new(void);
+// Each of these appends a single command to the list, and takes a copy of everything it needs,
+// so the caller is free to recycle its own buffers right away.
+// Returns -(ENOMEM) on allocation failure.
+// Returns -(ENOSYS) when the matching drawing function is disabled in this build.
+// list:		Command list, as returned by fbink_cmdlist_new.
+// c.f., fbink_print, fbink_fill_rect, fbink_put_pixel, fbink_print_image & fbink_print_raw_data
+// for the documentation of the remaining parameters.
+// NOTE: px is a packed pixel, as provided by the fbink_pack_pixel_* family of functions.
+// NOTE: The FBInkConfig's no_refresh field is ignored, refreshes are handled by fbink_cmdlist_exec.
+FBINK_API int fbink_cmdlist_add_text(FBInkCmdList* restrict list,
+				     const char* restrict string,
+				     const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_cmdlist_add_rect(FBInkCmdList* restrict list,
+				     const FBInkRect* restrict rect,
+				     bool     no_rota,
+				     uint32_t px,
+				     const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull(1, 5)));
+FBINK_API int fbink_cmdlist_add_pixel(FBInkCmdList* restrict list, uint16_t x, uint16_t y, uint32_t px)
+    __attribute__((nonnull));
+FBINK_API int fbink_cmdlist_add_image(FBInkCmdList* restrict list,
+				      const char* filename,
+				      short int   x_off,
+				      short int   y_off,
+				      const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_cmdlist_add_raw_data(FBInkCmdList* restrict list,
+					 const unsigned char* restrict data,
+					 const int    w,
+					 const int    h,
+					 const size_t len,
+					 short int    x_off,
+					 short int    y_off,
+					 const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+// Run every command in the list, in order, then refresh the union of everything that was drawn in one go.
+// Returns the error code of the first command that failed, if any (subsequent commands are still executed).
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// list:		Command list, as returned by fbink_cmdlist_new.
+// fbink_cfg:		Pointer to an FBInkConfig struct. Only used for the final refresh
+//				(honors no_refresh, wfm_mode, dithering_mode, is_nightmode, is_flashing).
+// NOTE: The list is left untouched, so it can be executed again (e.g., after a fbink_reinit).
+FBINK_API int fbink_cmdlist_exec(int fbfd, const FBInkCmdList* restrict list, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+// Drop every command from the list, but keep it around for reuse.
+FBINK_API void fbink_cmdlist_clear(FBInkCmdList* restrict list) __attribute__((nonnull));
+// Release a command list (NULL is a no-op).
+FBINK_API void fbink_cmdlist_free(FBInkCmdList* list);
+
+//
+// Terminal mode: an in-memory grid of cells, matching fbink_print's MAXCOLS x MAXROWS grid,
+// where writes only flag the cells that actually changed, and a flush only redraws (& refreshes) those.
+// Mainly useful for console or log views that are updated a few characters at a time.
+// Returns NULL on failure.
+// NOTE: Must be released with fbink_term_free.
+// NOTE: The grid follows the current font metrics: if those change (e.g., after a fbink_init w/ a different fontmult),
+//       it's resized on the next call, preserving whatever content still fits, and flagging everything for redraw.
+FBINK_API FBInkTerm* fbink_term_new(void);
+// Write a string to the grid, starting at the cell @ (col, row), using the current pen colors.
+// Nothing is drawn until the next fbink_term_flush.
+// Returns the amount of cells written, or -(EINVAL) if (col, row) is out of bounds.
+// Returns -(EILSEQ) on invalid UTF-8 input.
+// Returns -(ENOSYS) when fixed-cell font support is disabled (MINIMAL build w/o BITMAP).
+// term:		Terminal, as returned by fbink_term_new.
+// col, row:		Grid coordinates of the first cell (i.e., from 0 to MAXCOLS - 1 & MAXROWS - 1, c.f., fbink_get_state).
+// string:		UTF-8 encoded string to write. Like a terminal, it wraps at the right edge of the grid,
+//				LFs move on to the start of the next row, and anything past the bottom of the grid is discarded.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors is_inverted).
+FBINK_API int fbink_term_write(FBInkTerm* restrict term,
+			       unsigned short int col,
+			       unsigned short int row,
+			       const char* restrict string,
+			       const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+// Blank the full grid (using the current background pen), and flag all of it for redraw.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors is_inverted).
+FBINK_API int fbink_term_clear(FBInkTerm* restrict term, const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+// Redraw every cell that changed since the last flush, and refresh only the affected areas of the screen,
+// one area per block of consecutive rows (or their bounding box, if that would mean too many refreshes).
+// Returns the amount of refreshed areas on success (0 means there was nothing to do).
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// term:		Terminal, as returned by fbink_term_new.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors voffset, hoffset, is_overlay, is_fgless, is_bgless,
+//				no_refresh, wfm_mode, dithering_mode, is_nightmode, is_flashing).
+//				Colors & inversion are taken from the cells themselves, positioning flags are ignored.
+FBINK_API int fbink_term_flush(int fbfd, FBInkTerm* restrict term, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull(2, 3)));
+// Release a terminal (NULL is a no-op).
+FBINK_API void fbink_term_free(FBInkTerm* term);
+
+//
+// Sprites: images that are decoded, scaled & converted to the fb's pixel format once, at creation time,
+// so that drawing them later on (e.g., status bar icons, redrawn on every update) is mostly a matter of memcpy.
+// Fully opaque pixels are copied as-is, translucent ones are alpha-blended with the fb content at blitting time.
+// Returns NULL on failure (or when image support is disabled, i.e., MINIMAL build w/o IMAGE).
+// NOTE: Must be released with fbink_sprite_free.
+// NOTE: As the conversion depends on the fb's pixel format, fbink_init has to have been called first,
+//       and a sprite can no longer be blitted once that format changes (e.g., after a bitdepth switch).
+// filename, data, w, h, len:	c.f., fbink_print_image & fbink_print_raw_data.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors scaled_width, scaled_height, is_inverted, ignore_alpha,
+//				sw_dithering). Variants (e.g., inverted or not) are simply different sprites.
+FBINK_API FBInkSprite* fbink_sprite_new_from_image(const char* filename, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+FBINK_API FBInkSprite* fbink_sprite_new_from_raw_data(const unsigned char* restrict data,
+						      const int    w,
+						      const int    h,
+						      const size_t len,
+						      const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+// Draw a sprite on screen, its top-left corner @ (x, y), in pixels, relative to the viewport
+// (i.e., like fbink_print_image's x_off & y_off w/ row & col left at 0). Anything outside the viewport is clipped.
+// Returns -(ESTALE) if the fb's pixel format changed since the sprite was created.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// sprite:		Sprite, as returned by fbink_sprite_new_from_image or fbink_sprite_new_from_raw_data.
+// fbink_cfg:		Pointer to an FBInkConfig struct. Only used for the refresh
+//				(honors no_refresh, wfm_mode, dithering_mode, is_nightmode, is_flashing).
+FBINK_API int fbink_sprite_blit(int fbfd,
+				const FBInkSprite* restrict sprite,
+				short int x,
+				short int y,
+				const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull(2, 5)));
+// Release a sprite (NULL is a no-op).
+FBINK_API void fbink_sprite_free(FBInkSprite* sprite);
+
 // Forcefully wakeup the EPDC (Kobo Mk.8+ only)
 // We've found this to be helpful on a few otherwise crashy devices,
 // c.f., https://github.com/koreader/koreader-base/pull/1645 & https://github.com/koreader/koreader/pull/10771
@@ -26,7 +26,11 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/block.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/block.h"
+#else
+#	include "fonts/block.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const uint32_t* block_get_bitmap(uint32_t) __attribute__((const));
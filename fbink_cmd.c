@@ -192,6 +192,9 @@ static void
 #else
 	    "\t\t\t\tAvailable font families: IBM\n"
 #endif
+	    "\t\t\t\tAnything else is assumed to be a font pack, either as a path to an .fbf file, or as a bare NAME,\n"
+	    "\t\t\t\t\t\tin which case it's looked up as NAME.fbf in $FBINK_FONTPACK_DIR (Default: /usr/share/fbink/fonts).\n"
+	    "\t\t\t\t\t\tSee tools/hextopack.py to build one.\n"
 #ifdef FBINK_WITH_OPENTYPE
 	    "\t\t\t\tNOTE: If you're looking for vector font rendering, see the OpenType section a few lines down!\n"
 #endif
@@ -1075,8 +1078,8 @@ int
 				} else if (strcasecmp(optarg, "COZETTE") == 0) {
 					fbink_cfg.fontname = COZETTE;
 				} else {
-					ELOG("Unknown font name '%s'.", optarg);
-					errfnd = true;
+					// Not a builtin, so, assume it's a font pack, and let fbink_init sort it out
+					fbink_cfg.font_pack = optarg;
 				}
 				break;
 			case 'v':
@@ -0,0 +1,415 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_cmdlist.h"
+
+FBInkCmdList*
+    fbink_cmdlist_new(void)
+{
+	FBInkCmdList* list = calloc(1U, sizeof(*list));
+	if (!list) {
+		PFWARN("Error allocating command list: %m");
+		return NULL;
+	}
+
+	return list;
+}
+
+#if defined(FBINK_WITH_BITMAP) || defined(FBINK_WITH_DRAW) || defined(FBINK_WITH_IMAGE)
+// Reserve a new slot at the end of the list, growing it if need be
+static FBInkCmd*
+    cmdlist_append(FBInkCmdList* restrict list, FBINK_CMD_TYPE_T type, const FBInkConfig* restrict fbink_cfg)
+{
+	if (list->count == list->capacity) {
+		const size_t capacity = list->capacity ? list->capacity * 2U : 16U;
+		FBInkCmd*    cmds     = realloc(list->cmds, capacity * sizeof(*cmds));
+		if (!cmds) {
+			PFWARN("Error growing command list: %m");
+			return NULL;
+		}
+		list->cmds     = cmds;
+		list->capacity = capacity;
+	}
+
+	FBInkCmd* cmd = &list->cmds[list->count];
+	memset(cmd, 0, sizeof(*cmd));
+	cmd->type = type;
+	if (fbink_cfg) {
+		cmd->cfg = *fbink_cfg;
+	}
+
+	return cmd;
+}
+#endif
+
+int
+    fbink_cmdlist_add_text(FBInkCmdList* restrict list         UNUSED_BY_NOBITMAP,
+			   const char* restrict string         UNUSED_BY_NOBITMAP,
+			   const FBInkConfig* restrict fbink_cfg UNUSED_BY_NOBITMAP)
+{
+#ifdef FBINK_WITH_BITMAP
+	FBInkCmd* cmd = cmdlist_append(list, CMD_TEXT, fbink_cfg);
+	if (!cmd) {
+		return ERRCODE(ENOMEM);
+	}
+
+	cmd->text.string = strdup(string);
+	if (!cmd->text.string) {
+		PFWARN("strdup: %m");
+		return ERRCODE(ENOMEM);
+	}
+
+	list->count++;
+	return EXIT_SUCCESS;
+#else
+	WARN("Fixed cell font support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_cmdlist_add_rect(FBInkCmdList* restrict list         UNUSED_BY_NODRAW,
+			   const FBInkRect* restrict rect      UNUSED_BY_NODRAW,
+			   bool no_rota                        UNUSED_BY_NODRAW,
+			   uint32_t px                         UNUSED_BY_NODRAW,
+			   const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	FBInkCmd* cmd = cmdlist_append(list, CMD_RECT, fbink_cfg);
+	if (!cmd) {
+		return ERRCODE(ENOMEM);
+	}
+
+	if (rect) {
+		cmd->rect.rect = *rect;
+	}
+	cmd->rect.px.p    = px;
+	cmd->rect.no_rota = no_rota;
+
+	list->count++;
+	return EXIT_SUCCESS;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_cmdlist_add_pixel(FBInkCmdList* restrict list UNUSED_BY_NODRAW,
+			    uint16_t x                  UNUSED_BY_NODRAW,
+			    uint16_t y                  UNUSED_BY_NODRAW,
+			    uint32_t px                 UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	FBInkCmd* cmd = cmdlist_append(list, CMD_PIXEL, NULL);
+	if (!cmd) {
+		return ERRCODE(ENOMEM);
+	}
+
+	cmd->pixel.x    = x;
+	cmd->pixel.y    = y;
+	cmd->pixel.px.p = px;
+
+	list->count++;
+	return EXIT_SUCCESS;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_cmdlist_add_image(FBInkCmdList* restrict list          UNUSED_BY_MINIMAL,
+			    const char* filename                 UNUSED_BY_MINIMAL,
+			    short int x_off                      UNUSED_BY_MINIMAL,
+			    short int y_off                      UNUSED_BY_MINIMAL,
+			    const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	FBInkCmd* cmd = cmdlist_append(list, CMD_IMAGE, fbink_cfg);
+	if (!cmd) {
+		return ERRCODE(ENOMEM);
+	}
+
+	cmd->image.filename = strdup(filename);
+	if (!cmd->image.filename) {
+		PFWARN("strdup: %m");
+		return ERRCODE(ENOMEM);
+	}
+	cmd->image.x_off = x_off;
+	cmd->image.y_off = y_off;
+
+	list->count++;
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_cmdlist_add_raw_data(FBInkCmdList* restrict list          UNUSED_BY_MINIMAL,
+			       const unsigned char* restrict data   UNUSED_BY_MINIMAL,
+			       const int w                          UNUSED_BY_MINIMAL,
+			       const int h                          UNUSED_BY_MINIMAL,
+			       const size_t len                     UNUSED_BY_MINIMAL,
+			       short int x_off                      UNUSED_BY_MINIMAL,
+			       short int y_off                      UNUSED_BY_MINIMAL,
+			       const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	FBInkCmd* cmd = cmdlist_append(list, CMD_RAW_DATA, fbink_cfg);
+	if (!cmd) {
+		return ERRCODE(ENOMEM);
+	}
+
+	// NOTE: We take a copy, so that the caller is free to recycle its buffer before the list is executed.
+	cmd->raw.data = malloc(len);
+	if (!cmd->raw.data) {
+		PFWARN("Error allocating raw data copy: %m");
+		return ERRCODE(ENOMEM);
+	}
+	memcpy(cmd->raw.data, data, len);
+	cmd->raw.len   = len;
+	cmd->raw.w     = w;
+	cmd->raw.h     = h;
+	cmd->raw.x_off = x_off;
+	cmd->raw.y_off = y_off;
+
+	list->count++;
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+// Run a single command, without refreshing anything, and keep track of what it drew to.
+static int
+    exec_cmd(int fbfd, const FBInkCmd* restrict cmd, const FBInkConfig* restrict fbink_cfg, FBInkRect* restrict area)
+{
+	int rv = EXIT_SUCCESS;
+
+	// Forget about whatever was drawn before, so that we only ever account for what *this* command set (if anything).
+	lastRect = (FBInkRect){ 0U };
+
+	switch (cmd->type) {
+		case CMD_TEXT:
+			rv = fbink_print(fbfd, cmd->text.string, fbink_cfg);
+			break;
+		case CMD_RECT:
+		{
+			FBInkPixel px = cmd->rect.px;
+			rv            = fbink_fill_rect(fbfd, fbink_cfg, &cmd->rect.rect, cmd->rect.no_rota, &px);
+			break;
+		}
+		case CMD_PIXEL:
+		{
+#ifdef FBINK_WITH_DRAW
+			// NOTE: We go straight to put_pixel here, the public wrappers are way too expensive for this...
+			// NOTE: put_pixel silently culls off-screen pixels, so make sure we don't account for those.
+			if (cmd->pixel.x >= screenWidth || cmd->pixel.y >= screenHeight) {
+				return EXIT_SUCCESS;
+			}
+			const FBInkCoordinates coords = { .x = cmd->pixel.x, .y = cmd->pixel.y };
+			put_pixel(coords, &cmd->pixel.px, true);
+
+			struct mxcfb_rect region = {
+				.top    = cmd->pixel.y,
+				.left   = cmd->pixel.x,
+				.width  = 1U,
+				.height = 1U,
+			};
+			(*fxpRotateRegion)(&region);
+			damage_shadow_fb(&region);
+
+			const FBInkRect rect = { .left = cmd->pixel.x, .top = cmd->pixel.y, .width = 1U, .height = 1U };
+			if (area->width == 0U) {
+				*area = rect;
+			} else {
+				merge_rects(area, &rect);
+			}
+#endif
+			// lastRect wasn't touched, so we're done.
+			return EXIT_SUCCESS;
+		}
+		case CMD_IMAGE:
+			rv = fbink_print_image(fbfd, cmd->image.filename, cmd->image.x_off, cmd->image.y_off, fbink_cfg);
+			break;
+		case CMD_RAW_DATA:
+			rv = fbink_print_raw_data(fbfd,
+						  cmd->raw.data,
+						  cmd->raw.w,
+						  cmd->raw.h,
+						  cmd->raw.len,
+						  cmd->raw.x_off,
+						  cmd->raw.y_off,
+						  fbink_cfg);
+			break;
+		default:
+			return ERRCODE(EINVAL);
+	}
+
+	// NOTE: fbink_print returns the amount of printed rows on success
+	if (rv < 0) {
+		return rv;
+	}
+
+	// NOTE: Commands may legitimately succeed w/o drawing anything (e.g., an image that's entirely off-screen).
+	if (lastRect.width != 0U && lastRect.height != 0U) {
+		if (area->width == 0U) {
+			*area = lastRect;
+		} else {
+			merge_rects(area, &lastRect);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+int
+    fbink_cmdlist_exec(int fbfd, const FBInkCmdList* restrict list, const FBInkConfig* restrict fbink_cfg)
+{
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Run everything w/o refreshing, while keeping track of the union of everything that was drawn
+	FBInkRect area = { 0U };
+	for (size_t i = 0U; i < list->count; i++) {
+		const FBInkCmd* cmd = &list->cmds[i];
+		FBInkConfig     cfg = cmd->cfg;
+		cfg.no_refresh      = true;
+
+		int ret = exec_cmd(fbfd, cmd, &cfg, &area);
+		if (ret != EXIT_SUCCESS) {
+			WARN("Command %zu (out of %zu) failed", i, list->count);
+			// Keep going, but remember the first failure
+			if (rv == EXIT_SUCCESS) {
+				rv = ret;
+			}
+		}
+	}
+
+	// Nothing was drawn, we're done
+	if (area.width == 0U || area.height == 0U) {
+		goto cleanup;
+	}
+	// NOTE: refresh() rejects 1xN & Nx1 regions (e.g., a lone pixel), so, grow those by a pixel, while staying on screen.
+	if (area.width == 1U) {
+		area.width = 2U;
+		if (area.left + 2U > screenWidth && area.left > 0U) {
+			area.left--;
+		}
+	}
+	if (area.height == 1U) {
+		area.height = 2U;
+		if (area.top + 2U > screenHeight && area.top > 0U) {
+			area.top--;
+		}
+	}
+
+	// And now, a single refresh for the whole batch
+	struct mxcfb_rect region = {
+		.top    = area.top,
+		.left   = area.left,
+		.width  = area.width,
+		.height = area.height,
+	};
+	// Remember the rect...
+	set_last_rect(&region);
+	// Rotate the region if need be...
+	(*fxpRotateRegion)(&region);
+
+	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+}
+
+static void
+    free_cmd(FBInkCmd* restrict cmd)
+{
+	switch (cmd->type) {
+		case CMD_TEXT:
+			free(cmd->text.string);
+			cmd->text.string = NULL;
+			break;
+		case CMD_IMAGE:
+			free(cmd->image.filename);
+			cmd->image.filename = NULL;
+			break;
+		case CMD_RAW_DATA:
+			free(cmd->raw.data);
+			cmd->raw.data = NULL;
+			break;
+		default:
+			break;
+	}
+}
+
+void
+    fbink_cmdlist_clear(FBInkCmdList* restrict list)
+{
+	for (size_t i = 0U; i < list->count; i++) {
+		free_cmd(&list->cmds[i]);
+	}
+	list->count = 0U;
+}
+
+void
+    fbink_cmdlist_free(FBInkCmdList* list)
+{
+	if (!list) {
+		return;
+	}
+
+	fbink_cmdlist_clear(list);
+	free(list->cmds);
+	free(list);
+}
@@ -0,0 +1,94 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_CMDLIST_H
+#define __FBINK_CMDLIST_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+typedef enum
+{
+	CMD_TEXT = 0U,
+	CMD_RECT,
+	CMD_PIXEL,
+	CMD_IMAGE,
+	CMD_RAW_DATA,
+} __attribute__((packed)) FBINK_CMD_TYPE_E;
+typedef uint8_t FBINK_CMD_TYPE_T;
+
+// A single recorded drawing call
+typedef struct
+{
+	FBINK_CMD_TYPE_T type;
+	FBInkConfig      cfg;    // Unused for CMD_PIXEL
+	union
+	{
+		struct
+		{
+			char* string;
+		} text;
+		struct
+		{
+			FBInkRect  rect;    // An empty rect means full-screen, like with fbink_fill_rect
+			FBInkPixel px;
+			bool       no_rota;
+		} rect;
+		struct
+		{
+			uint16_t   x;
+			uint16_t   y;
+			FBInkPixel px;
+		} pixel;
+		struct
+		{
+			char*     filename;
+			short int x_off;
+			short int y_off;
+		} image;
+		struct
+		{
+			unsigned char* data;
+			size_t         len;
+			int            w;
+			int            h;
+			short int      x_off;
+			short int      y_off;
+		} raw;
+	};
+} FBInkCmd;
+
+struct FBInkCmdList
+{
+	FBInkCmd* cmds;
+	size_t    count;
+	size_t    capacity;
+};
+
+#if defined(FBINK_WITH_BITMAP) || defined(FBINK_WITH_DRAW) || defined(FBINK_WITH_IMAGE)
+static FBInkCmd* cmdlist_append(FBInkCmdList* restrict, FBINK_CMD_TYPE_T, const FBInkConfig* restrict);
+#endif
+static void      free_cmd(FBInkCmd* restrict);
+static int       exec_cmd(int, const FBInkCmd* restrict, const FBInkConfig* restrict, FBInkRect* restrict);
+
+#endif
@@ -0,0 +1,202 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_fontpack.h"
+
+#ifdef FBINK_WITH_BITMAP
+// Unmap the current font pack, if any
+static void
+    release_font_pack(void)
+{
+	if (fontPack.map) {
+		munmap((void*) (uintptr_t) fontPack.map, fontPack.size);
+		LOG("Released font pack `%s`", fontPack.name);
+	}
+	free(fontPack.ranges);
+	free(fontPack.request);
+	fontPack = (FBInkFontPack){ 0 };
+}
+
+// Map a font pack read-only, either from a path, or by name from FBINK_FONTPACK_DIR (or FONTPACK_DIR).
+// NOTE: Glyphs are paged in by the kernel as they're used, and the page cache is shared by everyone using the same pack.
+//       That mapping is kept around until a different pack (or none at all) is requested by a later fbink_init.
+static int
+    load_font_pack(const char* request)
+{
+	// Same pack as last time? Nothing to do.
+	if (fontPack.map && strcmp(fontPack.request, request) == 0) {
+		return EXIT_SUCCESS;
+	}
+	release_font_pack();
+
+	char path[PATH_MAX];
+	int  len;
+	if (strchr(request, '/')) {
+		len = snprintf(path, sizeof(path), "%s", request);
+	} else {
+		const char* dir = getenv("FBINK_FONTPACK_DIR");
+		len             = snprintf(path,
+					   sizeof(path),
+					   "%s/%s%s",
+					   dir ? dir : FONTPACK_DIR,
+					   request,
+					   FONTPACK_EXT);
+	}
+	if (len < 0 || (size_t) len >= sizeof(path)) {
+		WARN("Font pack path for `%s` is too long", request);
+		return ERRCODE(ENAMETOOLONG);
+	}
+
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		PFWARN("open: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		PFWARN("fstat: %m");
+		close(fd);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	const size_t size = (size_t) st.st_size;
+	if (size < sizeof(FBInkFontPackHeader)) {
+		WARN("File `%s` is too small to be a font pack", path);
+		close(fd);
+		return ERRCODE(EINVAL);
+	}
+	const unsigned char* map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	// The mapping holds its own reference to the file
+	close(fd);
+	if (map == MAP_FAILED) {
+		PFWARN("mmap: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Validate everything before trusting a single offset
+	const FBInkFontPackHeader* hdr = (const FBInkFontPackHeader*) (const void*) map;
+	if (memcmp(hdr->magic, FONTPACK_MAGIC, sizeof(hdr->magic)) != 0 || hdr->version != FONTPACK_VERSION) {
+		WARN("File `%s` is not a supported font pack", path);
+		goto invalid;
+	}
+	const uint8_t row_size = hdr->width <= 8U ? 1U : hdr->width <= 16U ? 2U : 4U;
+	if (hdr->width == 0U || hdr->width > FONTPACK_MAX_SIZE || hdr->height == 0U || hdr->height > FONTPACK_MAX_SIZE ||
+	    hdr->row_size != row_size || hdr->range_count == 0U) {
+		WARN("Font pack `%s` has unsupported metrics (%hhux%hhu, %hhu bytes per row, %u ranges)",
+		     path,
+		     hdr->width,
+		     hdr->height,
+		     hdr->row_size,
+		     hdr->range_count);
+		goto invalid;
+	}
+	// NOTE: 64-bit maths, so that bogus counts can't wrap around on 32-bit platforms
+	const size_t   glyph_size   = (size_t) hdr->height * row_size;
+	const uint64_t ranges_end   = sizeof(*hdr) + ((uint64_t) hdr->range_count * sizeof(FBInkFontPackRange));
+	const uint64_t glyphs_start = ALIGN(ranges_end, (uint64_t) 4U);
+	if (glyphs_start + ((uint64_t) hdr->glyph_count * glyph_size) > size) {
+		WARN("Font pack `%s` is truncated", path);
+		goto invalid;
+	}
+
+	// Resolve the ranges against our mapping, so that lookups can go through font_lookup_glyph
+	FBInkGlyphRange* ranges = calloc(hdr->range_count, sizeof(*ranges));
+	if (!ranges) {
+		PFWARN("Error allocating font pack ranges: %m");
+		munmap((void*) (uintptr_t) map, size);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	const FBInkFontPackRange* src = (const FBInkFontPackRange*) (const void*) (map + sizeof(*hdr));
+	for (uint32_t i = 0U; i < hdr->range_count; i++) {
+		if (src[i].first > src[i].last || (i > 0U && src[i].first <= src[i - 1U].last) ||
+		    (uint64_t) src[i].glyph + (src[i].last - src[i].first) >= hdr->glyph_count) {
+			WARN("Font pack `%s` has an invalid range (#%u: U+%04X to U+%04X)",
+			     path,
+			     i,
+			     src[i].first,
+			     src[i].last);
+			free(ranges);
+			goto invalid;
+		}
+		ranges[i] = (FBInkGlyphRange){
+			.first  = src[i].first,
+			.last   = src[i].last,
+			.glyphs = map + (size_t) glyphs_start + ((size_t) src[i].glyph * glyph_size),
+		};
+	}
+
+	fontPack = (FBInkFontPack){
+		.map         = map,
+		.size        = size,
+		.ranges      = ranges,
+		.range_count = hdr->range_count,
+		.glyph_size  = glyph_size,
+		.width       = hdr->width,
+		.height      = hdr->height,
+		.request     = strdup(request),
+	};
+	if (!fontPack.request) {
+		PFWARN("strdup: %m");
+		release_font_pack();
+		return ERRCODE(EXIT_FAILURE);
+	}
+	const char* slash = strrchr(fontPack.request, '/');
+	fontPack.name     = slash ? slash + 1 : fontPack.request;
+	ELOG("Loaded font pack `%s` (%hhux%hhu, %u glyphs)", fontPack.name, hdr->width, hdr->height, hdr->glyph_count);
+
+	return EXIT_SUCCESS;
+
+invalid:
+	munmap((void*) (uintptr_t) map, size);
+	return ERRCODE(EINVAL);
+}
+
+static const void*
+    font_pack_lookup(uint32_t codepoint)
+{
+	const void* bitmap = font_lookup_glyph(fontPack.ranges, fontPack.range_count, codepoint, fontPack.glyph_size);
+	if (likely(bitmap)) {
+		return bitmap;
+	}
+
+	WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
+	return fontPack.ranges[0].glyphs;
+}
+
+// The flavors we plug into fxpFont*GetBitmap, depending on the pack's glyph width
+static const unsigned char*
+    font_pack_get_bitmap8(uint32_t codepoint)
+{
+	return font_pack_lookup(codepoint);
+}
+
+static const uint16_t*
+    font_pack_get_bitmap16(uint32_t codepoint)
+{
+	return font_pack_lookup(codepoint);
+}
+
+static const uint32_t*
+    font_pack_get_bitmap32(uint32_t codepoint)
+{
+	return font_pack_lookup(codepoint);
+}
+#endif    // FBINK_WITH_BITMAP
@@ -0,0 +1,74 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_FONTPACK_H
+#define __FBINK_FONTPACK_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+#ifdef FBINK_WITH_BITMAP
+// On-disk layout of a bitmap font pack (c.f., tools/hextopack.py), everything is little-endian:
+//   FBInkFontPackHeader
+//   FBInkFontPackRange[range_count], sorted by codepoint
+//   Padding up to a 4 bytes boundary
+//   glyph_count glyphs of height rows of row_size bytes each (bit n of a row is column n, like in fonts/*.h)
+#	define FONTPACK_MAGIC   "FBINKFNT"
+#	define FONTPACK_VERSION 1U
+// Where we look for packs requested by name (i.e., without a /), unless FBINK_FONTPACK_DIR is set in the env
+#	ifndef FONTPACK_DIR
+#		define FONTPACK_DIR "/usr/share/fbink/fonts"
+#	endif
+// Which we append this to
+#	define FONTPACK_EXT ".fbf"
+// NOTE: Our glyph helpers (c.f., glyph_cover_fetch) deal with rows as uint32_t, so, that's our upper bound, both ways.
+#	define FONTPACK_MAX_SIZE 32U
+
+typedef struct
+{
+	char     magic[8];
+	uint16_t version;
+	uint8_t  width;
+	uint8_t  height;
+	uint8_t  row_size;
+	uint8_t  reserved[3];
+	uint32_t range_count;
+	uint32_t glyph_count;
+} FBInkFontPackHeader;
+
+typedef struct
+{
+	uint32_t first;
+	uint32_t last;
+	uint32_t glyph;    // Index of first's glyph
+} FBInkFontPackRange;
+
+static int                  load_font_pack(const char*);
+static void                 release_font_pack(void);
+static const void*          font_pack_lookup(uint32_t);
+static const unsigned char* font_pack_get_bitmap8(uint32_t) __attribute__((pure));
+static const uint16_t*      font_pack_get_bitmap16(uint32_t) __attribute__((pure));
+static const uint32_t*      font_pack_get_bitmap32(uint32_t) __attribute__((pure));
+#endif    // FBINK_WITH_BITMAP
+
+#endif
@@ -137,6 +137,39 @@
 #	define unlikely(x) __builtin_expect(!!(x), 0)
 #endif
 
+// Vector extensions for our span fills & the blit engine (c.f., fill_span16, fill_span32 & blit_copy).
+// NOTE: Much like in QImageScale, the flavor is picked at build time, depending on the target ISA,
+//       and it can be forcibly disabled by defining FBINK_NO_SIMD.
+#ifndef FBINK_NO_SIMD
+#	if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#		include <arm_neon.h>
+#		define FBINK_SIMD_NEON
+#		define FBINK_SIMD_BYTES 16U
+typedef uint8x16_t fbink_vec_t;
+#	elif defined(__AVX2__)
+#		include <immintrin.h>
+#		define FBINK_SIMD_AVX2
+#		define FBINK_SIMD_BYTES  32U
+#		define FBINK_SIMD_STREAM
+typedef __m256i fbink_vec_t;
+#	elif defined(__SSE2__)
+#		include <emmintrin.h>
+#		define FBINK_SIMD_SSE2
+#		define FBINK_SIMD_BYTES  16U
+#		define FBINK_SIMD_STREAM
+typedef __m128i fbink_vec_t;
+#	endif
+#endif
+
+// Bulk fb writes are issued in bursts of a full cache line (c.f., blit_fill_vec & blit_copy).
+// NOTE: FBINK_SIMD_STREAM flags ISAs with non-temporal stores, which bypass the cache entirely.
+//       arm_neon.h doesn't expose anything of the sort (STNP is asm-only), so, on ARM, we only get the bursts.
+#define BLIT_BURST_BYTES 64U
+
+// Glyphs that can't be tiled with at most that many rectangles go through the per-row stripes path (c.f., draw).
+// NOTE: Needed by FBInkGlyphCover, hence it living up here.
+#define GLYPH_COVER_MAX_RECTS 64U
+
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
@@ -250,23 +283,73 @@
 
 // Speaking of, include the Unscii variants when we're not a minimal build
 #ifdef FBINK_WITH_FONTS
-#	include "fbink_unscii.h"
-#	include "fbink_block.h"
-#	include "fbink_leggie.h"
-#	include "fbink_orp.h"
-#	include "fbink_scientifica.h"
-#	include "fbink_terminus.h"
-#	include "fbink_fatty.h"
-#	include "fbink_spleen.h"
-#	include "fbink_tewi.h"
-#	include "fbink_misc_fonts.h"
-#	include "fbink_topaz.h"
-#	include "fbink_microknight.h"
-#	include "fbink_vga.h"
+// Unless the build picked specific ones (c.f., BITMAP_FONTS in the Makefile), we ship every font (save for Unifont).
+// NOTE: If the build also asked for a subset of their glyphs (c.f., FONT_RANGES in the Makefile),
+//       the glyph tables are generated by tools/hextoc.py in the build directory (as fonts_subset/*.h),
+//       and FBINK_FONTS_SUBSET is set so that we pick those up instead of the full ones from fonts/.
+#	ifndef FBINK_WITH_FONTS_SELECTION
+#		define FBINK_WITH_FONT_UNSCII
+#		define FBINK_WITH_FONT_BLOCK
+#		define FBINK_WITH_FONT_LEGGIE
+#		define FBINK_WITH_FONT_KATES
+#		define FBINK_WITH_FONT_FKP
+#		define FBINK_WITH_FONT_CTRLD
+#		define FBINK_WITH_FONT_ORP
+#		define FBINK_WITH_FONT_SCIENTIFICA
+#		define FBINK_WITH_FONT_TERMINUS
+#		define FBINK_WITH_FONT_FATTY
+#		define FBINK_WITH_FONT_SPLEEN
+#		define FBINK_WITH_FONT_TEWI
+#		define FBINK_WITH_FONT_TOPAZ
+#		define FBINK_WITH_FONT_MICROKNIGHT
+#		define FBINK_WITH_FONT_VGA
+#		define FBINK_WITH_FONT_COZETTE
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII
+#		include "fbink_unscii.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_BLOCK
+#		include "fbink_block.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_LEGGIE
+#		include "fbink_leggie.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_ORP
+#		include "fbink_orp.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_SCIENTIFICA
+#		include "fbink_scientifica.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_TERMINUS
+#		include "fbink_terminus.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_FATTY
+#		include "fbink_fatty.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_SPLEEN
+#		include "fbink_spleen.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_TEWI
+#		include "fbink_tewi.h"
+#	endif
+#	if defined(FBINK_WITH_FONT_KATES) || defined(FBINK_WITH_FONT_FKP) || defined(FBINK_WITH_FONT_CTRLD)
+#		include "fbink_misc_fonts.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_TOPAZ
+#		include "fbink_topaz.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_MICROKNIGHT
+#		include "fbink_microknight.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_VGA
+#		include "fbink_vga.h"
+#	endif
 #	ifdef FBINK_WITH_UNIFONT
 #		include "fbink_unifont.h"
 #	endif
-#	include "fbink_cozette.h"
+#	ifdef FBINK_WITH_FONT_COZETTE
+#		include "fbink_cozette.h"
+#	endif
 #endif
 
 // NOTE: CLOEXEC shenanigans...
@@ -540,12 +623,23 @@ void (*fxpFillRectChecked)(unsigned short int,
 			   unsigned short int,
 			   unsigned short int,
 			   const FBInkPixel* restrict)                      = NULL;
+// The format-specialized copies of our hot renderers
+void (*fxpPlotGlyphRow)(uint32_t,
+			unsigned short int,
+			unsigned short int,
+			const FBInkPixel* restrict,
+			const FBInkPixel* restrict,
+			bool,
+			bool)                                               = NULL;
+#ifdef FBINK_WITH_OPENTYPE
+void (*fxpPaintOTLine)(const FBInkOTPaint* restrict) = NULL;
+#endif
 // As well as the appropriate coordinates rotation functions...
 void (*fxpRotateCoords)(FBInkCoordinates* restrict)                         = NULL;
 void (*fxpRotateRegion)(struct mxcfb_rect* restrict)                        = NULL;
 // And the font bitmap getter...
 const unsigned char* (*fxpFont8xGetBitmap)(uint32_t)                        = NULL;
-#ifdef FBINK_WITH_FONTS
+#ifdef FBINK_WITH_BITMAP
 const uint16_t* (*fxpFont16xGetBitmap)(uint32_t) = NULL;
 const uint32_t* (*fxpFont32xGetBitmap)(uint32_t) = NULL;
 //const uint64_t* (*fxpFont64xGetBitmap)(uint32_t) = NULL;
@@ -562,10 +656,56 @@ FBInkDeviceQuirks deviceQuirks = { 0 };
 // Where we track the last drawn rectangle
 FBInkRect lastRect = { 0 };
 
+// Where we accumulate the regions drawn to since the last fbink_refresh_damage call
+#define DAMAGE_MAX_RECTS 32U
+FBInkRect damageRects[DAMAGE_MAX_RECTS] = { 0 };
+uint8_t   damageCount                   = 0U;
+
+// Where we track the shadow buffer, if any
+FBInkShadowFb shadowFb = { 0 };
+// Size (in pixels, both ways) of the tiles used for its dirty tracking
+#define SHADOW_TILE_SIZE 64U
+
+#ifdef FBINK_WITH_DRAW
+// How many threads we're allowed to split large draws across (c.f., run_bands)
+uint8_t workerThreads = 1U;
+#endif
+
+#ifdef FBINK_WITH_BITMAP
+// Where we keep pre-rendered glyph cells for the fixed-cell renderer (c.f., draw)
+FBInkGlyphCache glyphCache = { 0 };
+// Memory budget of the cache, which sets the amount of slots (capped to GLYPH_CACHE_MAX_SLOTS) for a given cell size
+#	define GLYPH_CACHE_BYTES     (256U * 1024U)
+#	define GLYPH_CACHE_MAX_SLOTS 256U
+// Below that, cells are so large that caching them would mostly thrash, so we just don't
+#	define GLYPH_CACHE_MIN_SLOTS 16U
+// Where we keep the rectangle decomposition of recently drawn glyphs, for when the cells themselves can't be cached
+#	define GLYPH_COVER_SLOTS 128U
+FBInkGlyphCover glyphCovers[GLYPH_COVER_SLOTS] = { 0 };
+// The bitmap font pack currently in use, if any (c.f., FBInkConfig's font_pack)
+FBInkFontPack fontPack = { 0 };
+#endif
+
 #ifdef FBINK_WITH_OPENTYPE
+// Default memory budget of the OpenType glyph cache, which can be changed at runtime via fbink_set_ot_cache_budget
+#	define OT_CACHE_BYTES (1024U * 1024U)
+// Power of two
+#	define OT_CACHE_BUCKETS 1024U
+// Amount of kerning pairs we remember, direct-mapped (power of two)
+#	define OT_KERN_SLOTS 512U
+// Geometry of the per-face cmap lookup tables (c.f., ot_face_glyph_index), covering the full Unicode range
+#	define OT_CMAP_PAGE_SIZE  256U
+#	define OT_CMAP_PAGES      (0x110000U / OT_CMAP_PAGE_SIZE)
+// Marks a codepoint we haven't looked up yet (can't be a valid glyph index, as there are at most 65535 glyphs)
+#	define OT_CMAP_UNRESOLVED 0xFFFFu
 // Information about the currently loaded OpenType font
 bool         otInit  = false;
 FBInkOTFonts otFonts = { NULL, NULL, NULL, NULL };
+// Every font currently loaded, by anyone (i.e., the global pool & every FBInkOTConfig), keyed by inode
+FBInkOTFace* otFaces = NULL;
+// Where we keep rendered glyphs across fbink_print_ot calls (c.f., ot_cache_fetch & fbink_set_ot_cache_budget)
+FBInkOTCache otCache = { .budget = OT_CACHE_BYTES };
+FBInkOTKern  otKerns[OT_KERN_SLOTS] = { 0 };
 #endif
 
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
@@ -579,6 +719,19 @@ static void rotate_touch_coordinates(FBInkCoordinates* restrict);
 #endif
 static void rotate_coordinates_nop(FBInkCoordinates* restrict __attribute__((unused)));
 
+static inline __attribute__((always_inline)) bool blit_wants_stream(void);
+static inline __attribute__((always_inline)) void blit_fence(bool);
+#ifdef FBINK_SIMD_BYTES
+static inline __attribute__((always_inline, hot)) void        blit_store_vec(unsigned char*, fbink_vec_t, bool);
+static inline __attribute__((always_inline, hot)) fbink_vec_t blit_load_vec(const unsigned char*);
+static inline __attribute__((always_inline, hot)) size_t      blit_fill_vec(unsigned char* restrict,
+									    fbink_vec_t,
+									    size_t,
+									    bool);
+#endif
+static inline __attribute__((always_inline, hot)) void
+    blit_copy(unsigned char* restrict, const unsigned char* restrict, size_t, bool);
+
 // NOTE: Making sure most of those are inlined helps fbink_print_ot (c.f., #43).
 #ifdef FBINK_WITH_DRAW
 static inline __attribute__((const, always_inline, hot)) uint16_t pack_bgr565(uint8_t, uint8_t, uint8_t);
@@ -602,6 +755,7 @@ static inline __attribute__((always_inline, hot)) void put_pixel_RGB565(const FB
 // NOTE: We pass coordinates by value here, because a rotation transformation *may* be applied to them,
 //       and that's a rotation that the caller will *never* care about.
 static inline __attribute__((always_inline, hot)) void put_pixel(FBInkCoordinates, const FBInkPixel* restrict, bool);
+static __attribute__((hot)) void put_pixels(const uint16_t* restrict, size_t, const FBInkPixel*, const uint8_t* restrict);
 // NOTE: On the other hand, if you happen to be calling function pointers directly,
 //       it's left to you to not do anything stupid ;)
 
@@ -619,6 +773,24 @@ static inline __attribute__((always_inline, hot)) void get_pixel_RGB565(const FB
 									FBInkPixel* restrict);
 // NOTE: Same as put_pixel ;)
 static inline __attribute__((always_inline, hot)) void get_pixel(FBInkCoordinates, FBInkPixel* restrict);
+
+// Format-specialized variants, only meant to be called with a constant pixel format (c.f., fxpPlotGlyphRow)
+static inline __attribute__((always_inline, hot)) void
+    put_pixel_fmt(FBInkCoordinates, const FBInkPixel* restrict, bool, FBINK_PXFMT_INDEX_T);
+static inline __attribute__((always_inline, hot)) void get_pixel_fmt(FBInkCoordinates,
+								     FBInkPixel* restrict,
+								     FBINK_PXFMT_INDEX_T);
+static inline __attribute__((always_inline, hot)) void plot_glyph_row(uint32_t,
+								      unsigned short int,
+								      unsigned short int,
+								      const FBInkPixel* restrict,
+								      const FBInkPixel* restrict,
+								      bool,
+								      bool,
+								      FBINK_PXFMT_INDEX_T);
+#	ifdef FBINK_WITH_OPENTYPE
+static inline __attribute__((always_inline, hot)) void paint_ot_line(const FBInkOTPaint* restrict, FBINK_PXFMT_INDEX_T);
+#	endif
 #endif    // FBINK_WITH_DRAW
 
 #if defined(FBINK_WITH_IMAGE) || defined(FBINK_WITH_OPENTYPE)
@@ -646,6 +818,9 @@ static inline __attribute__((always_inline, hot)) void get_pixel(FBInkCoordinate
 #ifdef FBINK_WITH_DRAW
 // NOTE: Enforced inlining on fill_rect currently doesn't gain us anything, on the other hand.
 //       Which is why we went with a function pointer to bitdepth-specific branchless variants ;).
+static inline __attribute__((always_inline, hot)) void fill_span8(uint8_t* restrict, uint8_t, size_t, bool);
+static inline __attribute__((always_inline, hot)) void fill_span16(uint16_t* restrict, uint16_t, size_t, bool);
+static inline __attribute__((always_inline, hot)) void fill_span32(uint32_t* restrict, uint32_t, size_t, bool);
 static __attribute__((hot)) void fill_rect_Gray4(unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
@@ -696,6 +871,7 @@ static __attribute__((hot)) void fill_rect_RGB32_checked(unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 const FBInkPixel* restrict);
+static void                      fill_fb_band(const void*, uint32_t, uint32_t);
 static void                      clear_screen(int UNUSED_BY_NOTKINDLE, FBInkPixel*, bool UNUSED_BY_NOTKINDLE);
 //static void checkerboard_screen(void);
 #endif    // FBINK_WITH_DRAW
@@ -703,18 +879,48 @@ static void                      clear_screen(int UNUSED_BY_NOTKINDLE, FBInkPixe
 #ifdef FBINK_WITH_BITMAP
 static const unsigned char* font8x8_get_bitmap(uint32_t);
 #endif
+#ifdef FBINK_WITH_BITMAP
+static const void* font_lookup_glyph(const FBInkGlyphRange* restrict, size_t, uint32_t, size_t) __attribute__((pure));
+#endif
 
 static __attribute__((cold)) const char* fontname_to_string(uint8_t);
+static __attribute__((cold)) const char* current_font_name(const FBInkConfig* restrict);
 
 #ifdef FBINK_WITH_BITMAP
 static int zu_print_length(size_t);
 
+static void                                      glyph_cache_reset(void);
+static void                                      glyph_cache_setup(void);
+static __attribute__((hot)) const unsigned char* glyph_cache_fetch(const void* restrict,
+								   const FBInkPixel* restrict,
+								   const FBInkPixel* restrict);
+static __attribute__((hot)) void glyph_cache_blit(const unsigned char* restrict, unsigned short int, unsigned short int);
+static __attribute__((hot)) const FBInkGlyphCover* glyph_cover_fetch(const void*);
+static __attribute__((hot)) void                   draw_glyph_cover(const FBInkGlyphCover* restrict,
+								    unsigned short int,
+								    unsigned short int,
+								    const FBInkPixel* restrict,
+								    const FBInkPixel* restrict);
+
 static struct mxcfb_rect draw(const char* restrict,
+			      const uint32_t* restrict,
+			      size_t,
 			      unsigned short int,
 			      unsigned short int,
 			      unsigned short int,
 			      bool,
 			      const FBInkConfig* restrict);
+
+static void      layout_cells(FBInkCellLayout* restrict,
+			      const char* restrict,
+			      size_t,
+			      size_t,
+			      const FBInkConfig* restrict);
+static size_t    next_cell_line(FBInkCellLayout* restrict,
+				char* restrict,
+				uint32_t* restrict,
+				const FBInkConfig* restrict);
+static FBInkRect cell_line_rect(const FBInkCellLayout* restrict, size_t, const FBInkConfig* restrict);
 #endif
 
 #ifndef FBINK_FOR_LINUX
@@ -788,7 +994,19 @@ static __attribute__((cold)) const char* sunxi_force_rota_to_string(SUNXI_FORCE_
 #endif
 static __attribute__((cold)) int initialize_fbink(int, const FBInkConfig* restrict, bool);
 
-static int memmap_fb(int);
+static inline __attribute__((always_inline, hot)) void xor_span(uint8_t*, const uint8_t*, size_t, uint32_t);
+static uint32_t                                         fb_inversion_mask(void);
+static inline __attribute__((always_inline)) void       copy_shadow_span(unsigned char* restrict,
+									const unsigned char* restrict,
+									size_t,
+									bool);
+static void setup_shadow_fb(void);
+static void damage_full_shadow_fb(void);
+static void update_shadow_fb_inversion(void);
+static void damage_shadow_fb(const struct mxcfb_rect* restrict);
+static void flush_shadow_fb(void);
+static void release_shadow_fb(void);
+static int  memmap_fb(int);
 #ifdef FBINK_FOR_KOBO
 static void yield_to_sunxi_disp(void);
 static int  memmap_ion(void);
@@ -810,11 +1028,24 @@ static void fullscreen_region(struct mxcfb_rect* restrict);
 
 #ifdef FBINK_WITH_DRAW
 static int fill_rect(int, const FBInkConfig* restrict, const FBInkRect* restrict, const FBInkPixel* restrict, bool);
+
+static inline __attribute__((always_inline)) uint8_t get_nibble(const uint8_t*, uint32_t);
+static inline __attribute__((always_inline)) void    set_nibble(uint8_t*, uint32_t, uint8_t);
+static bool                                          is_region_in_fb(const struct mxcfb_rect* restrict);
+static int move_fb_region(const struct mxcfb_rect* restrict, uint32_t, uint32_t);
+static int copy_rect(const FBInkRect* restrict, unsigned short int, unsigned short int, struct mxcfb_rect* restrict);
 #endif
 
+static unsigned short int cell_pen_offsets(bool, const FBInkConfig* restrict, short int* restrict, short int* restrict);
 static int grid_to_region(int, unsigned short int, unsigned short int, bool, const FBInkConfig* restrict);
 
 static void set_last_rect(const struct mxcfb_rect* restrict);
+static void record_damage(const FBInkRect* restrict);
+static void merge_rects(FBInkRect* restrict, const FBInkRect* restrict);
+#ifndef FBINK_FOR_LINUX
+static bool are_rects_close(const FBInkRect* restrict, const FBInkRect* restrict, uint32_t);
+static void coalesce_damage(uint32_t);
+#endif
 
 #ifdef FBINK_WITH_BITMAP
 int draw_progress_bars(int, bool, uint8_t, const FBInkConfig* restrict);
@@ -827,6 +1058,33 @@ unsigned char*
 static unsigned char*               img_load_from_file(const char*, int* restrict, int* restrict, int* restrict, int);
 static unsigned char*               img_convert_px_format(const unsigned char* restrict, int, int, int, int);
 static __attribute__((hot)) uint8_t dither_o8x8(unsigned short int, unsigned short int, uint8_t);
+static void                         draw_image_band(const void*, uint32_t, uint32_t);
+// Width (in pixels) of the scanline chunks we convert on the stack before handing them to blit_copy
+#	define BLIT_LINE_PIXELS 256U
+#	if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
+// Size (in pixels, both ways) of the upright tiles we transpose to the fb when a rotation quirk is in effect
+#		define ROTA_TILE_SIZE 32U
+static void get_rotated_tile_mapping(unsigned short int,
+				     unsigned short int,
+				     FBInkCoordinates* restrict,
+				     int* restrict,
+				     int* restrict);
+static __attribute__((hot)) void blit_tile16_rotated(const uint16_t* restrict,
+						     size_t,
+						     unsigned short int,
+						     unsigned short int,
+						     unsigned short int,
+						     unsigned short int);
+#		ifdef FBINK_FOR_POCKETBOOK
+static __attribute__((hot)) void blit_tile8_rotated(const uint8_t* restrict,
+						    size_t,
+						    unsigned short int,
+						    unsigned short int,
+						    unsigned short int,
+						    unsigned short int);
+#		endif
+#	endif
+static uint8_t                      image_invert_mask(const FBInkConfig* restrict);
 static int                          draw_image(int,
 					       const unsigned char* restrict,
 					       const int,
@@ -836,14 +1094,60 @@ static int                          draw_image(int,
 					       short int,
 					       short int,
 					       const FBInkConfig* restrict);
+static int                          output_image(int,
+						 const unsigned char* restrict,
+						 const int,
+						 const int,
+						 const int,
+						 const int,
+						 short int,
+						 short int,
+						 const FBInkConfig* restrict,
+						 FBInkSprite* restrict);
+static int print_image(int, const char*, short int, short int, const FBInkConfig* restrict, FBInkSprite* restrict);
+static int print_raw_data(int,
+			  const unsigned char* restrict,
+			  const int,
+			  const int,
+			  const size_t,
+			  short int,
+			  short int,
+			  const FBInkConfig* restrict,
+			  FBInkSprite* restrict);
 #endif
 
 #ifdef FBINK_WITH_OPENTYPE
 static __attribute__((cold)) const char* font_style_to_string(FONT_STYLE_T);
-static __attribute__((cold)) int         add_ot_font(const char*, FONT_STYLE_T, FBInkOTFonts* restrict);
-static __attribute__((cold)) int         free_ot_font(stbtt_fontinfo** restrict);
+static __attribute__((cold)) int         add_ot_font(const char*, FONT_STYLE_T, FBInkOTFonts* restrict, bool);
+static __attribute__((cold)) int         free_ot_font(FBInkOTFace** restrict);
 static __attribute__((cold)) int         free_ot_fonts(FBInkOTFonts* restrict);
+static uint32_t                          ot_cache_hash(const stbtt_fontinfo*, int, float) __attribute__((const));
+static void                              ot_cache_drop(FBInkOTGlyph* restrict);
+static void                              ot_cache_trim(const FBInkOTGlyph*);
+static void                              ot_cache_purge(const stbtt_fontinfo*);
+static FBInkOTGlyph*                     ot_cache_fetch(const stbtt_fontinfo*, float, int);
+static const unsigned char*              ot_cache_bitmap(FBInkOTGlyph* restrict);
+static int                               ot_kern_advance(const stbtt_fontinfo*, int, int);
+static int                               ot_face_glyph_index(FBInkOTFace* restrict, uint32_t);
+static void                              shape_ot_glyph(FBInkOTRun* restrict,
+							FBInkOTFace* restrict,
+							float,
+							uint32_t,
+							const char* restrict,
+							size_t,
+							size_t);
 static void                              parse_simple_md(const char* restrict, size_t, unsigned char* restrict);
+static int                               ot_layout(const char* restrict,
+						   const FBInkOTConfig* restrict,
+						   FBInkOTFit* restrict,
+						   FBInkOTLayout* restrict);
+static void                              ot_layout_release(FBInkOTLayout* restrict);
+static int                               ot_render(int,
+						   const FBInkOTLayout* restrict,
+						   FBInkCoordinates,
+						   const FBInkConfig* restrict,
+						   FBInkOTFit* restrict,
+						   struct mxcfb_rect* restrict);
 static __attribute__((cold)) const char* glyph_style_to_string(CHARACTER_FONT_T);
 #endif
 
@@ -882,6 +1186,15 @@ static int dump_region(struct mxcfb_rect* region, FBInkDump* restrict dump);
 #	include "fbink_device_id.h"
 #endif
 
+// For run_bands, which we need outside of fbink_workers.c
+#include "fbink_workers.h"
+
+// For load_font_pack & friends, which we need outside of fbink_fontpack.c
+#include "fbink_fontpack.h"
+
+// For sprite_convert, which we need outside of fbink_sprite.c
+#include "fbink_sprite.h"
+
 // For the I²C stuff, which we need on Kobo (at least on Mk. 8 ;))
 #ifdef FBINK_FOR_KOBO
 #	include "fbink_rota_quirks.h"
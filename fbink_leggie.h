@@ -26,8 +26,13 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/leggie.h"
-#include "fonts/veggie.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/leggie.h"
+#	include "fonts_subset/veggie.h"
+#else
+#	include "fonts/leggie.h"
+#	include "fonts/veggie.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* leggie_get_bitmap(uint32_t codepoint) __attribute__((const));
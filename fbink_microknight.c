@@ -24,10 +24,12 @@
 static const unsigned char*
     microknight_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint <= 0xffu) {
-		return microknight_block1[codepoint];
-	} else {
-		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return microknight_block1[0];
+	const unsigned char* bitmap =
+	    font_lookup_glyph(microknight_ranges, ARRAY_SIZE(microknight_ranges), codepoint, sizeof(*microknight_block1));
+	if (likely(bitmap)) {
+		return bitmap;
 	}
+
+	WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
+	return microknight_block1[0];
 }
@@ -26,7 +26,11 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/microknight.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/microknight.h"
+#else
+#	include "fonts/microknight.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* microknight_get_bitmap(uint32_t codepoint) __attribute__((const));
@@ -26,13 +26,37 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/ctrld.h"
-#include "fonts/fkp.h"
-#include "fonts/kates.h"
+#ifdef FBINK_FONTS_SUBSET
+#	ifdef FBINK_WITH_FONT_CTRLD
+#		include "fonts_subset/ctrld.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_FKP
+#		include "fonts_subset/fkp.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_KATES
+#		include "fonts_subset/kates.h"
+#	endif
+#else
+#	ifdef FBINK_WITH_FONT_CTRLD
+#		include "fonts/ctrld.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_FKP
+#		include "fonts/fkp.h"
+#	endif
+#	ifdef FBINK_WITH_FONT_KATES
+#		include "fonts/kates.h"
+#	endif
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
+#ifdef FBINK_WITH_FONT_KATES
 static const unsigned char* kates_get_bitmap(uint32_t codepoint) __attribute__((const));
+#endif
+#ifdef FBINK_WITH_FONT_FKP
 static const unsigned char* fkp_get_bitmap(uint32_t codepoint) __attribute__((const));
+#endif
+#ifdef FBINK_WITH_FONT_CTRLD
 static const unsigned char* ctrld_get_bitmap(uint32_t codepoint) __attribute__((const));
+#endif
 
 #endif
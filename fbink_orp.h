@@ -26,9 +26,15 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/orp.h"
-#include "fonts/orpb.h"
-#include "fonts/orpi.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/orp.h"
+#	include "fonts_subset/orpb.h"
+#	include "fonts_subset/orpi.h"
+#else
+#	include "fonts/orp.h"
+#	include "fonts/orpb.h"
+#	include "fonts/orpi.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* orp_get_bitmap(uint32_t codepoint) __attribute__((const));
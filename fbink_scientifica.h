@@ -26,9 +26,15 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/scientifica.h"
-#include "fonts/scientificab.h"
-#include "fonts/scientificai.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/scientifica.h"
+#	include "fonts_subset/scientificab.h"
+#	include "fonts_subset/scientificai.h"
+#else
+#	include "fonts/scientifica.h"
+#	include "fonts/scientificab.h"
+#	include "fonts/scientificai.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* scientifica_get_bitmap(uint32_t codepoint) __attribute__((const));
@@ -0,0 +1,417 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+
+
+#include "fbink_sprite.h"
+
+FBInkSprite*
+    fbink_sprite_new_from_image(const char* filename                  UNUSED_BY_MINIMAL,
+				const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	FBInkSprite* sprite = calloc(1U, sizeof(*sprite));
+	if (!sprite) {
+		PFWARN("Error allocating sprite: %m");
+		return NULL;
+	}
+
+	// Same decoding & scaling as fbink_print_image, except the result ends up in the sprite instead of on screen
+	if (print_image(FBFD_AUTO, filename, 0, 0, fbink_cfg, sprite) != EXIT_SUCCESS) {
+		fbink_sprite_free(sprite);
+		return NULL;
+	}
+
+	return sprite;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return NULL;
+#endif
+}
+
+FBInkSprite*
+    fbink_sprite_new_from_raw_data(const unsigned char* restrict data    UNUSED_BY_MINIMAL,
+				   const int w                           UNUSED_BY_MINIMAL,
+				   const int h                           UNUSED_BY_MINIMAL,
+				   const size_t len                      UNUSED_BY_MINIMAL,
+				   const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	FBInkSprite* sprite = calloc(1U, sizeof(*sprite));
+	if (!sprite) {
+		PFWARN("Error allocating sprite: %m");
+		return NULL;
+	}
+
+	if (print_raw_data(FBFD_AUTO, data, w, h, len, 0, 0, fbink_cfg, sprite) != EXIT_SUCCESS) {
+		fbink_sprite_free(sprite);
+		return NULL;
+	}
+
+	return sprite;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return NULL;
+#endif
+}
+
+#ifdef FBINK_WITH_IMAGE
+// Convert decoded (and possibly scaled) image data to the fb's pixel format, once and for all.
+// Arguments follow draw_image's, and inversion & dithering are handled the same way.
+static int
+    sprite_convert(FBInkSprite* restrict sprite,
+		   const unsigned char* restrict data,
+		   const int w,
+		   const int h,
+		   const int n,
+		   const int req_n,
+		   const FBInkConfig* restrict fbink_cfg)
+{
+	const uint8_t             invert     = image_invert_mask(fbink_cfg);
+	// NOTE: Like in draw_image, we look at the *original* pixel format, because an alpha channel we had to add
+	//       for addressing purposes (e.g., RGB -> RGBA for QImageScale) is fully opaque anyway.
+	const bool                want_alpha = (n == 2 || n == 4) && !fbink_cfg->ignore_alpha;
+	const bool                dither     = fbink_cfg->sw_dithering;
+	const FBINK_PXFMT_INDEX_T pxfmt      = deviceQuirks.pixelFormat;
+	const size_t              stride     = (((size_t) w * vInfo.bits_per_pixel) + 7U) >> 3U;
+
+	unsigned char* pixels = calloc((size_t) h, stride);
+	if (!pixels) {
+		PFWARN("Error allocating sprite pixels: %m");
+		return ERRCODE(ENOMEM);
+	}
+
+	bool is_opaque = true;
+	for (unsigned short int j = 0U; j < h; j++) {
+		unsigned char* restrict row = pixels + (j * stride);
+		for (unsigned short int i = 0U; i < w; i++) {
+			const unsigned char* restrict px = data + ((((size_t) j * (size_t) w) + i) * (size_t) req_n);
+			if (want_alpha && px[req_n - 1] != 0xFFu) {
+				is_opaque = false;
+			}
+
+			if (pxfmt == FBINK_PXFMT_Y4 || pxfmt == FBINK_PXFMT_Y8) {
+				const uint8_t v = (uint8_t) (px[0] ^ invert);
+				if (pxfmt == FBINK_PXFMT_Y4) {
+					set_nibble(row, i, (uint8_t) ((dither ? dither_o8x8(i, j, v) : v) >> 4U));
+				} else {
+					row[i] = dither ? dither_o8x8(i, j, v) : v;
+				}
+				continue;
+			}
+
+			uint8_t r = (uint8_t) (px[0] ^ invert);
+			uint8_t g = (uint8_t) (px[1] ^ invert);
+			uint8_t b = (uint8_t) (px[2] ^ invert);
+			if (dither) {
+				r = dither_o8x8(i, j, r);
+				g = dither_o8x8(i, j, g);
+				b = dither_o8x8(i, j, b);
+			}
+			switch (pxfmt) {
+				case FBINK_PXFMT_BGR565: {
+					const uint16_t v = pack_bgr565(r, g, b);
+					memcpy(row + (i << 1U), &v, sizeof(v));
+					break;
+				}
+				case FBINK_PXFMT_RGB565: {
+					const uint16_t v = pack_rgb565(r, g, b);
+					memcpy(row + (i << 1U), &v, sizeof(v));
+					break;
+				}
+				case FBINK_PXFMT_BGR24:
+					memcpy(row + (i * 3U), (const uint8_t[]){ b, g, r }, 3U);
+					break;
+				case FBINK_PXFMT_RGB24:
+					memcpy(row + (i * 3U), (const uint8_t[]){ r, g, b }, 3U);
+					break;
+				case FBINK_PXFMT_BGRA:
+				case FBINK_PXFMT_BGR32:
+					memcpy(row + (i << 2U), (const uint8_t[]){ b, g, r, 0xFFu }, 4U);
+					break;
+				case FBINK_PXFMT_RGBA:
+				case FBINK_PXFMT_RGB32:
+				default:
+					memcpy(row + (i << 2U), (const uint8_t[]){ r, g, b, 0xFFu }, 4U);
+					break;
+			}
+		}
+	}
+
+	// Translucent pixels have to be blended with whatever's in the fb at blitting time,
+	// so, for those, we'll need to keep the source data around.
+	unsigned char* alpha = NULL;
+	if (!is_opaque) {
+		const size_t size = (size_t) w * (size_t) h * (size_t) req_n;
+		alpha             = malloc(size);
+		if (!alpha) {
+			PFWARN("Error allocating sprite alpha: %m");
+			free(pixels);
+			return ERRCODE(ENOMEM);
+		}
+		for (size_t k = 0U; k < size; k++) {
+			// Invert every component but the alpha one
+			const bool is_alpha = (k % (size_t) req_n) == (size_t) (req_n - 1);
+			alpha[k]            = is_alpha ? data[k] : (unsigned char) (data[k] ^ invert);
+		}
+	}
+	LOG("Converted a %dx%d %s sprite to %ubpp", w, h, is_opaque ? "opaque" : "translucent", vInfo.bits_per_pixel);
+
+	free(sprite->pixels);
+	free(sprite->alpha);
+	sprite->pixels       = pixels;
+	sprite->alpha        = alpha;
+	sprite->stride       = stride;
+	sprite->width        = (unsigned short int) w;
+	sprite->height       = (unsigned short int) h;
+	sprite->bpp          = vInfo.bits_per_pixel;
+	sprite->pxfmt        = pxfmt;
+	sprite->req_n        = (uint8_t) req_n;
+	sprite->sw_dithering = dither;
+
+	return EXIT_SUCCESS;
+}
+
+// Plot a single, fully opaque, pre-converted pixel @ (i, j) in the sprite to the fb (rotation & bounds-checking included)
+static void
+    sprite_plot_pixel(const FBInkSprite* restrict sprite,
+		      unsigned short int            i,
+		      unsigned short int            j,
+		      FBInkCoordinates              coords)
+{
+	const unsigned char* restrict row = sprite->pixels + (j * sprite->stride);
+	FBInkPixel                    px  = { 0U };
+	if (sprite->pxfmt == FBINK_PXFMT_Y4) {
+		px.gray8 = (uint8_t) (get_nibble(row, i) * 0x11u);
+	} else {
+		const size_t bytes = sprite->bpp >> 3U;
+		memcpy(&px, row + (i * bytes), bytes);
+	}
+	put_pixel_fmt(coords, &px, true, sprite->pxfmt);
+}
+
+// Alpha-blend a single translucent pixel @ (i, j) in the sprite with the fb (c.f., draw_image_band)
+static void
+    sprite_blend_pixel(const FBInkSprite* restrict sprite,
+		       unsigned short int            i,
+		       unsigned short int            j,
+		       FBInkCoordinates              coords)
+{
+	const unsigned char* restrict src = sprite->alpha + ((((size_t) j * sprite->width) + i) * sprite->req_n);
+	FBInkPixel bg_px = { 0U };
+	FBInkPixel px    = { 0U };
+	get_pixel_fmt(coords, &bg_px, sprite->pxfmt);
+
+	if (sprite->pxfmt == FBINK_PXFMT_Y4 || sprite->pxfmt == FBINK_PXFMT_Y8) {
+		const uint8_t ainv = src[1] ^ 0xFFu;
+		px.gray8           = (uint8_t) DIV255(((src[0] * src[1]) + (bg_px.gray8 * ainv)));
+		if (sprite->sw_dithering) {
+			px.gray8 = dither_o8x8(i, j, px.gray8);
+		}
+	} else {
+		const uint8_t ainv = src[3] ^ 0xFFu;
+		// NOTE: get_pixel_fmt unpacks BGR formats (including BGR565) to bgra, and RGB ones to rgba,
+		//       and put_pixel_fmt expects the same, so, just stick to the fb's own order.
+		if (deviceQuirks.isRGB) {
+			px.rgba.color.r = (uint8_t) DIV255(((src[0] * src[3]) + (bg_px.rgba.color.r * ainv)));
+			px.rgba.color.g = (uint8_t) DIV255(((src[1] * src[3]) + (bg_px.rgba.color.g * ainv)));
+			px.rgba.color.b = (uint8_t) DIV255(((src[2] * src[3]) + (bg_px.rgba.color.b * ainv)));
+		} else {
+			px.bgra.color.r = (uint8_t) DIV255(((src[0] * src[3]) + (bg_px.bgra.color.r * ainv)));
+			px.bgra.color.g = (uint8_t) DIV255(((src[1] * src[3]) + (bg_px.bgra.color.g * ainv)));
+			px.bgra.color.b = (uint8_t) DIV255(((src[2] * src[3]) + (bg_px.bgra.color.b * ainv)));
+		}
+		if (sprite->sw_dithering) {
+			// NOTE: Every channel goes through the same threshold, so, we don't care about the order here
+			px.bgra.color.r = dither_o8x8(i, j, px.bgra.color.r);
+			px.bgra.color.g = dither_o8x8(i, j, px.bgra.color.g);
+			px.bgra.color.b = dither_o8x8(i, j, px.bgra.color.b);
+		}
+		px.bgra.color.a = 0xFFu;
+	}
+	put_pixel_fmt(coords, &px, false, sprite->pxfmt);
+}
+#endif    // FBINK_WITH_IMAGE
+
+int
+    fbink_sprite_blit(int fbfd                              UNUSED_BY_MINIMAL,
+		      const FBInkSprite* restrict sprite    UNUSED_BY_MINIMAL,
+		      short int x                           UNUSED_BY_MINIMAL,
+		      short int y                           UNUSED_BY_MINIMAL,
+		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// The pixels are only valid for the pixel format they were converted to (e.g., no longer after a bitdepth switch)
+	if (sprite->bpp != vInfo.bits_per_pixel || sprite->pxfmt != deviceQuirks.pixelFormat) {
+		WARN("Sprite was converted for a %ubpp fb, but the fb is now %ubpp, it needs to be recreated",
+		     sprite->bpp,
+		     vInfo.bits_per_pixel);
+		return ERRCODE(ESTALE);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Like draw_image (w/o a row or column), x & y are relative to the viewport, as are the bounds we clip to.
+	const int view_x = viewHoriOrigin;
+	const int view_y = viewVertOrigin - viewVertOffset;
+	const int fb_x   = view_x + x;
+	const int fb_y   = view_y + y;
+	const int left   = MAX(fb_x, view_x);
+	const int top    = MAX(fb_y, view_y);
+	const int right  = MIN(fb_x + sprite->width, view_x + (int) viewWidth);
+	const int bottom = MIN(fb_y + sprite->height, view_y + (int) viewHeight);
+	if (left >= right || top >= bottom) {
+		LOG("Sprite @ (%hd, %hd) is entirely off-screen", x, y);
+		goto cleanup;
+	}
+	// And where that starts (and ends) in the sprite
+	const unsigned short int img_x_off  = (unsigned short int) (left - fb_x);
+	const unsigned short int img_y_off  = (unsigned short int) (top - fb_y);
+	const unsigned short int max_width  = (unsigned short int) (right - fb_x);
+	const unsigned short int max_height = (unsigned short int) (bottom - fb_y);
+
+	if (fxpRotateCoords == &rotate_coordinates_nop && sprite->pxfmt != FBINK_PXFMT_Y4) {
+		// Sprite scanlines map to fb scanlines, so, opaque runs are a straight copy
+		const size_t bytes  = sprite->bpp >> 3U;
+		const bool   stream = blit_wants_stream();
+		for (unsigned short int j = img_y_off; j < max_height; j++) {
+			const unsigned char* restrict src = sprite->pixels + (j * sprite->stride);
+			// NOTE: fb_x may be negative, so, we only ever index dst with fb_x + i (for i >= img_x_off)
+			unsigned char* restrict dst       = fbPtr + ((size_t) (fb_y + j) * fInfo.line_length);
+			if (!sprite->alpha) {
+				blit_copy(dst + ((size_t) (fb_x + img_x_off) * bytes),
+					  src + (img_x_off * bytes),
+					  (size_t) (max_width - img_x_off) * bytes,
+					  stream);
+				continue;
+			}
+
+			const unsigned char* restrict a =
+			    sprite->alpha + (((size_t) j * sprite->width) * sprite->req_n) + (sprite->req_n - 1U);
+			unsigned short int i = img_x_off;
+			while (i < max_width) {
+				const uint8_t alpha = a[i * sprite->req_n];
+				if (alpha == 0xFFu) {
+					const unsigned short int start = i;
+					while (i < max_width && a[i * sprite->req_n] == 0xFFu) {
+						i++;
+					}
+					blit_copy(dst + ((size_t) (fb_x + start) * bytes),
+						  src + (start * bytes),
+						  (size_t) (i - start) * bytes,
+						  stream);
+				} else {
+					if (alpha != 0U) {
+						const FBInkCoordinates coords = {
+							.x = (unsigned short int) (fb_x + i),
+							.y = (unsigned short int) (fb_y + j),
+						};
+						sprite_blend_pixel(sprite, i, j, coords);
+					}
+					i++;
+				}
+			}
+		}
+		blit_fence(stream);
+	} else {
+		// Rotation quirks (or nibbles) get in the way, go through put_pixel_fmt
+		for (unsigned short int j = img_y_off; j < max_height; j++) {
+			for (unsigned short int i = img_x_off; i < max_width; i++) {
+				const FBInkCoordinates coords = { .x = (unsigned short int) (fb_x + i),
+								  .y = (unsigned short int) (fb_y + j) };
+				const uint8_t          alpha =
+				    sprite->alpha
+					     ? sprite->alpha[((((size_t) j * sprite->width) + i) * sprite->req_n) +
+							     (sprite->req_n - 1U)]
+					     : 0xFFu;
+				if (alpha == 0xFFu) {
+					sprite_plot_pixel(sprite, i, j, coords);
+				} else if (alpha != 0U) {
+					sprite_blend_pixel(sprite, i, j, coords);
+				}
+			}
+		}
+	}
+
+	struct mxcfb_rect region = {
+		.top    = (uint32_t) top,
+		.left   = (uint32_t) left,
+		.width  = (uint32_t) (right - left),
+		.height = (uint32_t) (bottom - top),
+	};
+
+	// Handle the last rect stuff...
+	set_last_rect(&region);
+
+	// Rotate the region if need be...
+	(*fxpRotateRegion)(&region);
+
+	// Refresh screen
+	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+void
+    fbink_sprite_free(FBInkSprite* sprite)
+{
+	if (!sprite) {
+		return;
+	}
+
+	free(sprite->pixels);
+	free(sprite->alpha);
+	free(sprite);
+}
@@ -0,0 +1,57 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+
+
+#ifndef __FBINK_SPRITE_H
+#define __FBINK_SPRITE_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+struct FBInkSprite
+{
+	unsigned char*      pixels;    // height rows of stride bytes, already in the fb's pixel format (inverted & dithered)
+	unsigned char*      alpha;     // Straight source data (Y8A or RGBA, inverted), only kept if some pixels aren't opaque
+	size_t              stride;
+	unsigned short int  width;
+	unsigned short int  height;
+	uint32_t            bpp;    // Format the pixels were converted to, as we can't blit them to anything else
+	FBINK_PXFMT_INDEX_T pxfmt;
+	uint8_t             req_n;    // Components per pixel in alpha (i.e., 2 or 4)
+	bool                sw_dithering;
+};
+
+#ifdef FBINK_WITH_IMAGE
+static int sprite_convert(FBInkSprite* restrict,
+			  const unsigned char* restrict,
+			  const int,
+			  const int,
+			  const int,
+			  const int,
+			  const FBInkConfig* restrict);
+static void sprite_blend_pixel(const FBInkSprite* restrict, unsigned short int, unsigned short int, FBInkCoordinates);
+static void sprite_plot_pixel(const FBInkSprite* restrict, unsigned short int, unsigned short int, FBInkCoordinates);
+#endif
+
+#endif
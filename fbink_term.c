@@ -0,0 +1,404 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+
+
+#include "fbink_term.h"
+
+FBInkTerm*
+    fbink_term_new(void)
+{
+	FBInkTerm* term = calloc(1U, sizeof(*term));
+	if (!term) {
+		PFWARN("Error allocating terminal: %m");
+		return NULL;
+	}
+
+	// NOTE: The grid itself is only allocated on first use, because it depends on the font metrics at that point.
+	return term;
+}
+
+#ifdef FBINK_WITH_BITMAP
+// Make sure the grid matches the current MAXCOLS x MAXROWS (which may have changed since the last call,
+// e.g., after a fbink_init with a different fontmult).
+// Content is preserved where it still fits, but everything is flagged for redraw, since cells moved or changed size.
+static int
+    term_fit(FBInkTerm* restrict term)
+{
+	if (term->cells && term->cols == MAXCOLS && term->rows == MAXROWS) {
+		return EXIT_SUCCESS;
+	}
+
+	const size_t   count      = (size_t) MAXCOLS * MAXROWS;
+	FBInkTermCell* cells      = calloc(count, sizeof(*cells));
+	bool*          dirty_rows = calloc(MAXROWS, sizeof(*dirty_rows));
+	uint32_t*      codepoints = calloc(MAXCOLS, sizeof(*codepoints));
+	// NOTE: UTF-8 is at most 4 bytes per codepoint, plus the NUL
+	char*          line       = calloc(((size_t) MAXCOLS * 4U) + 1U, sizeof(*line));
+	if (!cells || !dirty_rows || !codepoints || !line) {
+		PFWARN("Error allocating terminal grid: %m");
+		free(cells);
+		free(dirty_rows);
+		free(codepoints);
+		free(line);
+		return ERRCODE(ENOMEM);
+	}
+
+	for (unsigned short int row = 0U; row < MAXROWS; row++) {
+		for (unsigned short int col = 0U; col < MAXCOLS; col++) {
+			FBInkTermCell* cell = &cells[(size_t) row * MAXCOLS + col];
+			if (row < term->rows && col < term->cols) {
+				*cell = term->cells[(size_t) row * term->cols + col];
+			} else {
+				cell->cp = 0x20u;
+				cell->fg = penFGPixel;
+				cell->bg = penBGPixel;
+			}
+			cell->dirty = true;
+		}
+		dirty_rows[row] = true;
+	}
+	LOG("Terminal grid is now %hux%hu (was %hux%hu)", MAXCOLS, MAXROWS, term->cols, term->rows);
+
+	free(term->cells);
+	free(term->dirty_rows);
+	free(term->codepoints);
+	free(term->line);
+	term->cells      = cells;
+	term->dirty_rows = dirty_rows;
+	term->codepoints = codepoints;
+	term->line       = line;
+	term->cols       = MAXCOLS;
+	term->rows       = MAXROWS;
+
+	return EXIT_SUCCESS;
+}
+
+// Update a single cell, which only needs to be redrawn if it actually changed
+static void
+    term_set_cell(FBInkTerm* restrict term,
+		  size_t   idx,
+		  uint32_t cp,
+		  const FBInkPixel* restrict fgP,
+		  const FBInkPixel* restrict bgP)
+{
+	FBInkTermCell* cell = &term->cells[idx];
+	if (cell->cp == cp && cell->fg.p == fgP->p && cell->bg.p == bgP->p) {
+		return;
+	}
+
+	cell->cp    = cp;
+	cell->fg    = *fgP;
+	cell->bg    = *bgP;
+	cell->dirty = true;
+
+	term->dirty_rows[idx / term->cols] = true;
+}
+#endif    // FBINK_WITH_BITMAP
+
+int
+    fbink_term_write(FBInkTerm* restrict term            UNUSED_BY_NOBITMAP,
+		     unsigned short int col              UNUSED_BY_NOBITMAP,
+		     unsigned short int row              UNUSED_BY_NOBITMAP,
+		     const char* restrict string         UNUSED_BY_NOBITMAP,
+		     const FBInkConfig* restrict fbink_cfg UNUSED_BY_NOBITMAP)
+{
+#ifdef FBINK_WITH_BITMAP
+	if (!u8_isvalid2(string)) {
+		PFWARN("Cannot print an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+	if (term_fit(term) != EXIT_SUCCESS) {
+		return ERRCODE(ENOMEM);
+	}
+	if (col >= term->cols || row >= term->rows) {
+		PFWARN("Cell %hux%hu is out of bounds (grid is %hux%hu)", col, row, term->cols, term->rows);
+		return ERRCODE(EINVAL);
+	}
+
+	FBInkPixel fgP = penFGPixel;
+	FBInkPixel bgP = penBGPixel;
+	if (fbink_cfg->is_inverted) {
+		fgP.p ^= 0x00FFFFFFu;
+		bgP.p ^= 0x00FFFFFFu;
+	}
+
+	// Like a terminal: wrap at the right edge, honor LFs, and stop at the bottom of the grid (no scrolling)
+	const size_t end = (size_t) term->cols * term->rows;
+	size_t       idx = (size_t) row * term->cols + col;
+	size_t       bi  = 0U;
+	int          n   = 0;
+	uint32_t     ch;
+	while (idx < end && (ch = u8_nextchar2(string, &bi)) != 0U) {
+		if (ch == 0x0Au) {
+			idx = ((idx / term->cols) + 1U) * term->cols;
+			continue;
+		}
+		term_set_cell(term, idx++, ch, &fgP, &bgP);
+		n++;
+	}
+
+	// We return the amount of cells written
+	return n;
+#else
+	WARN("Fixed cell font support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+int
+    fbink_term_clear(FBInkTerm* restrict term            UNUSED_BY_NOBITMAP,
+		     const FBInkConfig* restrict fbink_cfg UNUSED_BY_NOBITMAP)
+{
+#ifdef FBINK_WITH_BITMAP
+	if (term_fit(term) != EXIT_SUCCESS) {
+		return ERRCODE(ENOMEM);
+	}
+
+	FBInkPixel fgP = penFGPixel;
+	FBInkPixel bgP = penBGPixel;
+	if (fbink_cfg->is_inverted) {
+		fgP.p ^= 0x00FFFFFFu;
+		bgP.p ^= 0x00FFFFFFu;
+	}
+
+	// NOTE: We have no idea what's actually on screen, so this always repaints the full grid.
+	const size_t count = (size_t) term->cols * term->rows;
+	for (size_t i = 0U; i < count; i++) {
+		term->cells[i] = (FBInkTermCell){ .cp = 0x20u, .fg = fgP, .bg = bgP, .dirty = true };
+	}
+	memset(term->dirty_rows, true, term->rows * sizeof(*term->dirty_rows));
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Fixed cell font support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+#ifdef FBINK_WITH_BITMAP
+// Account for the span of dirty cells of a single row,
+// merging it with the previous area if it's on the row right above it and they overlap (or touch) horizontally.
+static void
+    term_add_rect(FBInkTermRect* restrict rects,
+		  size_t* restrict count,
+		  FBInkTermRect* restrict bbox,
+		  const FBInkTermRect* restrict span)
+{
+	if (bbox->cols == 0U) {
+		*bbox = *span;
+	} else {
+		const unsigned int left = MIN((unsigned int) bbox->col, (unsigned int) span->col);
+		const unsigned int top  = MIN((unsigned int) bbox->row, (unsigned int) span->row);
+		const unsigned int right =
+		    MAX((unsigned int) (bbox->col + bbox->cols), (unsigned int) (span->col + span->cols));
+		const unsigned int bottom =
+		    MAX((unsigned int) (bbox->row + bbox->rows), (unsigned int) (span->row + span->rows));
+		*bbox = (FBInkTermRect){ .col  = (unsigned short int) left,
+					 .row  = (unsigned short int) top,
+					 .cols = (unsigned short int) (right - left),
+					 .rows = (unsigned short int) (bottom - top) };
+	}
+
+	// We've already given up on keeping them apart
+	if (*count > TERM_MAX_REFRESHES) {
+		return;
+	}
+
+	if (*count > 0U) {
+		FBInkTermRect* last = &rects[*count - 1U];
+		if (last->row + last->rows == span->row && span->col <= last->col + last->cols &&
+		    last->col <= span->col + span->cols) {
+			const unsigned int left  = MIN((unsigned int) last->col, (unsigned int) span->col);
+			const unsigned int right =
+			    MAX((unsigned int) (last->col + last->cols), (unsigned int) (span->col + span->cols));
+			last->col  = (unsigned short int) left;
+			last->cols = (unsigned short int) (right - left);
+			last->rows = (unsigned short int) (last->rows + 1U);
+			return;
+		}
+	}
+
+	if (*count == TERM_MAX_REFRESHES) {
+		// Too many of them, flag it, and we'll just refresh the bounding box instead
+		*count = TERM_MAX_REFRESHES + 1U;
+		return;
+	}
+	rects[(*count)++] = *span;
+}
+#endif    // FBINK_WITH_BITMAP
+
+int
+    fbink_term_flush(int fbfd                              UNUSED_BY_NOBITMAP,
+		     FBInkTerm* restrict term              UNUSED_BY_NOBITMAP,
+		     const FBInkConfig* restrict fbink_cfg UNUSED_BY_NOBITMAP)
+{
+#ifdef FBINK_WITH_BITMAP
+	if (term_fit(term) != EXIT_SUCCESS) {
+		return ERRCODE(ENOMEM);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Cells are positioned on the grid as-is, and carry their own colors,
+	// so, none of the single string positioning & inversion trickery applies.
+	FBInkConfig cfg = *fbink_cfg;
+	cfg.col         = 0;
+	cfg.row         = 0;
+	cfg.is_halfway  = false;
+	cfg.is_centered = false;
+	cfg.is_padded   = false;
+	cfg.is_rpadded  = false;
+	cfg.is_inverted = false;
+
+	// We'll temporarily swap the pens for each run of cells
+	const FBInkPixel fgP = penFGPixel;
+	const FBInkPixel bgP = penBGPixel;
+
+	// Redraw each run of consecutive dirty cells sharing the same colors, and keep track of what to refresh
+	FBInkTermRect rects[TERM_MAX_REFRESHES] = { 0 };
+	FBInkTermRect bbox                      = { 0 };
+	size_t        count                     = 0U;
+	for (unsigned short int row = 0U; row < term->rows; row++) {
+		if (!term->dirty_rows[row]) {
+			continue;
+		}
+
+		FBInkTermCell*     cells = &term->cells[(size_t) row * term->cols];
+		unsigned short int first = term->cols;
+		unsigned short int last  = 0U;
+		unsigned short int col   = 0U;
+		while (col < term->cols) {
+			if (!cells[col].dirty) {
+				col++;
+				continue;
+			}
+
+			const unsigned short int start = col;
+			size_t                   n     = 0U;
+			penFGPixel                     = cells[col].fg;
+			penBGPixel                     = cells[col].bg;
+			while (col < term->cols && cells[col].dirty && cells[col].fg.p == penFGPixel.p &&
+			       cells[col].bg.p == penBGPixel.p) {
+				term->codepoints[n++] = cells[col].cp;
+				cells[col].dirty      = false;
+				col++;
+			}
+			term->line[u8_toutf8(term->line, (size_t) term->cols * 4U, term->codepoints, n)] = '\0';
+
+			struct mxcfb_rect region = draw(term->line, term->codepoints, n, row, start, 0U, false, &cfg);
+			// If we won't be refreshing, we still have to keep the shadow buffer in the loop
+			if (cfg.no_refresh) {
+				(*fxpRotateRegion)(&region);
+				damage_shadow_fb(&region);
+			}
+
+			first = (unsigned short int) MIN(first, start);
+			last  = (unsigned short int) (col - 1U);
+		}
+		term->dirty_rows[row] = false;
+
+		if (first <= last) {
+			const FBInkTermRect span = {
+				.col = first, .row = row, .cols = (unsigned short int) (last - first + 1U), .rows = 1U
+			};
+			term_add_rect(rects, &count, &bbox, &span);
+		}
+	}
+	penFGPixel = fgP;
+	penBGPixel = bgP;
+
+	if (count == 0U) {
+		LOG("Nothing to flush");
+		goto cleanup;
+	}
+	if (count > TERM_MAX_REFRESHES) {
+		LOG("Too many disjoint areas to refresh, refreshing their bounding box instead");
+		rects[0] = bbox;
+		count    = 1U;
+	}
+
+	if (!cfg.no_refresh) {
+		for (size_t i = 0U; i < count; i++) {
+			cfg.col = (short int) rects[i].col;
+			cfg.row = (short int) rects[i].row;
+			LOG("Refreshing %hux%hu cells @ %hu, %hu",
+			    rects[i].cols,
+			    rects[i].rows,
+			    rects[i].col,
+			    rects[i].row);
+			if (grid_to_region(fbfd, rects[i].cols, rects[i].rows, false, &cfg) != EXIT_SUCCESS) {
+				PFWARN("Failed to refresh the screen");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+		}
+	}
+
+	// On success, we return the amount of areas we refreshed
+	rv = (int) count;
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close_fb(fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Fixed cell font support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif
+}
+
+void
+    fbink_term_free(FBInkTerm* term)
+{
+	if (!term) {
+		return;
+	}
+
+	free(term->cells);
+	free(term->dirty_rows);
+	free(term->codepoints);
+	free(term->line);
+	free(term);
+}
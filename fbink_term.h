@@ -0,0 +1,72 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+
+
+#ifndef __FBINK_TERM_H
+#define __FBINK_TERM_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// A single cell of the grid
+typedef struct
+{
+	uint32_t   cp;
+	FBInkPixel fg;    // Pen colors at the time the cell was written (with is_inverted already applied)
+	FBInkPixel bg;
+	bool       dirty;
+} FBInkTermCell;
+
+// A rectangle of cells, for refresh purposes
+typedef struct
+{
+	unsigned short int col;
+	unsigned short int row;
+	unsigned short int cols;
+	unsigned short int rows;
+} FBInkTermRect;
+
+// Past that many disjoint areas to refresh in a single flush, we just refresh their bounding box instead
+#define TERM_MAX_REFRESHES 8U
+
+struct FBInkTerm
+{
+	FBInkTermCell*     cells;         // rows of cols cells
+	bool*              dirty_rows;    // So that flushes can skip over clean rows wholesale
+	uint32_t*          codepoints;    // Scratch buffer for a run of cells (i.e., at most cols codepoints)
+	char*              line;          // Ditto, but encoded back to UTF-8, for draw's logging
+	unsigned short int cols;
+	unsigned short int rows;
+};
+
+#ifdef FBINK_WITH_BITMAP
+static int  term_fit(FBInkTerm* restrict);
+static void term_set_cell(FBInkTerm* restrict, size_t, uint32_t, const FBInkPixel* restrict, const FBInkPixel* restrict);
+static void term_add_rect(FBInkTermRect* restrict,
+			  size_t* restrict,
+			  FBInkTermRect* restrict,
+			  const FBInkTermRect* restrict);
+#endif
+
+#endif
@@ -26,8 +26,13 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/terminus.h"
-#include "fonts/terminusb.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/terminus.h"
+#	include "fonts_subset/terminusb.h"
+#else
+#	include "fonts/terminus.h"
+#	include "fonts/terminusb.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* terminus_get_bitmap(uint32_t codepoint) __attribute__((const));
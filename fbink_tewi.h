@@ -26,8 +26,13 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/tewi.h"
-#include "fonts/tewib.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/tewi.h"
+#	include "fonts_subset/tewib.h"
+#else
+#	include "fonts/tewi.h"
+#	include "fonts/tewib.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* tewi_get_bitmap(uint32_t codepoint) __attribute__((const));
@@ -24,10 +24,12 @@
 static const unsigned char*
     topaz_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint <= 0xffu) {
-		return topaz_block1[codepoint];
-	} else {
-		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return topaz_block1[0];
+	const unsigned char* bitmap =
+	    font_lookup_glyph(topaz_ranges, ARRAY_SIZE(topaz_ranges), codepoint, sizeof(*topaz_block1));
+	if (likely(bitmap)) {
+		return bitmap;
 	}
+
+	WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
+	return topaz_block1[0];
 }
@@ -26,7 +26,11 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/topaz.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/topaz.h"
+#else
+#	include "fonts/topaz.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* topaz_get_bitmap(uint32_t codepoint) __attribute__((const));
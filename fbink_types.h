@@ -172,6 +172,136 @@ typedef union
 	} gray4;
 } FBInkPixel;
 
+// Bookkeeping for the optional shadow buffer (c.f., use_shadow_fb in FBInkConfig)
+typedef struct
+{
+	unsigned char* fb_mem;           // The actual fb mapping (while active, fbPtr points to our heap copy instead)
+	size_t         size;             // Size of both buffers, in bytes
+	uint32_t       line_length;      // fInfo.line_length when they were allocated
+	uint8_t*       dirty;            // One bit per tile, in tile rows of tiles_per_row tiles
+	uint32_t       tiles_per_row;
+	uint32_t       tile_rows;
+	bool           is_enabled;       // Requested via fbink_init
+	bool           want_inverted;    // Ditto (c.f., is_shadow_inverted)
+	bool           is_inverted;      // Whether the fb currently holds the inverse of our copy
+} FBInkShadowFb;
+
+#ifdef FBINK_WITH_DRAW
+// What fill_fb_band needs to fill a byte range of the fb (c.f., clear_screen & run_bands)
+typedef struct
+{
+	FBInkPixel px;
+	uint8_t    bpp;    // Pixel size of the fill (8 means a plain memset of px.gray8, whatever the actual bitdepth)
+} FBInkFillBand;
+#endif    // FBINK_WITH_DRAW
+
+#ifdef FBINK_WITH_BITMAP
+// A run of consecutive codepoints, whose glyphs are stored contiguously (i.e., one of the *_blockN arrays in fonts/*.h).
+// Every font gets a table of those, sorted by codepoint (c.f., font_lookup_glyph & tools/hextoc.py).
+typedef struct
+{
+	uint32_t    first;
+	uint32_t    last;
+	const void* glyphs;
+} FBInkGlyphRange;
+
+// A bitmap font pack, mapped from disk (c.f., load_font_pack & tools/hextopack.py)
+typedef struct
+{
+	const unsigned char* map;    // Read-only mapping of the whole file, NULL when no pack is in use
+	size_t               size;
+	FBInkGlyphRange*     ranges;    // Pointing into map
+	size_t               range_count;
+	size_t               glyph_size;    // In bytes
+	uint8_t              width;
+	uint8_t              height;
+	char*                request;    // As passed to load_font_pack, so we can skip remapping the same pack on reinit
+	const char*          name;       // Basename of the pack, for diagnostic purposes
+} FBInkFontPack;
+
+// Identifies a rendered glyph cell (c.f., glyph_cache_fetch)
+// NOTE: Glyph bitmaps live in static tables, so a bitmap pointer is unique to a (font, codepoint) tuple.
+//       The scaling factor & the pixel format are shared by every cell, and are tracked in FBInkGlyphCache instead.
+typedef struct
+{
+	const void* bitmap;    // NULL if the slot is empty
+	uint32_t    fg;        // Packed pixel values, as passed to fill_rect
+	uint32_t    bg;
+} FBInkGlyphKey;
+
+// Direct-mapped cache of fully rendered FONTW x FONTH glyph cells, in the fb's native pixel format
+typedef struct
+{
+	unsigned char*      cells;        // slots * cell_size bytes
+	FBInkGlyphKey*      keys;         // slots keys
+	size_t              cell_size;    // In bytes
+	size_t              pitch;        // Size of a single cell row, in bytes
+	uint32_t            slots;        // Power of two, 0 when the cache is disabled
+	unsigned short int  width;        // FONTW at setup time
+	unsigned short int  height;       // FONTH at setup time
+	uint8_t             mult;         // FONTSIZE_MULT at setup time
+	uint8_t             bpp;          // In bytes
+	FBINK_PXFMT_INDEX_T pxfmt;
+} FBInkGlyphCache;
+
+// A filled rectangle, in glyph (i.e., unscaled bitmap) coordinates
+typedef struct
+{
+	uint8_t x;
+	uint8_t y;
+	uint8_t w;
+	uint8_t h;
+} FBInkGlyphRect;
+
+// A glyph's bitmap decomposed into a list of fg & bg rectangles that exactly tile its cell (c.f., glyph_cover_fetch)
+typedef struct
+{
+	const void*    bitmap;      // NULL if the slot is empty
+	uint8_t        count;       // 0 if the glyph is too intricate to be worth it (i.e., > GLYPH_COVER_MAX_RECTS)
+	uint8_t        fg_count;    // The first fg_count rectangles are fg, the rest are bg
+	FBInkGlyphRect rects[GLYPH_COVER_MAX_RECTS];
+} FBInkGlyphCover;
+
+// The layout of a string on the cell grid, as computed by layout_cells, and walked line per line by next_cell_line
+typedef struct
+{
+	const char*        string;
+	bool               is_ascii;
+	bool               wrapped_line;
+	short int          col;    // Per-line, as centering may move it around
+	short int          row;    // Of the first line
+	unsigned short int available_cols;
+	unsigned short int lines;    // Estimate (LFs may add some, and we stop at the bottom of the screen)
+	size_t             chars_left;
+	size_t             line_len;
+	size_t             line_bytes;
+	size_t             line_offset;
+	int                bytes_printed;
+	unsigned short int printed;    // Amount of lines laid out so far
+	unsigned short int multiline_offset;    // Of the current line (i.e., printed - 1)
+	bool               halfcell_offset;     // Of the current line
+} FBInkCellLayout;
+#endif    // FBINK_WITH_BITMAP
+
+#ifdef FBINK_WITH_IMAGE
+// Everything draw_image_band needs to render a slice of rows of an image (c.f., run_bands)
+typedef struct
+{
+	const unsigned char* data;
+	const FBInkConfig*   fbink_cfg;
+	int                  w;
+	int                  req_n;
+	short int            x_off;
+	short int            y_off;
+	unsigned short int   img_x_off;
+	unsigned short int   max_width;
+	bool                 img_has_alpha;
+	uint8_t              invert;
+	uint24_t             invert_24b;
+	uint32_t             invert_32b;
+} FBInkImageBand;
+#endif    // FBINK_WITH_IMAGE
+
 #ifdef FBINK_WITH_OPENTYPE
 // Stores the information necessary to render a line of text
 // using OpenType/TrueType fonts
@@ -184,14 +314,130 @@ typedef struct FBInkOTLine
 	bool   has_a_break;
 } FBInkOTLine;
 
+// Everything the format-specialized coverage blenders need to paint a rendered line to the fb (c.f., fxpPaintOTLine)
+typedef struct FBInkOTPaint
+{
+	const unsigned char* mask;    // Coverage mask of the full line (i.e., line_buff)
+	unsigned int         stride;    // Width of the mask (i.e., max_lw)
+	unsigned int         width;     // Amount of pixels to paint per row (i.e., lw)
+	int                  height;    // Amount of rows to paint (i.e., max_line_height)
+	FBInkCoordinates     origin;    // Top-left corner, in fb coordinates
+	FBInkPixel           fgP;
+	FBInkPixel           bgP;
+	short int            layer_diff;
+	uint8_t              fgcolor;
+	uint8_t              bgcolor;
+	uint8_t              ainv;    // Mask inversion used by the B&W fast-path
+	bool                 is_overlay;
+	bool                 is_fgless;
+	bool                 is_bgless;
+} FBInkOTPaint;
+
+// What fbink_print_ot needs to know about a single character, computed once during layout, and reused to render it.
+// Indexed by the byte offset of that character in the string (like the linebreak & formatting buffers).
+// NOTE: Everything is already scaled (& rounded, like the rest of the pen arithmetic), which leaves plenty of room in 16 bits.
+typedef struct
+{
+	int16_t  x0;    // Bitmap box, as returned by stbtt_GetGlyphBitmapBox
+	int16_t  y0;
+	int16_t  x1;
+	int16_t  y1;
+	int16_t  adv;     // Advance width
+	int16_t  kern;    // Kerning adjustment with the next character, if any
+	uint16_t gi;
+	bool     is_shaped;
+} FBInkOTRun;
+
+// A kerning pair of a given face, unscaled (c.f., ot_kern_advance)
+typedef struct
+{
+	const stbtt_fontinfo* font;    // NULL if the slot is empty
+	int                   gi1;
+	int                   gi2;
+	int                   kern;
+} FBInkOTKern;
+
+// A glyph of a given face, at a given scale (c.f., ot_cache_fetch)
+typedef struct FBInkOTGlyph
+{
+	struct FBInkOTGlyph*  hnext;    // Next entry in the same hash bucket
+	struct FBInkOTGlyph*  prev;     // LRU list, most recently used first
+	struct FBInkOTGlyph*  next;
+	const stbtt_fontinfo* font;
+	float                 sf;
+	int                   gi;
+	int                   adv;    // Unscaled advance width, as returned by stbtt_GetGlyphHMetrics
+	int                   x0;     // Scaled bitmap box, as returned by stbtt_GetGlyphBitmapBox
+	int                   y0;
+	int                   x1;
+	int                   y1;
+	unsigned char*        bitmap;    // (x1 - x0) x (y1 - y0) coverage mask, only rendered on first use
+} FBInkOTGlyph;
+
+// LRU cache of rendered OpenType glyphs, shared by every face & every fbink_print_ot call
+typedef struct
+{
+	FBInkOTGlyph** buckets;    // OT_CACHE_BUCKETS hash chains, allocated on first use
+	FBInkOTGlyph*  head;       // Most recently used
+	FBInkOTGlyph*  tail;       // Least recently used, i.e., the next one to be evicted
+	size_t         size;       // In bytes, entries & bitmaps included
+	size_t         budget;     // In bytes, 0 disables the cache
+	size_t         count;
+} FBInkOTCache;
+
+// A loaded font, shared by everyone who loaded the same file (c.f., otFaces)
+typedef struct FBInkOTFace
+{
+	stbtt_fontinfo       info;
+	uint16_t**           cmap_pages;    // Codepoint to glyph index lookup table, in OT_CMAP_PAGES pages of OT_CMAP_PAGE_SIZE
+	//                                     entries, allocated & resolved lazily (c.f., ot_face_glyph_index). NULL if disabled.
+	const unsigned char* map;     // Read-only mapping of the whole file (i.e., what info.data points to)
+	size_t               size;
+	dev_t                dev;     // Identifies the file in the registry
+	ino_t                ino;
+	unsigned int         refs;    // One per FBInkOTFonts style slot pointing to it
+	struct FBInkOTFace*  next;    // Next face in the registry
+} FBInkOTFace;
+
 typedef struct FBInkOTFonts
 {
-	stbtt_fontinfo* otRegular;
-	stbtt_fontinfo* otItalic;
-	stbtt_fontinfo* otBold;
-	stbtt_fontinfo* otBoldItalic;
+	FBInkOTFace* otRegular;
+	FBInkOTFace* otItalic;
+	FBInkOTFace* otBold;
+	FBInkOTFace* otBoldItalic;
 } FBInkOTFonts;
 
+// A string laid out by ot_layout, ready to be painted (possibly many times, anywhere) by ot_render
+struct FBInkOTLayout
+{
+	const char*        string;      // Only owned by layouts handed out by fbink_ot_layout_new
+	size_t             str_len_bytes;
+	FBInkOTLine*       lines;
+	unsigned int       num_lines;
+	unsigned int       computed_lines;
+	unsigned char*     fmt_buff;    // CHARACTER_FONT_T per byte, NULL if unformatted
+	FBInkOTRun*        runs;        // Shaped glyphs, per byte
+	FBInkOTFonts       fonts;       // Holds a reference on each of these
+	FBInkOTFace*       font;        // Active font for unformatted text
+	float              sf;
+	float              rgSF;
+	float              itSF;
+	float              bdSF;
+	float              bditSF;
+	FBInkCoordinates   tl;          // Drawing area, as computed from the margins
+	FBInkCoordinates   br;
+	unsigned int       print_height;
+	unsigned int       curr_print_height;
+	int                max_line_height;
+	int                max_baseline;
+	unsigned short int max_lw;
+	unsigned short int font_size_px;
+	PADDING_INDEX_T    padding;
+	bool               is_formatted;
+	bool               is_centered;
+	bool               no_truncation;
+};
+
 typedef enum
 {
 	CH_IGNORE = 0U,
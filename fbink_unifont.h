@@ -26,8 +26,13 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/unifont.h"
-#include "fonts/unifontdw.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/unifont.h"
+#	include "fonts_subset/unifontdw.h"
+#else
+#	include "fonts/unifont.h"
+#	include "fonts/unifontdw.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* unifont_get_bitmap(uint32_t codepoint) __attribute__((const));
@@ -26,12 +26,21 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/alt.h"
-#include "fonts/fantasy.h"
-#include "fonts/mcr.h"
-#include "fonts/tall.h"
-#include "fonts/thin.h"
-#include "fonts/unscii.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/alt.h"
+#	include "fonts_subset/fantasy.h"
+#	include "fonts_subset/mcr.h"
+#	include "fonts_subset/tall.h"
+#	include "fonts_subset/thin.h"
+#	include "fonts_subset/unscii.h"
+#else
+#	include "fonts/alt.h"
+#	include "fonts/fantasy.h"
+#	include "fonts/mcr.h"
+#	include "fonts/tall.h"
+#	include "fonts/thin.h"
+#	include "fonts/unscii.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* unscii_get_bitmap(uint32_t) __attribute__((const));
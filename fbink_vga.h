@@ -26,7 +26,11 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/vga.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts_subset/vga.h"
+#else
+#	include "fonts/vga.h"
+#endif
 
 // NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
 static const unsigned char* vga_get_bitmap(uint32_t codepoint) __attribute__((const));
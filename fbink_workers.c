@@ -0,0 +1,84 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_workers.h"
+
+#ifdef FBINK_WITH_DRAW
+static void*
+    band_worker(void* arg)
+{
+	const FBInkBand* band = arg;
+	band->fn(band->ctx, band->start, band->end);
+	return NULL;
+}
+
+// Split [start, end) into up to workerThreads bands, in multiples of granule, and at least min_band wide,
+// and run fn on each of them concurrently, the calling thread taking care of the first one.
+// NOTE: Threads are spawned per job, instead of being kept around in the host process (think fork(), or dlclose()).
+//       We only ever split jobs large enough (e.g., a full-screen image) for the few dozen µs this costs to be noise.
+//       If spawning a thread fails, its band is simply rendered by the calling thread.
+static void
+    run_bands(FBInkBandFn fn, const void* ctx, uint32_t start, uint32_t end, uint32_t granule, uint32_t min_band)
+{
+	const uint32_t len   = end - start;
+	const uint32_t count = MIN(workerThreads, len / min_band);
+	if (count <= 1U) {
+		fn(ctx, start, end);
+		return;
+	}
+
+	uint32_t band_len = (len + count - 1U) / count;
+	band_len          = ((band_len + granule - 1U) / granule) * granule;
+
+	pthread_t threads[WORKERS_MAX];
+	FBInkBand bands[WORKERS_MAX];
+	bool      spawned[WORKERS_MAX] = { 0 };
+	for (uint32_t i = 1U; i < count; i++) {
+		const uint32_t band_start = start + (i * band_len);
+		if (band_start >= end) {
+			break;
+		}
+		bands[i] = (FBInkBand){
+			.fn    = fn,
+			.ctx   = ctx,
+			.start = band_start,
+			.end   = MIN(band_start + band_len, end),
+		};
+		const int ret = pthread_create(&threads[i], NULL, band_worker, &bands[i]);
+		if (ret != 0) {
+			errno = ret;
+			PFWARN("pthread_create: %m");
+			fn(ctx, bands[i].start, bands[i].end);
+		} else {
+			spawned[i] = true;
+		}
+	}
+
+	fn(ctx, start, MIN(start + band_len, end));
+
+	for (uint32_t i = 1U; i < count; i++) {
+		if (spawned[i]) {
+			pthread_join(threads[i], NULL);
+		}
+	}
+}
+#endif    // FBINK_WITH_DRAW
@@ -0,0 +1,55 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_WORKERS_H
+#define __FBINK_WORKERS_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+#ifdef FBINK_WITH_DRAW
+#	include <pthread.h>
+
+// Upper bound on the amount of threads we'll ever split a single job across (c.f., FBInkConfig's threads)
+#	define WORKERS_MAX 8U
+// Don't bother splitting jobs in bands thinner than this many rows
+#	define WORKERS_MIN_BAND_ROWS 128U
+// Keep band boundaries on multiples of this many rows (i.e., the ordered dithering matrix, and our rotated tiles)
+#	define WORKERS_BAND_GRANULE 32U
+
+// A banded job: fn gets called concurrently on disjoint [start, end) slices of the job's range
+typedef void (*FBInkBandFn)(const void* ctx, uint32_t start, uint32_t end);
+
+typedef struct
+{
+	FBInkBandFn fn;
+	const void* ctx;
+	uint32_t    start;
+	uint32_t    end;
+} FBInkBand;
+
+static void* band_worker(void*);
+static void  run_bands(FBInkBandFn, const void*, uint32_t, uint32_t, uint32_t, uint32_t);
+#endif    // FBINK_WITH_DRAW
+
+#endif
@@ -66,6 +66,10 @@ cdecl_type(FBInkOTFit)
 cdecl_type(FBInkRect)
 
 cdecl_type(FBInkDump)
+cdecl_type(FBInkCmdList)
+cdecl_type(FBInkTerm)
+cdecl_type(FBInkSprite)
+cdecl_type(FBInkOTLayout)
 
 // API
 cdecl_func(fbink_version)
@@ -78,16 +82,22 @@ cdecl_func(fbink_state_dump)
 cdecl_func(fbink_get_state)
 
 cdecl_func(fbink_print)
+cdecl_func(fbink_measure_text)
 
 cdecl_func(fbink_add_ot_font)
 cdecl_func(fbink_add_ot_font_v2)
 cdecl_func(fbink_free_ot_fonts)
 cdecl_func(fbink_free_ot_fonts_v2)
+cdecl_func(fbink_set_ot_cache_budget)
 cdecl_func(fbink_print_ot)
+cdecl_func(fbink_ot_layout_new)
+cdecl_func(fbink_ot_layout_render)
+cdecl_func(fbink_ot_layout_free)
 
 cdecl_func(fbink_printf)
 
 cdecl_func(fbink_refresh)
+cdecl_func(fbink_refresh_damage)
 cdecl_func(fbink_wait_for_submission)
 cdecl_func(fbink_wait_for_complete)
 cdecl_func(fbink_get_last_marker)
@@ -134,6 +144,8 @@ cdecl_func(fbink_rota_native_to_canonical)
 cdecl_func(fbink_rota_canonical_to_native)
 
 cdecl_func(fbink_invert_screen)
+cdecl_func(fbink_copy_rect)
+cdecl_func(fbink_scroll_rect)
 
 cdecl_func(fbink_get_fb_pointer)
 cdecl_func(fbink_get_fb_info)
@@ -143,6 +155,30 @@ cdecl_const(KEEP_CURRENT_GRAYSCALE)
 cdecl_const(TOGGLE_GRAYSCALE)
 cdecl_func(fbink_set_fb_info)
 
+cdecl_func(fbink_put_pixels_gray)
+cdecl_func(fbink_put_pixels)
+
+cdecl_func(fbink_cmdlist_new)
+cdecl_func(fbink_cmdlist_add_text)
+cdecl_func(fbink_cmdlist_add_rect)
+cdecl_func(fbink_cmdlist_add_pixel)
+cdecl_func(fbink_cmdlist_add_image)
+cdecl_func(fbink_cmdlist_add_raw_data)
+cdecl_func(fbink_cmdlist_exec)
+cdecl_func(fbink_cmdlist_clear)
+cdecl_func(fbink_cmdlist_free)
+
+cdecl_func(fbink_term_new)
+cdecl_func(fbink_term_write)
+cdecl_func(fbink_term_clear)
+cdecl_func(fbink_term_flush)
+cdecl_func(fbink_term_free)
+
+cdecl_func(fbink_sprite_new_from_image)
+cdecl_func(fbink_sprite_new_from_raw_data)
+cdecl_func(fbink_sprite_blit)
+cdecl_func(fbink_sprite_free)
+
 cdecl_func(fbink_sunxi_toggle_ntx_pen_mode)
 cdecl_func(fbink_sunxi_ntx_enforce_rota)
 
@@ -3893,3 +3893,237 @@ static const unsigned char alt_block232[][8] = {
 	{ 0x3e, 0x63, 0x63, 0x3e, 0x60, 0x60, 0x3e, 0x00 },	// U+1FBF9 (🯹)
 }; // 10
 
+static const FBInkGlyphRange alt_ranges[] = {
+	{ 0x00u, 0x195u, alt_block1 },
+	{ 0x197u, 0x19fu, alt_block2 },
+	{ 0x1b7u, 0x1b7u, alt_block3 },
+	{ 0x1cdu, 0x1e3u, alt_block4 },
+	{ 0x1e6u, 0x1e9u, alt_block5 },
+	{ 0x1eeu, 0x1f0u, alt_block6 },
+	{ 0x1f4u, 0x1f5u, alt_block7 },
+	{ 0x1f8u, 0x21bu, alt_block8 },
+	{ 0x226u, 0x227u, alt_block9 },
+	{ 0x22au, 0x233u, alt_block10 },
+	{ 0x258u, 0x259u, alt_block11 },
+	{ 0x263u, 0x263u, alt_block12 },
+	{ 0x292u, 0x292u, alt_block13 },
+	{ 0x294u, 0x294u, alt_block14 },
+	{ 0x2c6u, 0x2c6u, alt_block15 },
+	{ 0x2c9u, 0x2c9u, alt_block16 },
+	{ 0x2cdu, 0x2cdu, alt_block17 },
+	{ 0x2dcu, 0x2dcu, alt_block18 },
+	{ 0x300u, 0x30du, alt_block19 },
+	{ 0x30fu, 0x311u, alt_block20 },
+	{ 0x313u, 0x318u, alt_block21 },
+	{ 0x31bu, 0x31cu, alt_block22 },
+	{ 0x31fu, 0x329u, alt_block23 },
+	{ 0x32bu, 0x32cu, alt_block24 },
+	{ 0x32eu, 0x32eu, alt_block25 },
+	{ 0x330u, 0x330u, alt_block26 },
+	{ 0x332u, 0x333u, alt_block27 },
+	{ 0x335u, 0x33eu, alt_block28 },
+	{ 0x340u, 0x344u, alt_block29 },
+	{ 0x34fu, 0x34fu, alt_block30 },
+	{ 0x362u, 0x362u, alt_block31 },
+	{ 0x386u, 0x386u, alt_block32 },
+	{ 0x388u, 0x38au, alt_block33 },
+	{ 0x38cu, 0x38cu, alt_block34 },
+	{ 0x38eu, 0x38fu, alt_block35 },
+	{ 0x391u, 0x3a1u, alt_block36 },
+	{ 0x3a3u, 0x3afu, alt_block37 },
+	{ 0x3b1u, 0x3ceu, alt_block38 },
+	{ 0x400u, 0x401u, alt_block39 },
+	{ 0x405u, 0x409u, alt_block40 },
+	{ 0x410u, 0x451u, alt_block41 },
+	{ 0x455u, 0x458u, alt_block42 },
+	{ 0x4d0u, 0x4d7u, alt_block43 },
+	{ 0x4e6u, 0x4e7u, alt_block44 },
+	{ 0x4f1u, 0x4f1u, alt_block45 },
+	{ 0x5d0u, 0x5eau, alt_block46 },
+	{ 0x623u, 0x623u, alt_block47 },
+	{ 0x627u, 0x62du, alt_block48 },
+	{ 0x62fu, 0x635u, alt_block49 },
+	{ 0x637u, 0x63au, alt_block50 },
+	{ 0x640u, 0x64au, alt_block51 },
+	{ 0x671u, 0x673u, alt_block52 },
+	{ 0x1560u, 0x1563u, alt_block53 },
+	{ 0x156au, 0x156au, alt_block54 },
+	{ 0x156cu, 0x1571u, alt_block55 },
+	{ 0x15ecu, 0x15edu, alt_block56 },
+	{ 0x15efu, 0x15efu, alt_block57 },
+	{ 0x16a0u, 0x16abu, alt_block58 },
+	{ 0x16b1u, 0x16f8u, alt_block59 },
+	{ 0x1e00u, 0x1e02u, alt_block60 },
+	{ 0x1e04u, 0x1e07u, alt_block61 },
+	{ 0x1e0au, 0x1e0au, alt_block62 },
+	{ 0x1e0cu, 0x1e0fu, alt_block63 },
+	{ 0x1e41u, 0x1e4bu, alt_block64 },
+	{ 0x1e58u, 0x1e5bu, alt_block65 },
+	{ 0x1e5eu, 0x1e5eu, alt_block66 },
+	{ 0x1f00u, 0x1f7du, alt_block67 },
+	{ 0x1f80u, 0x1fb4u, alt_block68 },
+	{ 0x1fb6u, 0x1fbcu, alt_block69 },
+	{ 0x1fc2u, 0x1fc4u, alt_block70 },
+	{ 0x1fc6u, 0x1fc7u, alt_block71 },
+	{ 0x1fcau, 0x1fccu, alt_block72 },
+	{ 0x1fd0u, 0x1fd4u, alt_block73 },
+	{ 0x1fd6u, 0x1fdcu, alt_block74 },
+	{ 0x1fe0u, 0x1fe3u, alt_block75 },
+	{ 0x1fe6u, 0x1febu, alt_block76 },
+	{ 0x1ff2u, 0x1ff4u, alt_block77 },
+	{ 0x1ff6u, 0x1ff7u, alt_block78 },
+	{ 0x1ffau, 0x1ffcu, alt_block79 },
+	{ 0x2010u, 0x2019u, alt_block80 },
+	{ 0x201cu, 0x201du, alt_block81 },
+	{ 0x2020u, 0x2022u, alt_block82 },
+	{ 0x2024u, 0x2026u, alt_block83 },
+	{ 0x2030u, 0x2037u, alt_block84 },
+	{ 0x203cu, 0x203du, alt_block85 },
+	{ 0x2044u, 0x2044u, alt_block86 },
+	{ 0x2047u, 0x2049u, alt_block87 },
+	{ 0x2070u, 0x2071u, alt_block88 },
+	{ 0x2074u, 0x207cu, alt_block89 },
+	{ 0x207fu, 0x207fu, alt_block90 },
+	{ 0x20a7u, 0x20a7u, alt_block91 },
+	{ 0x20acu, 0x20acu, alt_block92 },
+	{ 0x2117u, 0x2117u, alt_block93 },
+	{ 0x2120u, 0x2120u, alt_block94 },
+	{ 0x2122u, 0x2122u, alt_block95 },
+	{ 0x2150u, 0x215fu, alt_block96 },
+	{ 0x2189u, 0x2189u, alt_block97 },
+	{ 0x2190u, 0x2199u, alt_block98 },
+	{ 0x21a5u, 0x21a5u, alt_block99 },
+	{ 0x21a8u, 0x21a8u, alt_block100 },
+	{ 0x21b2u, 0x21b2u, alt_block101 },
+	{ 0x21bcu, 0x21c3u, alt_block102 },
+	{ 0x21e6u, 0x21e9u, alt_block103 },
+	{ 0x2205u, 0x2205u, alt_block104 },
+	{ 0x2212u, 0x2215u, alt_block105 },
+	{ 0x2218u, 0x2218u, alt_block106 },
+	{ 0x221au, 0x221cu, alt_block107 },
+	{ 0x221eu, 0x221fu, alt_block108 },
+	{ 0x2229u, 0x2229u, alt_block109 },
+	{ 0x2248u, 0x2248u, alt_block110 },
+	{ 0x2261u, 0x2261u, alt_block111 },
+	{ 0x2264u, 0x2265u, alt_block112 },
+	{ 0x22c5u, 0x22c5u, alt_block113 },
+	{ 0x2301u, 0x2301u, alt_block114 },
+	{ 0x2318u, 0x2318u, alt_block115 },
+	{ 0x231au, 0x231bu, alt_block116 },
+	{ 0x2320u, 0x2321u, alt_block117 },
+	{ 0x239bu, 0x23afu, alt_block118 },
+	{ 0x23b2u, 0x23b3u, alt_block119 },
+	{ 0x23b7u, 0x23bdu, alt_block120 },
+	{ 0x23d0u, 0x23d0u, alt_block121 },
+	{ 0x23dau, 0x23dau, alt_block122 },
+	{ 0x23e9u, 0x23ecu, alt_block123 },
+	{ 0x2500u, 0x25ffu, alt_block124 },
+	{ 0x2602u, 0x2602u, alt_block125 },
+	{ 0x2605u, 0x2606u, alt_block126 },
+	{ 0x2609u, 0x2609u, alt_block127 },
+	{ 0x260eu, 0x260eu, alt_block128 },
+	{ 0x2610u, 0x2612u, alt_block129 },
+	{ 0x2615u, 0x2615u, alt_block130 },
+	{ 0x2625u, 0x2625u, alt_block131 },
+	{ 0x2628u, 0x2628u, alt_block132 },
+	{ 0x262fu, 0x2637u, alt_block133 },
+	{ 0x2639u, 0x263bu, alt_block134 },
+	{ 0x2640u, 0x2640u, alt_block135 },
+	{ 0x2642u, 0x2642u, alt_block136 },
+	{ 0x2660u, 0x2667u, alt_block137 },
+	{ 0x2669u, 0x266cu, alt_block138 },
+	{ 0x2683u, 0x2683u, alt_block139 },
+	{ 0x268au, 0x268fu, alt_block140 },
+	{ 0x269eu, 0x269fu, alt_block141 },
+	{ 0x26aau, 0x26acu, alt_block142 },
+	{ 0x26c8u, 0x26c8u, alt_block143 },
+	{ 0x26f5u, 0x26f5u, alt_block144 },
+	{ 0x2708u, 0x2708u, alt_block145 },
+	{ 0x2713u, 0x2713u, alt_block146 },
+	{ 0x2734u, 0x2735u, alt_block147 },
+	{ 0x2764u, 0x2764u, alt_block148 },
+	{ 0x2800u, 0x28ffu, alt_block149 },
+	{ 0x29c9u, 0x29c9u, alt_block150 },
+	{ 0x2b12u, 0x2b19u, alt_block151 },
+	{ 0x2b1du, 0x2b1du, alt_block152 },
+	{ 0x2b24u, 0x2b2fu, alt_block153 },
+	{ 0x2b55u, 0x2b55u, alt_block154 },
+	{ 0x2b58u, 0x2b58u, alt_block155 },
+	{ 0x2b73u, 0x2b73u, alt_block156 },
+	{ 0x2b9cu, 0x2b9fu, alt_block157 },
+	{ 0x2bbau, 0x2bbau, alt_block158 },
+	{ 0x2bc0u, 0x2bc0u, alt_block159 },
+	{ 0x2bc5u, 0x2bc8u, alt_block160 },
+	{ 0x2bcau, 0x2bcbu, alt_block161 },
+	{ 0x2e2eu, 0x2e2eu, alt_block162 },
+	{ 0x4dc0u, 0x4dffu, alt_block163 },
+	{ 0xe080u, 0xe1aau, alt_block164 },
+	{ 0xe800u, 0xe87du, alt_block165 },
+	{ 0xec00u, 0xec07u, alt_block166 },
+	{ 0xec0au, 0xec7du, alt_block167 },
+	{ 0xec7fu, 0xecdeu, alt_block168 },
+	{ 0xfe81u, 0xfe82u, alt_block169 },
+	{ 0xfe84u, 0xfe84u, alt_block170 },
+	{ 0xfe87u, 0xfe87u, alt_block171 },
+	{ 0xfe8fu, 0xfe9cu, alt_block172 },
+	{ 0xfe9eu, 0xfea4u, alt_block173 },
+	{ 0xfea9u, 0xfeadu, alt_block174 },
+	{ 0xfeafu, 0xfeafu, alt_block175 },
+	{ 0xfeb1u, 0xfeb7u, alt_block176 },
+	{ 0xfeb9u, 0xfebcu, alt_block177 },
+	{ 0xfec1u, 0xfec6u, alt_block178 },
+	{ 0xfec9u, 0xfeddu, alt_block179 },
+	{ 0xfedfu, 0xfee3u, alt_block180 },
+	{ 0xfee5u, 0xfee9u, alt_block181 },
+	{ 0xfeebu, 0xfef4u, alt_block182 },
+	{ 0xff01u, 0xff36u, alt_block183 },
+	{ 0xff38u, 0xff5du, alt_block184 },
+	{ 0xff5fu, 0xff9fu, alt_block185 },
+	{ 0x1d300u, 0x1d356u, alt_block186 },
+	{ 0x1f332u, 0x1f333u, alt_block187 },
+	{ 0x1f344u, 0x1f345u, alt_block188 },
+	{ 0x1f34eu, 0x1f34fu, alt_block189 },
+	{ 0x1f37au, 0x1f37au, alt_block190 },
+	{ 0x1f37eu, 0x1f37eu, alt_block191 },
+	{ 0x1f3ceu, 0x1f3ceu, alt_block192 },
+	{ 0x1f3d0u, 0x1f3d0u, alt_block193 },
+	{ 0x1f3f0u, 0x1f3f0u, alt_block194 },
+	{ 0x1f407u, 0x1f408u, alt_block195 },
+	{ 0x1f40du, 0x1f40du, alt_block196 },
+	{ 0x1f419u, 0x1f419u, alt_block197 },
+	{ 0x1f41fu, 0x1f41fu, alt_block198 },
+	{ 0x1f42au, 0x1f42au, alt_block199 },
+	{ 0x1f47bu, 0x1f47bu, alt_block200 },
+	{ 0x1f47eu, 0x1f47eu, alt_block201 },
+	{ 0x1f480u, 0x1f480u, alt_block202 },
+	{ 0x1f48du, 0x1f48eu, alt_block203 },
+	{ 0x1f4a7u, 0x1f4a7u, alt_block204 },
+	{ 0x1f4adu, 0x1f4adu, alt_block205 },
+	{ 0x1f4b0u, 0x1f4b0u, alt_block206 },
+	{ 0x1f4beu, 0x1f4beu, alt_block207 },
+	{ 0x1f4c1u, 0x1f4c1u, alt_block208 },
+	{ 0x1f4c4u, 0x1f4c4u, alt_block209 },
+	{ 0x1f4dcu, 0x1f4dcu, alt_block210 },
+	{ 0x1f4fbu, 0x1f4fbu, alt_block211 },
+	{ 0x1f514u, 0x1f514u, alt_block212 },
+	{ 0x1f52bu, 0x1f52bu, alt_block213 },
+	{ 0x1f52eu, 0x1f52eu, alt_block214 },
+	{ 0x1f574u, 0x1f574u, alt_block215 },
+	{ 0x1f577u, 0x1f577u, alt_block216 },
+	{ 0x1f5a8u, 0x1f5a8u, alt_block217 },
+	{ 0x1f5d1u, 0x1f5d1u, alt_block218 },
+	{ 0x1f68du, 0x1f68du, alt_block219 },
+	{ 0x1f6d6u, 0x1f6d6u, alt_block220 },
+	{ 0x1f6f8u, 0x1f6f8u, alt_block221 },
+	{ 0x1f860u, 0x1f860u, alt_block222 },
+	{ 0x1f986u, 0x1f986u, alt_block223 },
+	{ 0x1f98bu, 0x1f98bu, alt_block224 },
+	{ 0x1f9f2u, 0x1f9f2u, alt_block225 },
+	{ 0x1fa90u, 0x1fa90u, alt_block226 },
+	{ 0x1fa93u, 0x1fa93u, alt_block227 },
+	{ 0x1fa99u, 0x1fa99u, alt_block228 },
+	{ 0x1fa9cu, 0x1fa9cu, alt_block229 },
+	{ 0x1faa6u, 0x1faa8u, alt_block230 },
+	{ 0x1fb00u, 0x1fbcau, alt_block231 },
+	{ 0x1fbf0u, 0x1fbf9u, alt_block232 },
+};
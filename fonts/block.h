@@ -104,3 +104,6 @@ static const uint32_t block_block1[][32] = {
 	{ 0xff008000, 0x7f00c000, 0x3f00e000, 0x1f00f000, 0x0f00f800, 0x0700fc00, 0x0300fe00, 0x0100ff00, 0x00ff00ff, 0x007f007f, 0x003f003f, 0x001f001f, 0x000f000f, 0x00070007, 0x00030003, 0x00010001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+007E (~)
 }; // 95
 
+static const FBInkGlyphRange block_ranges[] = {
+	{ 0x20u, 0x7eu, block_block1 },
+};
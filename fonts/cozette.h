@@ -4523,3 +4523,477 @@ static const unsigned char cozette_block472[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F1417 (󱐗)
 }; // 1
 
+static const FBInkGlyphRange cozette_ranges[] = {
+	{ 0x00u, 0x7fu, cozette_block1 },
+	{ 0xa0u, 0x1c3u, cozette_block2 },
+	{ 0x1cdu, 0x1f0u, cozette_block3 },
+	{ 0x1f4u, 0x220u, cozette_block4 },
+	{ 0x224u, 0x229u, cozette_block5 },
+	{ 0x22bu, 0x22bu, cozette_block6 },
+	{ 0x22du, 0x22fu, cozette_block7 },
+	{ 0x231u, 0x233u, cozette_block8 },
+	{ 0x241u, 0x242u, cozette_block9 },
+	{ 0x246u, 0x247u, cozette_block10 },
+	{ 0x250u, 0x2a2u, cozette_block11 },
+	{ 0x2b9u, 0x2bdu, cozette_block12 },
+	{ 0x2c2u, 0x2ddu, cozette_block13 },
+	{ 0x2dfu, 0x2e4u, cozette_block14 },
+	{ 0x2ecu, 0x2edu, cozette_block15 },
+	{ 0x2efu, 0x2f7u, cozette_block16 },
+	{ 0x2f9u, 0x2feu, cozette_block17 },
+	{ 0x300u, 0x320u, cozette_block18 },
+	{ 0x323u, 0x333u, cozette_block19 },
+	{ 0x33au, 0x343u, cozette_block20 },
+	{ 0x346u, 0x348u, cozette_block21 },
+	{ 0x386u, 0x386u, cozette_block22 },
+	{ 0x388u, 0x38au, cozette_block23 },
+	{ 0x38cu, 0x38cu, cozette_block24 },
+	{ 0x38eu, 0x3a1u, cozette_block25 },
+	{ 0x3a3u, 0x3ceu, cozette_block26 },
+	{ 0x3d5u, 0x3d5u, cozette_block27 },
+	{ 0x3dau, 0x3ddu, cozette_block28 },
+	{ 0x3f4u, 0x3f4u, cozette_block29 },
+	{ 0x3f7u, 0x3f9u, cozette_block30 },
+	{ 0x400u, 0x482u, cozette_block31 },
+	{ 0x48au, 0x52fu, cozette_block32 },
+	{ 0xca0u, 0xca0u, cozette_block33 },
+	{ 0x16a0u, 0x16a0u, cozette_block34 },
+	{ 0x16a2u, 0x16a6u, cozette_block35 },
+	{ 0x16a8u, 0x16acu, cozette_block36 },
+	{ 0x1d25u, 0x1d25u, cozette_block37 },
+	{ 0x1e00u, 0x1ef9u, cozette_block38 },
+	{ 0x1f00u, 0x1f05u, cozette_block39 },
+	{ 0x1f08u, 0x1f0du, cozette_block40 },
+	{ 0x1f10u, 0x1f15u, cozette_block41 },
+	{ 0x1f18u, 0x1f1du, cozette_block42 },
+	{ 0x1f20u, 0x1f25u, cozette_block43 },
+	{ 0x1f28u, 0x1f2du, cozette_block44 },
+	{ 0x1f30u, 0x1f35u, cozette_block45 },
+	{ 0x1f38u, 0x1f3du, cozette_block46 },
+	{ 0x1f40u, 0x1f45u, cozette_block47 },
+	{ 0x1f48u, 0x1f4du, cozette_block48 },
+	{ 0x1f50u, 0x1f55u, cozette_block49 },
+	{ 0x1f59u, 0x1f59u, cozette_block50 },
+	{ 0x1f5bu, 0x1f5bu, cozette_block51 },
+	{ 0x1f5du, 0x1f5du, cozette_block52 },
+	{ 0x1f60u, 0x1f65u, cozette_block53 },
+	{ 0x1f68u, 0x1f6du, cozette_block54 },
+	{ 0x1f70u, 0x1f7du, cozette_block55 },
+	{ 0x1f80u, 0x1f85u, cozette_block56 },
+	{ 0x1f88u, 0x1f8du, cozette_block57 },
+	{ 0x1f90u, 0x1f95u, cozette_block58 },
+	{ 0x1f98u, 0x1f9du, cozette_block59 },
+	{ 0x1fa0u, 0x1fa5u, cozette_block60 },
+	{ 0x1fa8u, 0x1fadu, cozette_block61 },
+	{ 0x1fb0u, 0x1fb4u, cozette_block62 },
+	{ 0x1fb6u, 0x1fbcu, cozette_block63 },
+	{ 0x1fc2u, 0x1fc4u, cozette_block64 },
+	{ 0x1fc6u, 0x1fccu, cozette_block65 },
+	{ 0x1fd0u, 0x1fd3u, cozette_block66 },
+	{ 0x1fd6u, 0x1fdbu, cozette_block67 },
+	{ 0x1fe0u, 0x1fe6u, cozette_block68 },
+	{ 0x1fe8u, 0x1fecu, cozette_block69 },
+	{ 0x1ff2u, 0x1ff4u, cozette_block70 },
+	{ 0x1ff6u, 0x1ffcu, cozette_block71 },
+	{ 0x2000u, 0x200au, cozette_block72 },
+	{ 0x2010u, 0x2027u, cozette_block73 },
+	{ 0x202fu, 0x2030u, cozette_block74 },
+	{ 0x2032u, 0x203fu, cozette_block75 },
+	{ 0x2043u, 0x2046u, cozette_block76 },
+	{ 0x2056u, 0x2056u, cozette_block77 },
+	{ 0x2058u, 0x205eu, cozette_block78 },
+	{ 0x2070u, 0x2071u, cozette_block79 },
+	{ 0x2074u, 0x208eu, cozette_block80 },
+	{ 0x2090u, 0x209cu, cozette_block81 },
+	{ 0x20a4u, 0x20a4u, cozette_block82 },
+	{ 0x20aau, 0x20aau, cozette_block83 },
+	{ 0x20acu, 0x20acu, cozette_block84 },
+	{ 0x20bdu, 0x20bdu, cozette_block85 },
+	{ 0x20bfu, 0x20bfu, cozette_block86 },
+	{ 0x2116u, 0x2116u, cozette_block87 },
+	{ 0x2122u, 0x2122u, cozette_block88 },
+	{ 0x2160u, 0x2165u, cozette_block89 },
+	{ 0x2168u, 0x216au, cozette_block90 },
+	{ 0x2170u, 0x217bu, cozette_block91 },
+	{ 0x2190u, 0x219bu, cozette_block92 },
+	{ 0x21a2u, 0x21a7u, cozette_block93 },
+	{ 0x21a9u, 0x21acu, cozette_block94 },
+	{ 0x21afu, 0x21c3u, cozette_block95 },
+	{ 0x21cbu, 0x21ccu, cozette_block96 },
+	{ 0x21d0u, 0x21d5u, cozette_block97 },
+	{ 0x21e0u, 0x21e3u, cozette_block98 },
+	{ 0x21f1u, 0x21f2u, cozette_block99 },
+	{ 0x2200u, 0x222cu, cozette_block100 },
+	{ 0x2234u, 0x2237u, cozette_block101 },
+	{ 0x223au, 0x223au, cozette_block102 },
+	{ 0x223eu, 0x223eu, cozette_block103 },
+	{ 0x2245u, 0x2245u, cozette_block104 },
+	{ 0x2248u, 0x2249u, cozette_block105 },
+	{ 0x224du, 0x224du, cozette_block106 },
+	{ 0x2260u, 0x2262u, cozette_block107 },
+	{ 0x2264u, 0x2265u, cozette_block108 },
+	{ 0x2282u, 0x228bu, cozette_block109 },
+	{ 0x228fu, 0x2298u, cozette_block110 },
+	{ 0x229bu, 0x22a5u, cozette_block111 },
+	{ 0x22b2u, 0x22b8u, cozette_block112 },
+	{ 0x22c0u, 0x22c6u, cozette_block113 },
+	{ 0x22c8u, 0x22c8u, cozette_block114 },
+	{ 0x22eeu, 0x22f1u, cozette_block115 },
+	{ 0x2300u, 0x2300u, cozette_block116 },
+	{ 0x2302u, 0x2302u, cozette_block117 },
+	{ 0x2308u, 0x230fu, cozette_block118 },
+	{ 0x2315u, 0x2315u, cozette_block119 },
+	{ 0x2318u, 0x2318u, cozette_block120 },
+	{ 0x231cu, 0x2321u, cozette_block121 },
+	{ 0x2329u, 0x232au, cozette_block122 },
+	{ 0x2335u, 0x233au, cozette_block123 },
+	{ 0x233du, 0x2342u, cozette_block124 },
+	{ 0x2349u, 0x2349u, cozette_block125 },
+	{ 0x234bu, 0x234bu, cozette_block126 },
+	{ 0x234du, 0x234eu, cozette_block127 },
+	{ 0x2352u, 0x2352u, cozette_block128 },
+	{ 0x2355u, 0x2355u, cozette_block129 },
+	{ 0x2358u, 0x2365u, cozette_block130 },
+	{ 0x2368u, 0x2368u, cozette_block131 },
+	{ 0x236au, 0x236fu, cozette_block132 },
+	{ 0x2371u, 0x237au, cozette_block133 },
+	{ 0x237fu, 0x237fu, cozette_block134 },
+	{ 0x2387u, 0x238bu, cozette_block135 },
+	{ 0x2395u, 0x2395u, cozette_block136 },
+	{ 0x23ceu, 0x23cfu, cozette_block137 },
+	{ 0x23e8u, 0x23e8u, cozette_block138 },
+	{ 0x23f3u, 0x23fcu, cozette_block139 },
+	{ 0x2400u, 0x2400u, cozette_block140 },
+	{ 0x2408u, 0x240fu, cozette_block141 },
+	{ 0x241cu, 0x2420u, cozette_block142 },
+	{ 0x2424u, 0x2424u, cozette_block143 },
+	{ 0x2500u, 0x2594u, cozette_block144 },
+	{ 0x2596u, 0x25a3u, cozette_block145 },
+	{ 0x25aau, 0x25abu, cozette_block146 },
+	{ 0x25b2u, 0x25b3u, cozette_block147 },
+	{ 0x25b6u, 0x25b6u, cozette_block148 },
+	{ 0x25bcu, 0x25bdu, cozette_block149 },
+	{ 0x25c0u, 0x25c0u, cozette_block150 },
+	{ 0x25c6u, 0x25c9u, cozette_block151 },
+	{ 0x25cbu, 0x25cbu, cozette_block152 },
+	{ 0x25ceu, 0x25d5u, cozette_block153 },
+	{ 0x25ebu, 0x25ebu, cozette_block154 },
+	{ 0x25f0u, 0x25f7u, cozette_block155 },
+	{ 0x25ffu, 0x25ffu, cozette_block156 },
+	{ 0x2601u, 0x2601u, cozette_block157 },
+	{ 0x2603u, 0x2603u, cozette_block158 },
+	{ 0x2610u, 0x2612u, cozette_block159 },
+	{ 0x2615u, 0x2615u, cozette_block160 },
+	{ 0x2630u, 0x263bu, cozette_block161 },
+	{ 0x263fu, 0x2642u, cozette_block162 },
+	{ 0x2660u, 0x2667u, cozette_block163 },
+	{ 0x2669u, 0x266fu, cozette_block164 },
+	{ 0x2680u, 0x2685u, cozette_block165 },
+	{ 0x2687u, 0x2687u, cozette_block166 },
+	{ 0x2690u, 0x2691u, cozette_block167 },
+	{ 0x2699u, 0x2699u, cozette_block168 },
+	{ 0x26a0u, 0x26a3u, cozette_block169 },
+	{ 0x26a5u, 0x26a6u, cozette_block170 },
+	{ 0x26a8u, 0x26a8u, cozette_block171 },
+	{ 0x26b2u, 0x26b5u, cozette_block172 },
+	{ 0x26b8u, 0x26b8u, cozette_block173 },
+	{ 0x2713u, 0x271cu, cozette_block174 },
+	{ 0x2726u, 0x2726u, cozette_block175 },
+	{ 0x272du, 0x272eu, cozette_block176 },
+	{ 0x2739u, 0x2739u, cozette_block177 },
+	{ 0x2744u, 0x2744u, cozette_block178 },
+	{ 0x274cu, 0x274cu, cozette_block179 },
+	{ 0x2753u, 0x2753u, cozette_block180 },
+	{ 0x276cu, 0x276fu, cozette_block181 },
+	{ 0x279cu, 0x279cu, cozette_block182 },
+	{ 0x27dcu, 0x27dcu, cozette_block183 },
+	{ 0x27e6u, 0x27ebu, cozette_block184 },
+	{ 0x2801u, 0x28ffu, cozette_block185 },
+	{ 0x294au, 0x294au, cozette_block186 },
+	{ 0x29fbu, 0x29fbu, cozette_block187 },
+	{ 0x2b22u, 0x2b22u, cozette_block188 },
+	{ 0x2b50u, 0x2b50u, cozette_block189 },
+	{ 0x2b60u, 0x2b69u, cozette_block190 },
+	{ 0x2b80u, 0x2b83u, cozette_block191 },
+	{ 0x2e3du, 0x2e3du, cozette_block192 },
+	{ 0x3002u, 0x3002u, cozette_block193 },
+	{ 0x33d1u, 0x33d1u, cozette_block194 },
+	{ 0xa7a8u, 0xa7a8u, cozette_block195 },
+	{ 0xe000u, 0xe00au, cozette_block196 },
+	{ 0xe0a0u, 0xe0a3u, cozette_block197 },
+	{ 0xe0b0u, 0xe0bfu, cozette_block198 },
+	{ 0xe0d2u, 0xe0d2u, cozette_block199 },
+	{ 0xe0d4u, 0xe0d4u, cozette_block200 },
+	{ 0xe204u, 0xe204u, cozette_block201 },
+	{ 0xe20au, 0xe20cu, cozette_block202 },
+	{ 0xe21eu, 0xe21eu, cozette_block203 },
+	{ 0xe235u, 0xe235u, cozette_block204 },
+	{ 0xe244u, 0xe244u, cozette_block205 },
+	{ 0xe256u, 0xe256u, cozette_block206 },
+	{ 0xe271u, 0xe271u, cozette_block207 },
+	{ 0xe28au, 0xe28bu, cozette_block208 },
+	{ 0xe5fau, 0xe628u, cozette_block209 },
+	{ 0xe62au, 0xe62du, cozette_block210 },
+	{ 0xe634u, 0xe634u, cozette_block211 },
+	{ 0xe63au, 0xe63au, cozette_block212 },
+	{ 0xe64eu, 0xe64eu, cozette_block213 },
+	{ 0xe681u, 0xe681u, cozette_block214 },
+	{ 0xe697u, 0xe697u, cozette_block215 },
+	{ 0xe6a9u, 0xe6a9u, cozette_block216 },
+	{ 0xe702u, 0xe703u, cozette_block217 },
+	{ 0xe706u, 0xe707u, cozette_block218 },
+	{ 0xe70cu, 0xe70cu, cozette_block219 },
+	{ 0xe70eu, 0xe70fu, cozette_block220 },
+	{ 0xe711u, 0xe712u, cozette_block221 },
+	{ 0xe716u, 0xe716u, cozette_block222 },
+	{ 0xe718u, 0xe718u, cozette_block223 },
+	{ 0xe71eu, 0xe71eu, cozette_block224 },
+	{ 0xe725u, 0xe729u, cozette_block225 },
+	{ 0xe72du, 0xe72du, cozette_block226 },
+	{ 0xe736u, 0xe73fu, cozette_block227 },
+	{ 0xe743u, 0xe743u, cozette_block228 },
+	{ 0xe745u, 0xe746u, cozette_block229 },
+	{ 0xe749u, 0xe74au, cozette_block230 },
+	{ 0xe74eu, 0xe74eu, cozette_block231 },
+	{ 0xe755u, 0xe759u, cozette_block232 },
+	{ 0xe764u, 0xe764u, cozette_block233 },
+	{ 0xe768u, 0xe76au, cozette_block234 },
+	{ 0xe76du, 0xe76eu, cozette_block235 },
+	{ 0xe777u, 0xe777u, cozette_block236 },
+	{ 0xe779u, 0xe779u, cozette_block237 },
+	{ 0xe77bu, 0xe77bu, cozette_block238 },
+	{ 0xe77fu, 0xe77fu, cozette_block239 },
+	{ 0xe781u, 0xe781u, cozette_block240 },
+	{ 0xe786u, 0xe786u, cozette_block241 },
+	{ 0xe791u, 0xe791u, cozette_block242 },
+	{ 0xe795u, 0xe796u, cozette_block243 },
+	{ 0xe798u, 0xe798u, cozette_block244 },
+	{ 0xe7a2u, 0xe7a3u, cozette_block245 },
+	{ 0xe7a7u, 0xe7a8u, cozette_block246 },
+	{ 0xe7aau, 0xe7aau, cozette_block247 },
+	{ 0xe7afu, 0xe7b1u, cozette_block248 },
+	{ 0xe7b4u, 0xe7b5u, cozette_block249 },
+	{ 0xe7b8u, 0xe7b8u, cozette_block250 },
+	{ 0xe7bau, 0xe7bau, cozette_block251 },
+	{ 0xe7c4u, 0xe7c5u, cozette_block252 },
+	{ 0xeffau, 0xeffdu, cozette_block253 },
+	{ 0xf001u, 0xf001u, cozette_block254 },
+	{ 0xf005u, 0xf005u, cozette_block255 },
+	{ 0xf008u, 0xf008u, cozette_block256 },
+	{ 0xf00bu, 0xf00du, cozette_block257 },
+	{ 0xf013u, 0xf017u, cozette_block258 },
+	{ 0xf01au, 0xf01cu, cozette_block259 },
+	{ 0xf023u, 0xf023u, cozette_block260 },
+	{ 0xf025u, 0xf028u, cozette_block261 },
+	{ 0xf02bu, 0xf02bu, cozette_block262 },
+	{ 0xf02du, 0xf02du, cozette_block263 },
+	{ 0xf031u, 0xf035u, cozette_block264 },
+	{ 0xf03au, 0xf03au, cozette_block265 },
+	{ 0xf03du, 0xf03eu, cozette_block266 },
+	{ 0xf040u, 0xf040u, cozette_block267 },
+	{ 0xf048u, 0xf04eu, cozette_block268 },
+	{ 0xf050u, 0xf05au, cozette_block269 },
+	{ 0xf064u, 0xf064u, cozette_block270 },
+	{ 0xf067u, 0xf06au, cozette_block271 },
+	{ 0xf071u, 0xf071u, cozette_block272 },
+	{ 0xf073u, 0xf073u, cozette_block273 },
+	{ 0xf075u, 0xf076u, cozette_block274 },
+	{ 0xf07bu, 0xf07cu, cozette_block275 },
+	{ 0xf080u, 0xf080u, cozette_block276 },
+	{ 0xf084u, 0xf085u, cozette_block277 },
+	{ 0xf09cu, 0xf09cu, cozette_block278 },
+	{ 0xf09eu, 0xf09eu, cozette_block279 },
+	{ 0xf0a0u, 0xf0a0u, cozette_block280 },
+	{ 0xf0a2u, 0xf0a2u, cozette_block281 },
+	{ 0xf0acu, 0xf0acu, cozette_block282 },
+	{ 0xf0aeu, 0xf0aeu, cozette_block283 },
+	{ 0xf0b0u, 0xf0b0u, cozette_block284 },
+	{ 0xf0c3u, 0xf0c5u, cozette_block285 },
+	{ 0xf0e4u, 0xf0e4u, cozette_block286 },
+	{ 0xf0e7u, 0xf0e7u, cozette_block287 },
+	{ 0xf0f3u, 0xf0f4u, cozette_block288 },
+	{ 0xf0f6u, 0xf0f6u, cozette_block289 },
+	{ 0xf0fdu, 0xf0fdu, cozette_block290 },
+	{ 0xf108u, 0xf108u, cozette_block291 },
+	{ 0xf111u, 0xf111u, cozette_block292 },
+	{ 0xf113u, 0xf115u, cozette_block293 },
+	{ 0xf11cu, 0xf11cu, cozette_block294 },
+	{ 0xf120u, 0xf121u, cozette_block295 },
+	{ 0xf126u, 0xf126u, cozette_block296 },
+	{ 0xf130u, 0xf131u, cozette_block297 },
+	{ 0xf133u, 0xf133u, cozette_block298 },
+	{ 0xf13bu, 0xf13bu, cozette_block299 },
+	{ 0xf13eu, 0xf13eu, cozette_block300 },
+	{ 0xf144u, 0xf144u, cozette_block301 },
+	{ 0xf155u, 0xf155u, cozette_block302 },
+	{ 0xf15bu, 0xf15eu, cozette_block303 },
+	{ 0xf16bu, 0xf16bu, cozette_block304 },
+	{ 0xf179u, 0xf17cu, cozette_block305 },
+	{ 0xf185u, 0xf185u, cozette_block306 },
+	{ 0xf187u, 0xf188u, cozette_block307 },
+	{ 0xf18du, 0xf18du, cozette_block308 },
+	{ 0xf198u, 0xf198u, cozette_block309 },
+	{ 0xf1b6u, 0xf1b7u, cozette_block310 },
+	{ 0xf1bbu, 0xf1bbu, cozette_block311 },
+	{ 0xf1bdu, 0xf1bdu, cozette_block312 },
+	{ 0xf1c0u, 0xf1c6u, cozette_block313 },
+	{ 0xf1d3u, 0xf1d3u, cozette_block314 },
+	{ 0xf1eau, 0xf1ebu, cozette_block315 },
+	{ 0xf1f6u, 0xf1f8u, cozette_block316 },
+	{ 0xf1fau, 0xf1fau, cozette_block317 },
+	{ 0xf1feu, 0xf1feu, cozette_block318 },
+	{ 0xf200u, 0xf201u, cozette_block319 },
+	{ 0xf219u, 0xf219u, cozette_block320 },
+	{ 0xf233u, 0xf233u, cozette_block321 },
+	{ 0xf240u, 0xf244u, cozette_block322 },
+	{ 0xf250u, 0xf254u, cozette_block323 },
+	{ 0xf260u, 0xf260u, cozette_block324 },
+	{ 0xf268u, 0xf26au, cozette_block325 },
+	{ 0xf270u, 0xf270u, cozette_block326 },
+	{ 0xf292u, 0xf294u, cozette_block327 },
+	{ 0xf296u, 0xf296u, cozette_block328 },
+	{ 0xf298u, 0xf298u, cozette_block329 },
+	{ 0xf2c7u, 0xf2cbu, cozette_block330 },
+	{ 0xf2dbu, 0xf2dcu, cozette_block331 },
+	{ 0xf300u, 0xf30au, cozette_block332 },
+	{ 0xf30cu, 0xf30eu, cozette_block333 },
+	{ 0xf310u, 0xf310u, cozette_block334 },
+	{ 0xf312u, 0xf314u, cozette_block335 },
+	{ 0xf317u, 0xf319u, cozette_block336 },
+	{ 0xf31bu, 0xf31cu, cozette_block337 },
+	{ 0xf401u, 0xf401u, cozette_block338 },
+	{ 0xf408u, 0xf408u, cozette_block339 },
+	{ 0xf40eu, 0xf411u, cozette_block340 },
+	{ 0xf413u, 0xf413u, cozette_block341 },
+	{ 0xf415u, 0xf415u, cozette_block342 },
+	{ 0xf417u, 0xf417u, cozette_block343 },
+	{ 0xf423u, 0xf423u, cozette_block344 },
+	{ 0xf425u, 0xf425u, cozette_block345 },
+	{ 0xf42bu, 0xf42bu, cozette_block346 },
+	{ 0xf431u, 0xf434u, cozette_block347 },
+	{ 0xf440u, 0xf440u, cozette_block348 },
+	{ 0xf447u, 0xf447u, cozette_block349 },
+	{ 0xf449u, 0xf44bu, cozette_block350 },
+	{ 0xf461u, 0xf462u, cozette_block351 },
+	{ 0xf464u, 0xf464u, cozette_block352 },
+	{ 0xf471u, 0xf471u, cozette_block353 },
+	{ 0xf475u, 0xf475u, cozette_block354 },
+	{ 0xf481u, 0xf482u, cozette_block355 },
+	{ 0xf489u, 0xf48au, cozette_block356 },
+	{ 0xf48eu, 0xf48eu, cozette_block357 },
+	{ 0xf498u, 0xf499u, cozette_block358 },
+	{ 0xf49bu, 0xf49bu, cozette_block359 },
+	{ 0xf49eu, 0xf49eu, cozette_block360 },
+	{ 0xf4a0u, 0xf4a0u, cozette_block361 },
+	{ 0xf4a5u, 0xf4a5u, cozette_block362 },
+	{ 0xf529u, 0xf529u, cozette_block363 },
+	{ 0xf53bu, 0xf53bu, cozette_block364 },
+	{ 0xf541u, 0xf544u, cozette_block365 },
+	{ 0xf54bu, 0xf54cu, cozette_block366 },
+	{ 0xf553u, 0xf553u, cozette_block367 },
+	{ 0xf55au, 0xf55cu, cozette_block368 },
+	{ 0xf578u, 0xf590u, cozette_block369 },
+	{ 0xf5aeu, 0xf5afu, cozette_block370 },
+	{ 0xf5b1u, 0xf5b2u, cozette_block371 },
+	{ 0xf5bcu, 0xf5bdu, cozette_block372 },
+	{ 0xf5ebu, 0xf5ebu, cozette_block373 },
+	{ 0xf631u, 0xf632u, cozette_block374 },
+	{ 0xf658u, 0xf659u, cozette_block375 },
+	{ 0xf668u, 0xf668u, cozette_block376 },
+	{ 0xf68cu, 0xf68cu, cozette_block377 },
+	{ 0xf6a6u, 0xf6a6u, cozette_block378 },
+	{ 0xf6b7u, 0xf6b9u, cozette_block379 },
+	{ 0xf6ffu, 0xf6ffu, cozette_block380 },
+	{ 0xf713u, 0xf713u, cozette_block381 },
+	{ 0xf718u, 0xf718u, cozette_block382 },
+	{ 0xf71au, 0xf71au, cozette_block383 },
+	{ 0xf71cu, 0xf71cu, cozette_block384 },
+	{ 0xf71eu, 0xf71eu, cozette_block385 },
+	{ 0xf722u, 0xf722u, cozette_block386 },
+	{ 0xf724u, 0xf724u, cozette_block387 },
+	{ 0xf72au, 0xf72bu, cozette_block388 },
+	{ 0xf72du, 0xf72du, cozette_block389 },
+	{ 0xf74au, 0xf74au, cozette_block390 },
+	{ 0xf783u, 0xf783u, cozette_block391 },
+	{ 0xf794u, 0xf794u, cozette_block392 },
+	{ 0xf7b7u, 0xf7b7u, cozette_block393 },
+	{ 0xf7cau, 0xf7cdu, cozette_block394 },
+	{ 0xf7cfu, 0xf7cfu, cozette_block395 },
+	{ 0xf7d9u, 0xf7d9u, cozette_block396 },
+	{ 0xf7fbu, 0xf7fbu, cozette_block397 },
+	{ 0xf80au, 0xf80au, cozette_block398 },
+	{ 0xf816u, 0xf816u, cozette_block399 },
+	{ 0xf81au, 0xf81au, cozette_block400 },
+	{ 0xf81fu, 0xf820u, cozette_block401 },
+	{ 0xf831u, 0xf837u, cozette_block402 },
+	{ 0xf83cu, 0xf83cu, cozette_block403 },
+	{ 0xf886u, 0xf886u, cozette_block404 },
+	{ 0xf89fu, 0xf89fu, cozette_block405 },
+	{ 0xf8d7u, 0xf8d7u, cozette_block406 },
+	{ 0xf8feu, 0xf8feu, cozette_block407 },
+	{ 0xfa7du, 0xfa80u, cozette_block408 },
+	{ 0xfaa8u, 0xfaa9u, cozette_block409 },
+	{ 0xfab6u, 0xfab6u, cozette_block410 },
+	{ 0xfabfu, 0xfabfu, cozette_block411 },
+	{ 0xfb68u, 0xfb68u, cozette_block412 },
+	{ 0xfbf1u, 0xfbf1u, cozette_block413 },
+	{ 0xfc2eu, 0xfc2eu, cozette_block414 },
+	{ 0xfc5bu, 0xfc5du, cozette_block415 },
+	{ 0xfcccu, 0xfcccu, cozette_block416 },
+	{ 0xfce4u, 0xfce4u, cozette_block417 },
+	{ 0xfd03u, 0xfd03u, cozette_block418 },
+	{ 0xfd05u, 0xfd10u, cozette_block419 },
+	{ 0xfd32u, 0xfd32u, cozette_block420 },
+	{ 0xfd42u, 0xfd42u, cozette_block421 },
+	{ 0xfe54u, 0xfe66u, cozette_block422 },
+	{ 0xfe68u, 0xfe6bu, cozette_block423 },
+	{ 0x1016fu, 0x1016fu, cozette_block424 },
+	{ 0x102a6u, 0x102a6u, cozette_block425 },
+	{ 0x102c9u, 0x102c9u, cozette_block426 },
+	{ 0x102cfu, 0x102cfu, cozette_block427 },
+	{ 0x10315u, 0x10315u, cozette_block428 },
+	{ 0x10343u, 0x10343u, cozette_block429 },
+	{ 0x1d53du, 0x1d53eu, cozette_block430 },
+	{ 0x1d54au, 0x1d54au, cozette_block431 },
+	{ 0x1d54eu, 0x1d54fu, cozette_block432 },
+	{ 0x1d557u, 0x1d558u, cozette_block433 },
+	{ 0x1d563u, 0x1d564u, cozette_block434 },
+	{ 0x1d568u, 0x1d569u, cozette_block435 },
+	{ 0x1f31eu, 0x1f31eu, cozette_block436 },
+	{ 0x1f331u, 0x1f331u, cozette_block437 },
+	{ 0x1f333u, 0x1f333u, cozette_block438 },
+	{ 0x1f379u, 0x1f379u, cozette_block439 },
+	{ 0x1f40fu, 0x1f40fu, cozette_block440 },
+	{ 0x1f418u, 0x1f418u, cozette_block441 },
+	{ 0x1f447u, 0x1f448u, cozette_block442 },
+	{ 0x1f48eu, 0x1f48eu, cozette_block443 },
+	{ 0x1f4a0u, 0x1f4a1u, cozette_block444 },
+	{ 0x1f4c4u, 0x1f4c4u, cozette_block445 },
+	{ 0x1f4e6u, 0x1f4e6u, cozette_block446 },
+	{ 0x1f50bu, 0x1f50bu, cozette_block447 },
+	{ 0x1f512u, 0x1f512u, cozette_block448 },
+	{ 0x1f52eu, 0x1f52eu, cozette_block449 },
+	{ 0x1f608u, 0x1f608u, cozette_block450 },
+	{ 0x1f6e1u, 0x1f6e1u, cozette_block451 },
+	{ 0xf0002u, 0xf0002u, cozette_block452 },
+	{ 0xf006fu, 0xf006fu, cozette_block453 },
+	{ 0xf0172u, 0xf0172u, cozette_block454 },
+	{ 0xf01a8u, 0xf01a8u, cozette_block455 },
+	{ 0xf01f0u, 0xf01f0u, cozette_block456 },
+	{ 0xf0232u, 0xf0232u, cozette_block457 },
+	{ 0xf02d1u, 0xf02d1u, cozette_block458 },
+	{ 0xf02d4u, 0xf02d4u, cozette_block459 },
+	{ 0xf0306u, 0xf0306u, cozette_block460 },
+	{ 0xf031bu, 0xf031bu, cozette_block461 },
+	{ 0xf0320u, 0xf0320u, cozette_block462 },
+	{ 0xf0411u, 0xf0411u, cozette_block463 },
+	{ 0xf048du, 0xf048du, cozette_block464 },
+	{ 0xf05c6u, 0xf05c6u, cozette_block465 },
+	{ 0xf0645u, 0xf0645u, cozette_block466 },
+	{ 0xf06a9u, 0xf06a9u, cozette_block467 },
+	{ 0xf072bu, 0xf072bu, cozette_block468 },
+	{ 0xf07d4u, 0xf07d4u, cozette_block469 },
+	{ 0xf0844u, 0xf0844u, cozette_block470 },
+	{ 0xf0a0au, 0xf0a0au, cozette_block471 },
+	{ 0xf1417u, 0xf1417u, cozette_block472 },
+};
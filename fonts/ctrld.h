@@ -396,3 +396,30 @@ static const unsigned char ctrld_block25[][16] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+EEF9 ()
 }; // 10
 
+static const FBInkGlyphRange ctrld_ranges[] = {
+	{ 0x0au, 0xffu, ctrld_block1 },
+	{ 0x3bbu, 0x3bbu, ctrld_block2 },
+	{ 0x3c0u, 0x3c0u, ctrld_block3 },
+	{ 0x2190u, 0x2193u, ctrld_block4 },
+	{ 0x21b5u, 0x21b5u, ctrld_block5 },
+	{ 0x21e0u, 0x21e3u, ctrld_block6 },
+	{ 0x25a0u, 0x25a0u, ctrld_block7 },
+	{ 0x25aau, 0x25aau, ctrld_block8 },
+	{ 0x25b4u, 0x25b4u, ctrld_block9 },
+	{ 0x25b8u, 0x25b8u, ctrld_block10 },
+	{ 0x25beu, 0x25beu, ctrld_block11 },
+	{ 0x25c2u, 0x25c2u, ctrld_block12 },
+	{ 0x25c6u, 0x25c6u, ctrld_block13 },
+	{ 0x2713u, 0x2713u, ctrld_block14 },
+	{ 0x2717u, 0x2717u, ctrld_block15 },
+	{ 0x276eu, 0x276fu, ctrld_block16 },
+	{ 0x27f3u, 0x27f3u, ctrld_block17 },
+	{ 0xe0a0u, 0xe0a3u, ctrld_block18 },
+	{ 0xe0b0u, 0xe0b7u, ctrld_block19 },
+	{ 0xee00u, 0xee03u, ctrld_block20 },
+	{ 0xee10u, 0xee13u, ctrld_block21 },
+	{ 0xee20u, 0xee23u, ctrld_block22 },
+	{ 0xee30u, 0xee37u, ctrld_block23 },
+	{ 0xee40u, 0xee43u, ctrld_block24 },
+	{ 0xeef0u, 0xeef9u, ctrld_block25 },
+};
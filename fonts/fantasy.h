@@ -3893,3 +3893,237 @@ static const unsigned char fantasy_block232[][8] = {
 	{ 0x3e, 0x63, 0x63, 0x3e, 0x60, 0x60, 0x3e, 0x00 },	// U+1FBF9 (🯹)
 }; // 10
 
+static const FBInkGlyphRange fantasy_ranges[] = {
+	{ 0x00u, 0x195u, fantasy_block1 },
+	{ 0x197u, 0x19fu, fantasy_block2 },
+	{ 0x1b7u, 0x1b7u, fantasy_block3 },
+	{ 0x1cdu, 0x1e3u, fantasy_block4 },
+	{ 0x1e6u, 0x1e9u, fantasy_block5 },
+	{ 0x1eeu, 0x1f0u, fantasy_block6 },
+	{ 0x1f4u, 0x1f5u, fantasy_block7 },
+	{ 0x1f8u, 0x21bu, fantasy_block8 },
+	{ 0x226u, 0x227u, fantasy_block9 },
+	{ 0x22au, 0x233u, fantasy_block10 },
+	{ 0x258u, 0x259u, fantasy_block11 },
+	{ 0x263u, 0x263u, fantasy_block12 },
+	{ 0x292u, 0x292u, fantasy_block13 },
+	{ 0x294u, 0x294u, fantasy_block14 },
+	{ 0x2c6u, 0x2c6u, fantasy_block15 },
+	{ 0x2c9u, 0x2c9u, fantasy_block16 },
+	{ 0x2cdu, 0x2cdu, fantasy_block17 },
+	{ 0x2dcu, 0x2dcu, fantasy_block18 },
+	{ 0x300u, 0x30du, fantasy_block19 },
+	{ 0x30fu, 0x311u, fantasy_block20 },
+	{ 0x313u, 0x318u, fantasy_block21 },
+	{ 0x31bu, 0x31cu, fantasy_block22 },
+	{ 0x31fu, 0x329u, fantasy_block23 },
+	{ 0x32bu, 0x32cu, fantasy_block24 },
+	{ 0x32eu, 0x32eu, fantasy_block25 },
+	{ 0x330u, 0x330u, fantasy_block26 },
+	{ 0x332u, 0x333u, fantasy_block27 },
+	{ 0x335u, 0x33eu, fantasy_block28 },
+	{ 0x340u, 0x344u, fantasy_block29 },
+	{ 0x34fu, 0x34fu, fantasy_block30 },
+	{ 0x362u, 0x362u, fantasy_block31 },
+	{ 0x386u, 0x386u, fantasy_block32 },
+	{ 0x388u, 0x38au, fantasy_block33 },
+	{ 0x38cu, 0x38cu, fantasy_block34 },
+	{ 0x38eu, 0x38fu, fantasy_block35 },
+	{ 0x391u, 0x3a1u, fantasy_block36 },
+	{ 0x3a3u, 0x3afu, fantasy_block37 },
+	{ 0x3b1u, 0x3ceu, fantasy_block38 },
+	{ 0x400u, 0x401u, fantasy_block39 },
+	{ 0x405u, 0x409u, fantasy_block40 },
+	{ 0x410u, 0x451u, fantasy_block41 },
+	{ 0x455u, 0x458u, fantasy_block42 },
+	{ 0x4d0u, 0x4d7u, fantasy_block43 },
+	{ 0x4e6u, 0x4e7u, fantasy_block44 },
+	{ 0x4f1u, 0x4f1u, fantasy_block45 },
+	{ 0x5d0u, 0x5eau, fantasy_block46 },
+	{ 0x623u, 0x623u, fantasy_block47 },
+	{ 0x627u, 0x62du, fantasy_block48 },
+	{ 0x62fu, 0x635u, fantasy_block49 },
+	{ 0x637u, 0x63au, fantasy_block50 },
+	{ 0x640u, 0x64au, fantasy_block51 },
+	{ 0x671u, 0x673u, fantasy_block52 },
+	{ 0x1560u, 0x1563u, fantasy_block53 },
+	{ 0x156au, 0x156au, fantasy_block54 },
+	{ 0x156cu, 0x1571u, fantasy_block55 },
+	{ 0x15ecu, 0x15edu, fantasy_block56 },
+	{ 0x15efu, 0x15efu, fantasy_block57 },
+	{ 0x16a0u, 0x16abu, fantasy_block58 },
+	{ 0x16b1u, 0x16f8u, fantasy_block59 },
+	{ 0x1e00u, 0x1e02u, fantasy_block60 },
+	{ 0x1e04u, 0x1e07u, fantasy_block61 },
+	{ 0x1e0au, 0x1e0au, fantasy_block62 },
+	{ 0x1e0cu, 0x1e0fu, fantasy_block63 },
+	{ 0x1e41u, 0x1e4bu, fantasy_block64 },
+	{ 0x1e58u, 0x1e5bu, fantasy_block65 },
+	{ 0x1e5eu, 0x1e5eu, fantasy_block66 },
+	{ 0x1f00u, 0x1f7du, fantasy_block67 },
+	{ 0x1f80u, 0x1fb4u, fantasy_block68 },
+	{ 0x1fb6u, 0x1fbcu, fantasy_block69 },
+	{ 0x1fc2u, 0x1fc4u, fantasy_block70 },
+	{ 0x1fc6u, 0x1fc7u, fantasy_block71 },
+	{ 0x1fcau, 0x1fccu, fantasy_block72 },
+	{ 0x1fd0u, 0x1fd4u, fantasy_block73 },
+	{ 0x1fd6u, 0x1fdcu, fantasy_block74 },
+	{ 0x1fe0u, 0x1fe3u, fantasy_block75 },
+	{ 0x1fe6u, 0x1febu, fantasy_block76 },
+	{ 0x1ff2u, 0x1ff4u, fantasy_block77 },
+	{ 0x1ff6u, 0x1ff7u, fantasy_block78 },
+	{ 0x1ffau, 0x1ffcu, fantasy_block79 },
+	{ 0x2010u, 0x2019u, fantasy_block80 },
+	{ 0x201cu, 0x201du, fantasy_block81 },
+	{ 0x2020u, 0x2022u, fantasy_block82 },
+	{ 0x2024u, 0x2026u, fantasy_block83 },
+	{ 0x2030u, 0x2037u, fantasy_block84 },
+	{ 0x203cu, 0x203du, fantasy_block85 },
+	{ 0x2044u, 0x2044u, fantasy_block86 },
+	{ 0x2047u, 0x2049u, fantasy_block87 },
+	{ 0x2070u, 0x2071u, fantasy_block88 },
+	{ 0x2074u, 0x207cu, fantasy_block89 },
+	{ 0x207fu, 0x207fu, fantasy_block90 },
+	{ 0x20a7u, 0x20a7u, fantasy_block91 },
+	{ 0x20acu, 0x20acu, fantasy_block92 },
+	{ 0x2117u, 0x2117u, fantasy_block93 },
+	{ 0x2120u, 0x2120u, fantasy_block94 },
+	{ 0x2122u, 0x2122u, fantasy_block95 },
+	{ 0x2150u, 0x215fu, fantasy_block96 },
+	{ 0x2189u, 0x2189u, fantasy_block97 },
+	{ 0x2190u, 0x2199u, fantasy_block98 },
+	{ 0x21a5u, 0x21a5u, fantasy_block99 },
+	{ 0x21a8u, 0x21a8u, fantasy_block100 },
+	{ 0x21b2u, 0x21b2u, fantasy_block101 },
+	{ 0x21bcu, 0x21c3u, fantasy_block102 },
+	{ 0x21e6u, 0x21e9u, fantasy_block103 },
+	{ 0x2205u, 0x2205u, fantasy_block104 },
+	{ 0x2212u, 0x2215u, fantasy_block105 },
+	{ 0x2218u, 0x2218u, fantasy_block106 },
+	{ 0x221au, 0x221cu, fantasy_block107 },
+	{ 0x221eu, 0x221fu, fantasy_block108 },
+	{ 0x2229u, 0x2229u, fantasy_block109 },
+	{ 0x2248u, 0x2248u, fantasy_block110 },
+	{ 0x2261u, 0x2261u, fantasy_block111 },
+	{ 0x2264u, 0x2265u, fantasy_block112 },
+	{ 0x22c5u, 0x22c5u, fantasy_block113 },
+	{ 0x2301u, 0x2301u, fantasy_block114 },
+	{ 0x2318u, 0x2318u, fantasy_block115 },
+	{ 0x231au, 0x231bu, fantasy_block116 },
+	{ 0x2320u, 0x2321u, fantasy_block117 },
+	{ 0x239bu, 0x23afu, fantasy_block118 },
+	{ 0x23b2u, 0x23b3u, fantasy_block119 },
+	{ 0x23b7u, 0x23bdu, fantasy_block120 },
+	{ 0x23d0u, 0x23d0u, fantasy_block121 },
+	{ 0x23dau, 0x23dau, fantasy_block122 },
+	{ 0x23e9u, 0x23ecu, fantasy_block123 },
+	{ 0x2500u, 0x25ffu, fantasy_block124 },
+	{ 0x2602u, 0x2602u, fantasy_block125 },
+	{ 0x2605u, 0x2606u, fantasy_block126 },
+	{ 0x2609u, 0x2609u, fantasy_block127 },
+	{ 0x260eu, 0x260eu, fantasy_block128 },
+	{ 0x2610u, 0x2612u, fantasy_block129 },
+	{ 0x2615u, 0x2615u, fantasy_block130 },
+	{ 0x2625u, 0x2625u, fantasy_block131 },
+	{ 0x2628u, 0x2628u, fantasy_block132 },
+	{ 0x262fu, 0x2637u, fantasy_block133 },
+	{ 0x2639u, 0x263bu, fantasy_block134 },
+	{ 0x2640u, 0x2640u, fantasy_block135 },
+	{ 0x2642u, 0x2642u, fantasy_block136 },
+	{ 0x2660u, 0x2667u, fantasy_block137 },
+	{ 0x2669u, 0x266cu, fantasy_block138 },
+	{ 0x2683u, 0x2683u, fantasy_block139 },
+	{ 0x268au, 0x268fu, fantasy_block140 },
+	{ 0x269eu, 0x269fu, fantasy_block141 },
+	{ 0x26aau, 0x26acu, fantasy_block142 },
+	{ 0x26c8u, 0x26c8u, fantasy_block143 },
+	{ 0x26f5u, 0x26f5u, fantasy_block144 },
+	{ 0x2708u, 0x2708u, fantasy_block145 },
+	{ 0x2713u, 0x2713u, fantasy_block146 },
+	{ 0x2734u, 0x2735u, fantasy_block147 },
+	{ 0x2764u, 0x2764u, fantasy_block148 },
+	{ 0x2800u, 0x28ffu, fantasy_block149 },
+	{ 0x29c9u, 0x29c9u, fantasy_block150 },
+	{ 0x2b12u, 0x2b19u, fantasy_block151 },
+	{ 0x2b1du, 0x2b1du, fantasy_block152 },
+	{ 0x2b24u, 0x2b2fu, fantasy_block153 },
+	{ 0x2b55u, 0x2b55u, fantasy_block154 },
+	{ 0x2b58u, 0x2b58u, fantasy_block155 },
+	{ 0x2b73u, 0x2b73u, fantasy_block156 },
+	{ 0x2b9cu, 0x2b9fu, fantasy_block157 },
+	{ 0x2bbau, 0x2bbau, fantasy_block158 },
+	{ 0x2bc0u, 0x2bc0u, fantasy_block159 },
+	{ 0x2bc5u, 0x2bc8u, fantasy_block160 },
+	{ 0x2bcau, 0x2bcbu, fantasy_block161 },
+	{ 0x2e2eu, 0x2e2eu, fantasy_block162 },
+	{ 0x4dc0u, 0x4dffu, fantasy_block163 },
+	{ 0xe080u, 0xe1aau, fantasy_block164 },
+	{ 0xe800u, 0xe87du, fantasy_block165 },
+	{ 0xec00u, 0xec07u, fantasy_block166 },
+	{ 0xec0au, 0xec7du, fantasy_block167 },
+	{ 0xec7fu, 0xecdeu, fantasy_block168 },
+	{ 0xfe81u, 0xfe82u, fantasy_block169 },
+	{ 0xfe84u, 0xfe84u, fantasy_block170 },
+	{ 0xfe87u, 0xfe87u, fantasy_block171 },
+	{ 0xfe8fu, 0xfe9cu, fantasy_block172 },
+	{ 0xfe9eu, 0xfea4u, fantasy_block173 },
+	{ 0xfea9u, 0xfeadu, fantasy_block174 },
+	{ 0xfeafu, 0xfeafu, fantasy_block175 },
+	{ 0xfeb1u, 0xfeb7u, fantasy_block176 },
+	{ 0xfeb9u, 0xfebcu, fantasy_block177 },
+	{ 0xfec1u, 0xfec6u, fantasy_block178 },
+	{ 0xfec9u, 0xfeddu, fantasy_block179 },
+	{ 0xfedfu, 0xfee3u, fantasy_block180 },
+	{ 0xfee5u, 0xfee9u, fantasy_block181 },
+	{ 0xfeebu, 0xfef4u, fantasy_block182 },
+	{ 0xff01u, 0xff36u, fantasy_block183 },
+	{ 0xff38u, 0xff5du, fantasy_block184 },
+	{ 0xff5fu, 0xff9fu, fantasy_block185 },
+	{ 0x1d300u, 0x1d356u, fantasy_block186 },
+	{ 0x1f332u, 0x1f333u, fantasy_block187 },
+	{ 0x1f344u, 0x1f345u, fantasy_block188 },
+	{ 0x1f34eu, 0x1f34fu, fantasy_block189 },
+	{ 0x1f37au, 0x1f37au, fantasy_block190 },
+	{ 0x1f37eu, 0x1f37eu, fantasy_block191 },
+	{ 0x1f3ceu, 0x1f3ceu, fantasy_block192 },
+	{ 0x1f3d0u, 0x1f3d0u, fantasy_block193 },
+	{ 0x1f3f0u, 0x1f3f0u, fantasy_block194 },
+	{ 0x1f407u, 0x1f408u, fantasy_block195 },
+	{ 0x1f40du, 0x1f40du, fantasy_block196 },
+	{ 0x1f419u, 0x1f419u, fantasy_block197 },
+	{ 0x1f41fu, 0x1f41fu, fantasy_block198 },
+	{ 0x1f42au, 0x1f42au, fantasy_block199 },
+	{ 0x1f47bu, 0x1f47bu, fantasy_block200 },
+	{ 0x1f47eu, 0x1f47eu, fantasy_block201 },
+	{ 0x1f480u, 0x1f480u, fantasy_block202 },
+	{ 0x1f48du, 0x1f48eu, fantasy_block203 },
+	{ 0x1f4a7u, 0x1f4a7u, fantasy_block204 },
+	{ 0x1f4adu, 0x1f4adu, fantasy_block205 },
+	{ 0x1f4b0u, 0x1f4b0u, fantasy_block206 },
+	{ 0x1f4beu, 0x1f4beu, fantasy_block207 },
+	{ 0x1f4c1u, 0x1f4c1u, fantasy_block208 },
+	{ 0x1f4c4u, 0x1f4c4u, fantasy_block209 },
+	{ 0x1f4dcu, 0x1f4dcu, fantasy_block210 },
+	{ 0x1f4fbu, 0x1f4fbu, fantasy_block211 },
+	{ 0x1f514u, 0x1f514u, fantasy_block212 },
+	{ 0x1f52bu, 0x1f52bu, fantasy_block213 },
+	{ 0x1f52eu, 0x1f52eu, fantasy_block214 },
+	{ 0x1f574u, 0x1f574u, fantasy_block215 },
+	{ 0x1f577u, 0x1f577u, fantasy_block216 },
+	{ 0x1f5a8u, 0x1f5a8u, fantasy_block217 },
+	{ 0x1f5d1u, 0x1f5d1u, fantasy_block218 },
+	{ 0x1f68du, 0x1f68du, fantasy_block219 },
+	{ 0x1f6d6u, 0x1f6d6u, fantasy_block220 },
+	{ 0x1f6f8u, 0x1f6f8u, fantasy_block221 },
+	{ 0x1f860u, 0x1f860u, fantasy_block222 },
+	{ 0x1f986u, 0x1f986u, fantasy_block223 },
+	{ 0x1f98bu, 0x1f98bu, fantasy_block224 },
+	{ 0x1f9f2u, 0x1f9f2u, fantasy_block225 },
+	{ 0x1fa90u, 0x1fa90u, fantasy_block226 },
+	{ 0x1fa93u, 0x1fa93u, fantasy_block227 },
+	{ 0x1fa99u, 0x1fa99u, fantasy_block228 },
+	{ 0x1fa9cu, 0x1fa9cu, fantasy_block229 },
+	{ 0x1faa6u, 0x1faa8u, fantasy_block230 },
+	{ 0x1fb00u, 0x1fbcau, fantasy_block231 },
+	{ 0x1fbf0u, 0x1fbf9u, fantasy_block232 },
+};
@@ -836,3 +836,62 @@ static const unsigned char fatty_block57[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x1e, 0x33, 0x21, 0x2d, 0x2f, 0x23, 0x33, 0x3f, 0x12, 0x1e, 0x0c, 0x00, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange fatty_ranges[] = {
+	{ 0x00u, 0x00u, fatty_block1 },
+	{ 0x20u, 0x7fu, fatty_block2 },
+	{ 0xa0u, 0x17fu, fatty_block3 },
+	{ 0x218u, 0x21bu, fatty_block4 },
+	{ 0x2c7u, 0x2c7u, fatty_block5 },
+	{ 0x2d8u, 0x2d9u, fatty_block6 },
+	{ 0x2dbu, 0x2dbu, fatty_block7 },
+	{ 0x2ddu, 0x2ddu, fatty_block8 },
+	{ 0x1e02u, 0x1e03u, fatty_block9 },
+	{ 0x1e0au, 0x1e0bu, fatty_block10 },
+	{ 0x1e1eu, 0x1e1fu, fatty_block11 },
+	{ 0x1e40u, 0x1e41u, fatty_block12 },
+	{ 0x1e56u, 0x1e57u, fatty_block13 },
+	{ 0x1e60u, 0x1e61u, fatty_block14 },
+	{ 0x1e6au, 0x1e6bu, fatty_block15 },
+	{ 0x1e80u, 0x1e85u, fatty_block16 },
+	{ 0x1ef2u, 0x1ef3u, fatty_block17 },
+	{ 0x2010u, 0x2010u, fatty_block18 },
+	{ 0x2013u, 0x2015u, fatty_block19 },
+	{ 0x2018u, 0x2019u, fatty_block20 },
+	{ 0x201bu, 0x201fu, fatty_block21 },
+	{ 0x2022u, 0x2022u, fatty_block22 },
+	{ 0x2026u, 0x2026u, fatty_block23 },
+	{ 0x2030u, 0x2030u, fatty_block24 },
+	{ 0x2052u, 0x2052u, fatty_block25 },
+	{ 0x20acu, 0x20acu, fatty_block26 },
+	{ 0x2122u, 0x2122u, fatty_block27 },
+	{ 0x2192u, 0x2192u, fatty_block28 },
+	{ 0x2260u, 0x2260u, fatty_block29 },
+	{ 0x2500u, 0x2503u, fatty_block30 },
+	{ 0x250cu, 0x250cu, fatty_block31 },
+	{ 0x2510u, 0x2510u, fatty_block32 },
+	{ 0x2514u, 0x2514u, fatty_block33 },
+	{ 0x2518u, 0x2518u, fatty_block34 },
+	{ 0x251cu, 0x251cu, fatty_block35 },
+	{ 0x2524u, 0x2524u, fatty_block36 },
+	{ 0x252cu, 0x252cu, fatty_block37 },
+	{ 0x2534u, 0x2534u, fatty_block38 },
+	{ 0x253cu, 0x253cu, fatty_block39 },
+	{ 0x25a0u, 0x25a1u, fatty_block40 },
+	{ 0x25b2u, 0x25b2u, fatty_block41 },
+	{ 0x25bau, 0x25bau, fatty_block42 },
+	{ 0x25bcu, 0x25bcu, fatty_block43 },
+	{ 0x25cbu, 0x25cbu, fatty_block44 },
+	{ 0x25cfu, 0x25cfu, fatty_block45 },
+	{ 0x2603u, 0x2603u, fatty_block46 },
+	{ 0x2605u, 0x2606u, fatty_block47 },
+	{ 0x263au, 0x263au, fatty_block48 },
+	{ 0x2665u, 0x2665u, fatty_block49 },
+	{ 0x269bu, 0x269bu, fatty_block50 },
+	{ 0x2705u, 0x2705u, fatty_block51 },
+	{ 0x2708u, 0x2708u, fatty_block52 },
+	{ 0x2713u, 0x2713u, fatty_block53 },
+	{ 0x2744u, 0x2744u, fatty_block54 },
+	{ 0x2800u, 0x28ffu, fatty_block55 },
+	{ 0x30fbu, 0x30fbu, fatty_block56 },
+	{ 0xfffdu, 0xfffdu, fatty_block57 },
+};
@@ -265,3 +265,6 @@ static const unsigned char fkp_block1[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00FF (ÿ)
 }; // 256
 
+static const FBInkGlyphRange fkp_ranges[] = {
+	{ 0x00u, 0xffu, fkp_block1 },
+};
@@ -234,3 +234,11 @@ static const unsigned char kates_block6[][15] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x10, 0x0f, 0x00 },	// U+00FF (ÿ)
 }; // 82
 
+static const FBInkGlyphRange kates_ranges[] = {
+	{ 0x00u, 0x02u, kates_block1 },
+	{ 0x09u, 0x19u, kates_block2 },
+	{ 0x1bu, 0x1bu, kates_block3 },
+	{ 0x20u, 0x7eu, kates_block4 },
+	{ 0xa1u, 0xacu, kates_block5 },
+	{ 0xaeu, 0xffu, kates_block6 },
+};
@@ -2307,3 +2307,184 @@ static const unsigned char leggie_block179[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xaa, 0xaa, 0x92, 0x92, 0xaa, 0xaa, 0xc6, 0xc6, 0xfe, 0x00, 0x00 },	// U+FFFF (￿)
 }; // 1
 
+static const FBInkGlyphRange leggie_ranges[] = {
+	{ 0x20u, 0x7eu, leggie_block1 },
+	{ 0xa0u, 0x17fu, leggie_block2 },
+	{ 0x18eu, 0x18fu, leggie_block3 },
+	{ 0x192u, 0x192u, leggie_block4 },
+	{ 0x1a0u, 0x1a1u, leggie_block5 },
+	{ 0x1afu, 0x1b0u, leggie_block6 },
+	{ 0x1b5u, 0x1b7u, leggie_block7 },
+	{ 0x1cdu, 0x1ddu, leggie_block8 },
+	{ 0x1e4u, 0x1e9u, leggie_block9 },
+	{ 0x1eeu, 0x1efu, leggie_block10 },
+	{ 0x1fau, 0x1ffu, leggie_block11 },
+	{ 0x218u, 0x21bu, leggie_block12 },
+	{ 0x250u, 0x2eeu, leggie_block13 },
+	{ 0x37au, 0x37au, leggie_block14 },
+	{ 0x37eu, 0x37eu, leggie_block15 },
+	{ 0x384u, 0x386u, leggie_block16 },
+	{ 0x388u, 0x38au, leggie_block17 },
+	{ 0x38cu, 0x38cu, leggie_block18 },
+	{ 0x38eu, 0x3a1u, leggie_block19 },
+	{ 0x3a3u, 0x3ceu, leggie_block20 },
+	{ 0x400u, 0x477u, leggie_block21 },
+	{ 0x480u, 0x481u, leggie_block22 },
+	{ 0x48au, 0x493u, leggie_block23 },
+	{ 0x496u, 0x49du, leggie_block24 },
+	{ 0x4a0u, 0x4a3u, leggie_block25 },
+	{ 0x4aau, 0x4abu, leggie_block26 },
+	{ 0x4aeu, 0x4b1u, leggie_block27 },
+	{ 0x4bau, 0x4bbu, leggie_block28 },
+	{ 0x4c0u, 0x4c0u, leggie_block29 },
+	{ 0x4c5u, 0x4cau, leggie_block30 },
+	{ 0x4cdu, 0x4d9u, leggie_block31 },
+	{ 0x4e2u, 0x4e3u, leggie_block32 },
+	{ 0x4e6u, 0x4e9u, leggie_block33 },
+	{ 0x4ecu, 0x4f3u, leggie_block34 },
+	{ 0x4f8u, 0x4f9u, leggie_block35 },
+	{ 0x531u, 0x556u, leggie_block36 },
+	{ 0x559u, 0x55fu, leggie_block37 },
+	{ 0x561u, 0x587u, leggie_block38 },
+	{ 0x589u, 0x58au, leggie_block39 },
+	{ 0x58du, 0x58fu, leggie_block40 },
+	{ 0x5d0u, 0x5eau, leggie_block41 },
+	{ 0xca0u, 0xca0u, leggie_block42 },
+	{ 0x10d0u, 0x10f0u, leggie_block43 },
+	{ 0x10f6u, 0x10ffu, leggie_block44 },
+	{ 0x1e02u, 0x1e03u, leggie_block45 },
+	{ 0x1e0au, 0x1e0bu, leggie_block46 },
+	{ 0x1e1eu, 0x1e1fu, leggie_block47 },
+	{ 0x1e24u, 0x1e25u, leggie_block48 },
+	{ 0x1e36u, 0x1e37u, leggie_block49 },
+	{ 0x1e40u, 0x1e41u, leggie_block50 },
+	{ 0x1e56u, 0x1e57u, leggie_block51 },
+	{ 0x1e60u, 0x1e61u, leggie_block52 },
+	{ 0x1e6au, 0x1e6bu, leggie_block53 },
+	{ 0x1e80u, 0x1e85u, leggie_block54 },
+	{ 0x1e8au, 0x1e8bu, leggie_block55 },
+	{ 0x1ea0u, 0x1ef9u, leggie_block56 },
+	{ 0x2010u, 0x2027u, leggie_block57 },
+	{ 0x2030u, 0x203au, leggie_block58 },
+	{ 0x203cu, 0x205eu, leggie_block59 },
+	{ 0x2061u, 0x2064u, leggie_block60 },
+	{ 0x2070u, 0x2071u, leggie_block61 },
+	{ 0x2074u, 0x208eu, leggie_block62 },
+	{ 0x2090u, 0x209cu, leggie_block63 },
+	{ 0x20a1u, 0x20a1u, leggie_block64 },
+	{ 0x20a5u, 0x20afu, leggie_block65 },
+	{ 0x20b1u, 0x20b2u, leggie_block66 },
+	{ 0x20b4u, 0x20b5u, leggie_block67 },
+	{ 0x20b8u, 0x20bau, leggie_block68 },
+	{ 0x20bcu, 0x20bdu, leggie_block69 },
+	{ 0x2116u, 0x2116u, leggie_block70 },
+	{ 0x2122u, 0x2122u, leggie_block71 },
+	{ 0x212bu, 0x212bu, leggie_block72 },
+	{ 0x2190u, 0x2196u, leggie_block73 },
+	{ 0x2198u, 0x2198u, leggie_block74 },
+	{ 0x21a4u, 0x21a4u, leggie_block75 },
+	{ 0x21a6u, 0x21a6u, leggie_block76 },
+	{ 0x21a8u, 0x21a9u, leggie_block77 },
+	{ 0x21b5u, 0x21b5u, leggie_block78 },
+	{ 0x21b8u, 0x21b9u, leggie_block79 },
+	{ 0x21c6u, 0x21c6u, leggie_block80 },
+	{ 0x21d0u, 0x21d5u, leggie_block81 },
+	{ 0x21deu, 0x21dfu, leggie_block82 },
+	{ 0x21e4u, 0x21e5u, leggie_block83 },
+	{ 0x21e7u, 0x21e7u, leggie_block84 },
+	{ 0x21eau, 0x21eau, leggie_block85 },
+	{ 0x21f1u, 0x21f2u, leggie_block86 },
+	{ 0x2203u, 0x2203u, leggie_block87 },
+	{ 0x2205u, 0x2205u, leggie_block88 },
+	{ 0x2208u, 0x2208u, leggie_block89 },
+	{ 0x2219u, 0x221au, leggie_block90 },
+	{ 0x221eu, 0x221fu, leggie_block91 },
+	{ 0x2227u, 0x222au, leggie_block92 },
+	{ 0x2248u, 0x2248u, leggie_block93 },
+	{ 0x2260u, 0x2261u, leggie_block94 },
+	{ 0x2264u, 0x2265u, leggie_block95 },
+	{ 0x2296u, 0x2297u, leggie_block96 },
+	{ 0x229du, 0x229du, leggie_block97 },
+	{ 0x2302u, 0x2303u, leggie_block98 },
+	{ 0x2305u, 0x2305u, leggie_block99 },
+	{ 0x2310u, 0x2310u, leggie_block100 },
+	{ 0x2318u, 0x2318u, leggie_block101 },
+	{ 0x2320u, 0x2321u, leggie_block102 },
+	{ 0x2324u, 0x2328u, leggie_block103 },
+	{ 0x232bu, 0x232bu, leggie_block104 },
+	{ 0x233du, 0x233du, leggie_block105 },
+	{ 0x2380u, 0x2380u, leggie_block106 },
+	{ 0x2384u, 0x2384u, leggie_block107 },
+	{ 0x2386u, 0x2388u, leggie_block108 },
+	{ 0x238bu, 0x238bu, leggie_block109 },
+	{ 0x23bau, 0x23bdu, leggie_block110 },
+	{ 0x23ceu, 0x23cfu, leggie_block111 },
+	{ 0x2400u, 0x2426u, leggie_block112 },
+	{ 0x2500u, 0x2500u, leggie_block113 },
+	{ 0x2502u, 0x2502u, leggie_block114 },
+	{ 0x250cu, 0x250cu, leggie_block115 },
+	{ 0x2510u, 0x2510u, leggie_block116 },
+	{ 0x2514u, 0x2514u, leggie_block117 },
+	{ 0x2518u, 0x2518u, leggie_block118 },
+	{ 0x251cu, 0x251cu, leggie_block119 },
+	{ 0x2524u, 0x2524u, leggie_block120 },
+	{ 0x252cu, 0x252cu, leggie_block121 },
+	{ 0x2534u, 0x2534u, leggie_block122 },
+	{ 0x253cu, 0x253cu, leggie_block123 },
+	{ 0x2550u, 0x256cu, leggie_block124 },
+	{ 0x2580u, 0x2580u, leggie_block125 },
+	{ 0x2584u, 0x2584u, leggie_block126 },
+	{ 0x2588u, 0x2588u, leggie_block127 },
+	{ 0x258cu, 0x258cu, leggie_block128 },
+	{ 0x2590u, 0x2593u, leggie_block129 },
+	{ 0x25a0u, 0x25a1u, leggie_block130 },
+	{ 0x25a4u, 0x25a4u, leggie_block131 },
+	{ 0x25aau, 0x25acu, leggie_block132 },
+	{ 0x25b2u, 0x25b2u, leggie_block133 },
+	{ 0x25b6u, 0x25b8u, leggie_block134 },
+	{ 0x25bau, 0x25bau, leggie_block135 },
+	{ 0x25bcu, 0x25bcu, leggie_block136 },
+	{ 0x25c1u, 0x25c1u, leggie_block137 },
+	{ 0x25c4u, 0x25c4u, leggie_block138 },
+	{ 0x25c6u, 0x25c7u, leggie_block139 },
+	{ 0x25cau, 0x25cbu, leggie_block140 },
+	{ 0x25cfu, 0x25cfu, leggie_block141 },
+	{ 0x25d8u, 0x25d9u, leggie_block142 },
+	{ 0x25efu, 0x25efu, leggie_block143 },
+	{ 0x2610u, 0x2612u, leggie_block144 },
+	{ 0x263au, 0x263cu, leggie_block145 },
+	{ 0x2640u, 0x2640u, leggie_block146 },
+	{ 0x2642u, 0x2642u, leggie_block147 },
+	{ 0x2660u, 0x2660u, leggie_block148 },
+	{ 0x2663u, 0x2663u, leggie_block149 },
+	{ 0x2665u, 0x2666u, leggie_block150 },
+	{ 0x266au, 0x266bu, leggie_block151 },
+	{ 0x2713u, 0x2713u, leggie_block152 },
+	{ 0x2717u, 0x2717u, leggie_block153 },
+	{ 0x2726u, 0x2727u, leggie_block154 },
+	{ 0x2732u, 0x2732u, leggie_block155 },
+	{ 0x2756u, 0x2756u, leggie_block156 },
+	{ 0x2800u, 0x28ffu, leggie_block157 },
+	{ 0xa640u, 0xa643u, leggie_block158 },
+	{ 0xa64au, 0xa64bu, leggie_block159 },
+	{ 0xa650u, 0xa651u, leggie_block160 },
+	{ 0xa656u, 0xa657u, leggie_block161 },
+	{ 0xa790u, 0xa791u, leggie_block162 },
+	{ 0xe000u, 0xe005u, leggie_block163 },
+	{ 0xe010u, 0xe01au, leggie_block164 },
+	{ 0xe020u, 0xe025u, leggie_block165 },
+	{ 0xe030u, 0xe039u, leggie_block166 },
+	{ 0xe0a0u, 0xe0a2u, leggie_block167 },
+	{ 0xe0b0u, 0xe0b3u, leggie_block168 },
+	{ 0xf000u, 0xf002u, leggie_block169 },
+	{ 0xf800u, 0xf803u, leggie_block170 },
+	{ 0xf810u, 0xf813u, leggie_block171 },
+	{ 0xf8ffu, 0xf8ffu, leggie_block172 },
+	{ 0xfb00u, 0xfb06u, leggie_block173 },
+	{ 0xfb13u, 0xfb17u, leggie_block174 },
+	{ 0xfe50u, 0xfe52u, leggie_block175 },
+	{ 0xfe54u, 0xfe66u, leggie_block176 },
+	{ 0xfe68u, 0xfe6bu, leggie_block177 },
+	{ 0xfffdu, 0xfffdu, leggie_block178 },
+	{ 0xffffu, 0xffffu, leggie_block179 },
+};
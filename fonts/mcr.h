@@ -3893,3 +3893,237 @@ static const unsigned char mcr_block232[][8] = {
 	{ 0x3e, 0x63, 0x63, 0x3e, 0x60, 0x60, 0x3e, 0x00 },	// U+1FBF9 (🯹)
 }; // 10
 
+static const FBInkGlyphRange mcr_ranges[] = {
+	{ 0x00u, 0x195u, mcr_block1 },
+	{ 0x197u, 0x19fu, mcr_block2 },
+	{ 0x1b7u, 0x1b7u, mcr_block3 },
+	{ 0x1cdu, 0x1e3u, mcr_block4 },
+	{ 0x1e6u, 0x1e9u, mcr_block5 },
+	{ 0x1eeu, 0x1f0u, mcr_block6 },
+	{ 0x1f4u, 0x1f5u, mcr_block7 },
+	{ 0x1f8u, 0x21bu, mcr_block8 },
+	{ 0x226u, 0x227u, mcr_block9 },
+	{ 0x22au, 0x233u, mcr_block10 },
+	{ 0x258u, 0x259u, mcr_block11 },
+	{ 0x263u, 0x263u, mcr_block12 },
+	{ 0x292u, 0x292u, mcr_block13 },
+	{ 0x294u, 0x294u, mcr_block14 },
+	{ 0x2c6u, 0x2c6u, mcr_block15 },
+	{ 0x2c9u, 0x2c9u, mcr_block16 },
+	{ 0x2cdu, 0x2cdu, mcr_block17 },
+	{ 0x2dcu, 0x2dcu, mcr_block18 },
+	{ 0x300u, 0x30du, mcr_block19 },
+	{ 0x30fu, 0x311u, mcr_block20 },
+	{ 0x313u, 0x318u, mcr_block21 },
+	{ 0x31bu, 0x31cu, mcr_block22 },
+	{ 0x31fu, 0x329u, mcr_block23 },
+	{ 0x32bu, 0x32cu, mcr_block24 },
+	{ 0x32eu, 0x32eu, mcr_block25 },
+	{ 0x330u, 0x330u, mcr_block26 },
+	{ 0x332u, 0x333u, mcr_block27 },
+	{ 0x335u, 0x33eu, mcr_block28 },
+	{ 0x340u, 0x344u, mcr_block29 },
+	{ 0x34fu, 0x34fu, mcr_block30 },
+	{ 0x362u, 0x362u, mcr_block31 },
+	{ 0x386u, 0x386u, mcr_block32 },
+	{ 0x388u, 0x38au, mcr_block33 },
+	{ 0x38cu, 0x38cu, mcr_block34 },
+	{ 0x38eu, 0x38fu, mcr_block35 },
+	{ 0x391u, 0x3a1u, mcr_block36 },
+	{ 0x3a3u, 0x3afu, mcr_block37 },
+	{ 0x3b1u, 0x3ceu, mcr_block38 },
+	{ 0x400u, 0x401u, mcr_block39 },
+	{ 0x405u, 0x409u, mcr_block40 },
+	{ 0x410u, 0x451u, mcr_block41 },
+	{ 0x455u, 0x458u, mcr_block42 },
+	{ 0x4d0u, 0x4d7u, mcr_block43 },
+	{ 0x4e6u, 0x4e7u, mcr_block44 },
+	{ 0x4f1u, 0x4f1u, mcr_block45 },
+	{ 0x5d0u, 0x5eau, mcr_block46 },
+	{ 0x623u, 0x623u, mcr_block47 },
+	{ 0x627u, 0x62du, mcr_block48 },
+	{ 0x62fu, 0x635u, mcr_block49 },
+	{ 0x637u, 0x63au, mcr_block50 },
+	{ 0x640u, 0x64au, mcr_block51 },
+	{ 0x671u, 0x673u, mcr_block52 },
+	{ 0x1560u, 0x1563u, mcr_block53 },
+	{ 0x156au, 0x156au, mcr_block54 },
+	{ 0x156cu, 0x1571u, mcr_block55 },
+	{ 0x15ecu, 0x15edu, mcr_block56 },
+	{ 0x15efu, 0x15efu, mcr_block57 },
+	{ 0x16a0u, 0x16abu, mcr_block58 },
+	{ 0x16b1u, 0x16f8u, mcr_block59 },
+	{ 0x1e00u, 0x1e02u, mcr_block60 },
+	{ 0x1e04u, 0x1e07u, mcr_block61 },
+	{ 0x1e0au, 0x1e0au, mcr_block62 },
+	{ 0x1e0cu, 0x1e0fu, mcr_block63 },
+	{ 0x1e41u, 0x1e4bu, mcr_block64 },
+	{ 0x1e58u, 0x1e5bu, mcr_block65 },
+	{ 0x1e5eu, 0x1e5eu, mcr_block66 },
+	{ 0x1f00u, 0x1f7du, mcr_block67 },
+	{ 0x1f80u, 0x1fb4u, mcr_block68 },
+	{ 0x1fb6u, 0x1fbcu, mcr_block69 },
+	{ 0x1fc2u, 0x1fc4u, mcr_block70 },
+	{ 0x1fc6u, 0x1fc7u, mcr_block71 },
+	{ 0x1fcau, 0x1fccu, mcr_block72 },
+	{ 0x1fd0u, 0x1fd4u, mcr_block73 },
+	{ 0x1fd6u, 0x1fdcu, mcr_block74 },
+	{ 0x1fe0u, 0x1fe3u, mcr_block75 },
+	{ 0x1fe6u, 0x1febu, mcr_block76 },
+	{ 0x1ff2u, 0x1ff4u, mcr_block77 },
+	{ 0x1ff6u, 0x1ff7u, mcr_block78 },
+	{ 0x1ffau, 0x1ffcu, mcr_block79 },
+	{ 0x2010u, 0x2019u, mcr_block80 },
+	{ 0x201cu, 0x201du, mcr_block81 },
+	{ 0x2020u, 0x2022u, mcr_block82 },
+	{ 0x2024u, 0x2026u, mcr_block83 },
+	{ 0x2030u, 0x2037u, mcr_block84 },
+	{ 0x203cu, 0x203du, mcr_block85 },
+	{ 0x2044u, 0x2044u, mcr_block86 },
+	{ 0x2047u, 0x2049u, mcr_block87 },
+	{ 0x2070u, 0x2071u, mcr_block88 },
+	{ 0x2074u, 0x207cu, mcr_block89 },
+	{ 0x207fu, 0x207fu, mcr_block90 },
+	{ 0x20a7u, 0x20a7u, mcr_block91 },
+	{ 0x20acu, 0x20acu, mcr_block92 },
+	{ 0x2117u, 0x2117u, mcr_block93 },
+	{ 0x2120u, 0x2120u, mcr_block94 },
+	{ 0x2122u, 0x2122u, mcr_block95 },
+	{ 0x2150u, 0x215fu, mcr_block96 },
+	{ 0x2189u, 0x2189u, mcr_block97 },
+	{ 0x2190u, 0x2199u, mcr_block98 },
+	{ 0x21a5u, 0x21a5u, mcr_block99 },
+	{ 0x21a8u, 0x21a8u, mcr_block100 },
+	{ 0x21b2u, 0x21b2u, mcr_block101 },
+	{ 0x21bcu, 0x21c3u, mcr_block102 },
+	{ 0x21e6u, 0x21e9u, mcr_block103 },
+	{ 0x2205u, 0x2205u, mcr_block104 },
+	{ 0x2212u, 0x2215u, mcr_block105 },
+	{ 0x2218u, 0x2218u, mcr_block106 },
+	{ 0x221au, 0x221cu, mcr_block107 },
+	{ 0x221eu, 0x221fu, mcr_block108 },
+	{ 0x2229u, 0x2229u, mcr_block109 },
+	{ 0x2248u, 0x2248u, mcr_block110 },
+	{ 0x2261u, 0x2261u, mcr_block111 },
+	{ 0x2264u, 0x2265u, mcr_block112 },
+	{ 0x22c5u, 0x22c5u, mcr_block113 },
+	{ 0x2301u, 0x2301u, mcr_block114 },
+	{ 0x2318u, 0x2318u, mcr_block115 },
+	{ 0x231au, 0x231bu, mcr_block116 },
+	{ 0x2320u, 0x2321u, mcr_block117 },
+	{ 0x239bu, 0x23afu, mcr_block118 },
+	{ 0x23b2u, 0x23b3u, mcr_block119 },
+	{ 0x23b7u, 0x23bdu, mcr_block120 },
+	{ 0x23d0u, 0x23d0u, mcr_block121 },
+	{ 0x23dau, 0x23dau, mcr_block122 },
+	{ 0x23e9u, 0x23ecu, mcr_block123 },
+	{ 0x2500u, 0x25ffu, mcr_block124 },
+	{ 0x2602u, 0x2602u, mcr_block125 },
+	{ 0x2605u, 0x2606u, mcr_block126 },
+	{ 0x2609u, 0x2609u, mcr_block127 },
+	{ 0x260eu, 0x260eu, mcr_block128 },
+	{ 0x2610u, 0x2612u, mcr_block129 },
+	{ 0x2615u, 0x2615u, mcr_block130 },
+	{ 0x2625u, 0x2625u, mcr_block131 },
+	{ 0x2628u, 0x2628u, mcr_block132 },
+	{ 0x262fu, 0x2637u, mcr_block133 },
+	{ 0x2639u, 0x263bu, mcr_block134 },
+	{ 0x2640u, 0x2640u, mcr_block135 },
+	{ 0x2642u, 0x2642u, mcr_block136 },
+	{ 0x2660u, 0x2667u, mcr_block137 },
+	{ 0x2669u, 0x266cu, mcr_block138 },
+	{ 0x2683u, 0x2683u, mcr_block139 },
+	{ 0x268au, 0x268fu, mcr_block140 },
+	{ 0x269eu, 0x269fu, mcr_block141 },
+	{ 0x26aau, 0x26acu, mcr_block142 },
+	{ 0x26c8u, 0x26c8u, mcr_block143 },
+	{ 0x26f5u, 0x26f5u, mcr_block144 },
+	{ 0x2708u, 0x2708u, mcr_block145 },
+	{ 0x2713u, 0x2713u, mcr_block146 },
+	{ 0x2734u, 0x2735u, mcr_block147 },
+	{ 0x2764u, 0x2764u, mcr_block148 },
+	{ 0x2800u, 0x28ffu, mcr_block149 },
+	{ 0x29c9u, 0x29c9u, mcr_block150 },
+	{ 0x2b12u, 0x2b19u, mcr_block151 },
+	{ 0x2b1du, 0x2b1du, mcr_block152 },
+	{ 0x2b24u, 0x2b2fu, mcr_block153 },
+	{ 0x2b55u, 0x2b55u, mcr_block154 },
+	{ 0x2b58u, 0x2b58u, mcr_block155 },
+	{ 0x2b73u, 0x2b73u, mcr_block156 },
+	{ 0x2b9cu, 0x2b9fu, mcr_block157 },
+	{ 0x2bbau, 0x2bbau, mcr_block158 },
+	{ 0x2bc0u, 0x2bc0u, mcr_block159 },
+	{ 0x2bc5u, 0x2bc8u, mcr_block160 },
+	{ 0x2bcau, 0x2bcbu, mcr_block161 },
+	{ 0x2e2eu, 0x2e2eu, mcr_block162 },
+	{ 0x4dc0u, 0x4dffu, mcr_block163 },
+	{ 0xe080u, 0xe1aau, mcr_block164 },
+	{ 0xe800u, 0xe87du, mcr_block165 },
+	{ 0xec00u, 0xec07u, mcr_block166 },
+	{ 0xec0au, 0xec7du, mcr_block167 },
+	{ 0xec7fu, 0xecdeu, mcr_block168 },
+	{ 0xfe81u, 0xfe82u, mcr_block169 },
+	{ 0xfe84u, 0xfe84u, mcr_block170 },
+	{ 0xfe87u, 0xfe87u, mcr_block171 },
+	{ 0xfe8fu, 0xfe9cu, mcr_block172 },
+	{ 0xfe9eu, 0xfea4u, mcr_block173 },
+	{ 0xfea9u, 0xfeadu, mcr_block174 },
+	{ 0xfeafu, 0xfeafu, mcr_block175 },
+	{ 0xfeb1u, 0xfeb7u, mcr_block176 },
+	{ 0xfeb9u, 0xfebcu, mcr_block177 },
+	{ 0xfec1u, 0xfec6u, mcr_block178 },
+	{ 0xfec9u, 0xfeddu, mcr_block179 },
+	{ 0xfedfu, 0xfee3u, mcr_block180 },
+	{ 0xfee5u, 0xfee9u, mcr_block181 },
+	{ 0xfeebu, 0xfef4u, mcr_block182 },
+	{ 0xff01u, 0xff36u, mcr_block183 },
+	{ 0xff38u, 0xff5du, mcr_block184 },
+	{ 0xff5fu, 0xff9fu, mcr_block185 },
+	{ 0x1d300u, 0x1d356u, mcr_block186 },
+	{ 0x1f332u, 0x1f333u, mcr_block187 },
+	{ 0x1f344u, 0x1f345u, mcr_block188 },
+	{ 0x1f34eu, 0x1f34fu, mcr_block189 },
+	{ 0x1f37au, 0x1f37au, mcr_block190 },
+	{ 0x1f37eu, 0x1f37eu, mcr_block191 },
+	{ 0x1f3ceu, 0x1f3ceu, mcr_block192 },
+	{ 0x1f3d0u, 0x1f3d0u, mcr_block193 },
+	{ 0x1f3f0u, 0x1f3f0u, mcr_block194 },
+	{ 0x1f407u, 0x1f408u, mcr_block195 },
+	{ 0x1f40du, 0x1f40du, mcr_block196 },
+	{ 0x1f419u, 0x1f419u, mcr_block197 },
+	{ 0x1f41fu, 0x1f41fu, mcr_block198 },
+	{ 0x1f42au, 0x1f42au, mcr_block199 },
+	{ 0x1f47bu, 0x1f47bu, mcr_block200 },
+	{ 0x1f47eu, 0x1f47eu, mcr_block201 },
+	{ 0x1f480u, 0x1f480u, mcr_block202 },
+	{ 0x1f48du, 0x1f48eu, mcr_block203 },
+	{ 0x1f4a7u, 0x1f4a7u, mcr_block204 },
+	{ 0x1f4adu, 0x1f4adu, mcr_block205 },
+	{ 0x1f4b0u, 0x1f4b0u, mcr_block206 },
+	{ 0x1f4beu, 0x1f4beu, mcr_block207 },
+	{ 0x1f4c1u, 0x1f4c1u, mcr_block208 },
+	{ 0x1f4c4u, 0x1f4c4u, mcr_block209 },
+	{ 0x1f4dcu, 0x1f4dcu, mcr_block210 },
+	{ 0x1f4fbu, 0x1f4fbu, mcr_block211 },
+	{ 0x1f514u, 0x1f514u, mcr_block212 },
+	{ 0x1f52bu, 0x1f52bu, mcr_block213 },
+	{ 0x1f52eu, 0x1f52eu, mcr_block214 },
+	{ 0x1f574u, 0x1f574u, mcr_block215 },
+	{ 0x1f577u, 0x1f577u, mcr_block216 },
+	{ 0x1f5a8u, 0x1f5a8u, mcr_block217 },
+	{ 0x1f5d1u, 0x1f5d1u, mcr_block218 },
+	{ 0x1f68du, 0x1f68du, mcr_block219 },
+	{ 0x1f6d6u, 0x1f6d6u, mcr_block220 },
+	{ 0x1f6f8u, 0x1f6f8u, mcr_block221 },
+	{ 0x1f860u, 0x1f860u, mcr_block222 },
+	{ 0x1f986u, 0x1f986u, mcr_block223 },
+	{ 0x1f98bu, 0x1f98bu, mcr_block224 },
+	{ 0x1f9f2u, 0x1f9f2u, mcr_block225 },
+	{ 0x1fa90u, 0x1fa90u, mcr_block226 },
+	{ 0x1fa93u, 0x1fa93u, mcr_block227 },
+	{ 0x1fa99u, 0x1fa99u, mcr_block228 },
+	{ 0x1fa9cu, 0x1fa9cu, mcr_block229 },
+	{ 0x1faa6u, 0x1faa8u, mcr_block230 },
+	{ 0x1fb00u, 0x1fbcau, mcr_block231 },
+	{ 0x1fbf0u, 0x1fbf9u, mcr_block232 },
+};
@@ -265,3 +265,6 @@ static const unsigned char microknight_block1[][16] = {
 	{ 0x36, 0x36, 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x7e, 0x60, 0x60, 0x3e, 0x3e },	// U+00FF (ÿ)
 }; // 256
 
+static const FBInkGlyphRange microknight_ranges[] = {
+	{ 0x00u, 0xffu, microknight_block1 },
+};
@@ -4796,3 +4796,88 @@ static const unsigned char orp_block83[][12] = {
 	{ 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1b, 0x1f, 0x1b, 0x0e, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange orp_ranges[] = {
+	{ 0x00u, 0x00u, orp_block1 },
+	{ 0x20u, 0x7eu, orp_block2 },
+	{ 0xa0u, 0x377u, orp_block3 },
+	{ 0x37au, 0x37eu, orp_block4 },
+	{ 0x384u, 0x38au, orp_block5 },
+	{ 0x38cu, 0x38cu, orp_block6 },
+	{ 0x38eu, 0x3a1u, orp_block7 },
+	{ 0x3a3u, 0x523u, orp_block8 },
+	{ 0x531u, 0x556u, orp_block9 },
+	{ 0x559u, 0x55fu, orp_block10 },
+	{ 0x561u, 0x587u, orp_block11 },
+	{ 0x589u, 0x58au, orp_block12 },
+	{ 0x591u, 0x5c7u, orp_block13 },
+	{ 0x5d0u, 0x5eau, orp_block14 },
+	{ 0x5f0u, 0x5f4u, orp_block15 },
+	{ 0x1680u, 0x169cu, orp_block16 },
+	{ 0x16a0u, 0x16f0u, orp_block17 },
+	{ 0x1e02u, 0x1e07u, orp_block18 },
+	{ 0x1e0au, 0x1e13u, orp_block19 },
+	{ 0x1e1eu, 0x1e1fu, orp_block20 },
+	{ 0x1e30u, 0x1e35u, orp_block21 },
+	{ 0x1e3eu, 0x1e43u, orp_block22 },
+	{ 0x1e54u, 0x1e57u, orp_block23 },
+	{ 0x1e60u, 0x1e71u, orp_block24 },
+	{ 0x1e80u, 0x1e8fu, orp_block25 },
+	{ 0x1ef2u, 0x1ef9u, orp_block26 },
+	{ 0x1f00u, 0x1f15u, orp_block27 },
+	{ 0x1f18u, 0x1f1du, orp_block28 },
+	{ 0x1f20u, 0x1f45u, orp_block29 },
+	{ 0x1f48u, 0x1f4du, orp_block30 },
+	{ 0x1f50u, 0x1f57u, orp_block31 },
+	{ 0x1f59u, 0x1f59u, orp_block32 },
+	{ 0x1f5bu, 0x1f5bu, orp_block33 },
+	{ 0x1f5du, 0x1f5du, orp_block34 },
+	{ 0x1f5fu, 0x1f7du, orp_block35 },
+	{ 0x1f80u, 0x1fb4u, orp_block36 },
+	{ 0x1fb6u, 0x1fc4u, orp_block37 },
+	{ 0x1fc6u, 0x1fd3u, orp_block38 },
+	{ 0x1fd6u, 0x1fdbu, orp_block39 },
+	{ 0x1fddu, 0x1fefu, orp_block40 },
+	{ 0x1ff2u, 0x1ff4u, orp_block41 },
+	{ 0x1ff6u, 0x1ffeu, orp_block42 },
+	{ 0x2010u, 0x2027u, orp_block43 },
+	{ 0x2030u, 0x205eu, orp_block44 },
+	{ 0x2070u, 0x2071u, orp_block45 },
+	{ 0x2074u, 0x208eu, orp_block46 },
+	{ 0x2090u, 0x2094u, orp_block47 },
+	{ 0x20a0u, 0x20b5u, orp_block48 },
+	{ 0x20d0u, 0x20f0u, orp_block49 },
+	{ 0x2100u, 0x214fu, orp_block50 },
+	{ 0x2153u, 0x2188u, orp_block51 },
+	{ 0x2190u, 0x2328u, orp_block52 },
+	{ 0x232bu, 0x23e7u, orp_block53 },
+	{ 0x2400u, 0x2426u, orp_block54 },
+	{ 0x2440u, 0x244au, orp_block55 },
+	{ 0x2460u, 0x2613u, orp_block56 },
+	{ 0x2616u, 0x2617u, orp_block57 },
+	{ 0x2619u, 0x269cu, orp_block58 },
+	{ 0x26a0u, 0x26bcu, orp_block59 },
+	{ 0x26c0u, 0x26c3u, orp_block60 },
+	{ 0x2701u, 0x2704u, orp_block61 },
+	{ 0x2706u, 0x2709u, orp_block62 },
+	{ 0x270cu, 0x2727u, orp_block63 },
+	{ 0x2729u, 0x274bu, orp_block64 },
+	{ 0x274du, 0x274du, orp_block65 },
+	{ 0x274fu, 0x2752u, orp_block66 },
+	{ 0x2756u, 0x2756u, orp_block67 },
+	{ 0x2758u, 0x275eu, orp_block68 },
+	{ 0x2761u, 0x2794u, orp_block69 },
+	{ 0x2798u, 0x27afu, orp_block70 },
+	{ 0x27b1u, 0x27beu, orp_block71 },
+	{ 0x27c0u, 0x27cau, orp_block72 },
+	{ 0x27ccu, 0x27ccu, orp_block73 },
+	{ 0x27d0u, 0x2b4cu, orp_block74 },
+	{ 0x2b60u, 0x2b64u, orp_block75 },
+	{ 0x2b80u, 0x2b83u, orp_block76 },
+	{ 0x2c60u, 0x2c6fu, orp_block77 },
+	{ 0x2c71u, 0x2c7du, orp_block78 },
+	{ 0x2de0u, 0x2dffu, orp_block79 },
+	{ 0xe0b2u, 0xe0b2u, orp_block80 },
+	{ 0xfb00u, 0xfb06u, orp_block81 },
+	{ 0xfe20u, 0xfe23u, orp_block82 },
+	{ 0xfffdu, 0xfffdu, orp_block83 },
+};
@@ -4777,3 +4777,85 @@ static const unsigned char orpb_block80[][12] = {
 	{ 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1b, 0x1f, 0x1b, 0x0e, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange orpb_ranges[] = {
+	{ 0x00u, 0x00u, orpb_block1 },
+	{ 0x20u, 0x7eu, orpb_block2 },
+	{ 0xa0u, 0x377u, orpb_block3 },
+	{ 0x37au, 0x37eu, orpb_block4 },
+	{ 0x384u, 0x38au, orpb_block5 },
+	{ 0x38cu, 0x38cu, orpb_block6 },
+	{ 0x38eu, 0x3a1u, orpb_block7 },
+	{ 0x3a3u, 0x523u, orpb_block8 },
+	{ 0x531u, 0x556u, orpb_block9 },
+	{ 0x559u, 0x55fu, orpb_block10 },
+	{ 0x561u, 0x587u, orpb_block11 },
+	{ 0x589u, 0x58au, orpb_block12 },
+	{ 0x591u, 0x5c7u, orpb_block13 },
+	{ 0x5d0u, 0x5eau, orpb_block14 },
+	{ 0x5f0u, 0x5f4u, orpb_block15 },
+	{ 0x1680u, 0x169cu, orpb_block16 },
+	{ 0x16a0u, 0x16f0u, orpb_block17 },
+	{ 0x1e02u, 0x1e07u, orpb_block18 },
+	{ 0x1e0au, 0x1e13u, orpb_block19 },
+	{ 0x1e1eu, 0x1e1fu, orpb_block20 },
+	{ 0x1e30u, 0x1e35u, orpb_block21 },
+	{ 0x1e3eu, 0x1e43u, orpb_block22 },
+	{ 0x1e54u, 0x1e57u, orpb_block23 },
+	{ 0x1e60u, 0x1e71u, orpb_block24 },
+	{ 0x1e80u, 0x1e8fu, orpb_block25 },
+	{ 0x1ef2u, 0x1ef9u, orpb_block26 },
+	{ 0x1f00u, 0x1f15u, orpb_block27 },
+	{ 0x1f18u, 0x1f1du, orpb_block28 },
+	{ 0x1f20u, 0x1f45u, orpb_block29 },
+	{ 0x1f48u, 0x1f4du, orpb_block30 },
+	{ 0x1f50u, 0x1f57u, orpb_block31 },
+	{ 0x1f59u, 0x1f59u, orpb_block32 },
+	{ 0x1f5bu, 0x1f5bu, orpb_block33 },
+	{ 0x1f5du, 0x1f5du, orpb_block34 },
+	{ 0x1f5fu, 0x1f7du, orpb_block35 },
+	{ 0x1f80u, 0x1fb4u, orpb_block36 },
+	{ 0x1fb6u, 0x1fc4u, orpb_block37 },
+	{ 0x1fc6u, 0x1fd3u, orpb_block38 },
+	{ 0x1fd6u, 0x1fdbu, orpb_block39 },
+	{ 0x1fddu, 0x1fefu, orpb_block40 },
+	{ 0x1ff2u, 0x1ff4u, orpb_block41 },
+	{ 0x1ff6u, 0x1ffeu, orpb_block42 },
+	{ 0x2010u, 0x2027u, orpb_block43 },
+	{ 0x2030u, 0x205eu, orpb_block44 },
+	{ 0x2070u, 0x2071u, orpb_block45 },
+	{ 0x2074u, 0x208eu, orpb_block46 },
+	{ 0x2090u, 0x2094u, orpb_block47 },
+	{ 0x20a0u, 0x20b5u, orpb_block48 },
+	{ 0x20d0u, 0x20f0u, orpb_block49 },
+	{ 0x2100u, 0x214fu, orpb_block50 },
+	{ 0x2153u, 0x2188u, orpb_block51 },
+	{ 0x2190u, 0x2328u, orpb_block52 },
+	{ 0x232bu, 0x23e7u, orpb_block53 },
+	{ 0x2400u, 0x2426u, orpb_block54 },
+	{ 0x2440u, 0x244au, orpb_block55 },
+	{ 0x2460u, 0x2613u, orpb_block56 },
+	{ 0x2616u, 0x2617u, orpb_block57 },
+	{ 0x2619u, 0x269cu, orpb_block58 },
+	{ 0x26a0u, 0x26bcu, orpb_block59 },
+	{ 0x26c0u, 0x26c3u, orpb_block60 },
+	{ 0x2701u, 0x2704u, orpb_block61 },
+	{ 0x2706u, 0x2709u, orpb_block62 },
+	{ 0x270cu, 0x2727u, orpb_block63 },
+	{ 0x2729u, 0x274bu, orpb_block64 },
+	{ 0x274du, 0x274du, orpb_block65 },
+	{ 0x274fu, 0x2752u, orpb_block66 },
+	{ 0x2756u, 0x2756u, orpb_block67 },
+	{ 0x2758u, 0x275eu, orpb_block68 },
+	{ 0x2761u, 0x2794u, orpb_block69 },
+	{ 0x2798u, 0x27afu, orpb_block70 },
+	{ 0x27b1u, 0x27beu, orpb_block71 },
+	{ 0x27c0u, 0x27cau, orpb_block72 },
+	{ 0x27ccu, 0x27ccu, orpb_block73 },
+	{ 0x27d0u, 0x2b4cu, orpb_block74 },
+	{ 0x2c60u, 0x2c6fu, orpb_block75 },
+	{ 0x2c71u, 0x2c7du, orpb_block76 },
+	{ 0x2de0u, 0x2dffu, orpb_block77 },
+	{ 0xfb00u, 0xfb06u, orpb_block78 },
+	{ 0xfe20u, 0xfe23u, orpb_block79 },
+	{ 0xfffdu, 0xfffdu, orpb_block80 },
+};
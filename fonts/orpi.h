@@ -4777,3 +4777,85 @@ static const unsigned char orpi_block80[][12] = {
 	{ 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1b, 0x1f, 0x1b, 0x0e, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange orpi_ranges[] = {
+	{ 0x00u, 0x00u, orpi_block1 },
+	{ 0x20u, 0x7eu, orpi_block2 },
+	{ 0xa0u, 0x377u, orpi_block3 },
+	{ 0x37au, 0x37eu, orpi_block4 },
+	{ 0x384u, 0x38au, orpi_block5 },
+	{ 0x38cu, 0x38cu, orpi_block6 },
+	{ 0x38eu, 0x3a1u, orpi_block7 },
+	{ 0x3a3u, 0x523u, orpi_block8 },
+	{ 0x531u, 0x556u, orpi_block9 },
+	{ 0x559u, 0x55fu, orpi_block10 },
+	{ 0x561u, 0x587u, orpi_block11 },
+	{ 0x589u, 0x58au, orpi_block12 },
+	{ 0x591u, 0x5c7u, orpi_block13 },
+	{ 0x5d0u, 0x5eau, orpi_block14 },
+	{ 0x5f0u, 0x5f4u, orpi_block15 },
+	{ 0x1680u, 0x169cu, orpi_block16 },
+	{ 0x16a0u, 0x16f0u, orpi_block17 },
+	{ 0x1e02u, 0x1e07u, orpi_block18 },
+	{ 0x1e0au, 0x1e13u, orpi_block19 },
+	{ 0x1e1eu, 0x1e1fu, orpi_block20 },
+	{ 0x1e30u, 0x1e35u, orpi_block21 },
+	{ 0x1e3eu, 0x1e43u, orpi_block22 },
+	{ 0x1e54u, 0x1e57u, orpi_block23 },
+	{ 0x1e60u, 0x1e71u, orpi_block24 },
+	{ 0x1e80u, 0x1e8fu, orpi_block25 },
+	{ 0x1ef2u, 0x1ef9u, orpi_block26 },
+	{ 0x1f00u, 0x1f15u, orpi_block27 },
+	{ 0x1f18u, 0x1f1du, orpi_block28 },
+	{ 0x1f20u, 0x1f45u, orpi_block29 },
+	{ 0x1f48u, 0x1f4du, orpi_block30 },
+	{ 0x1f50u, 0x1f57u, orpi_block31 },
+	{ 0x1f59u, 0x1f59u, orpi_block32 },
+	{ 0x1f5bu, 0x1f5bu, orpi_block33 },
+	{ 0x1f5du, 0x1f5du, orpi_block34 },
+	{ 0x1f5fu, 0x1f7du, orpi_block35 },
+	{ 0x1f80u, 0x1fb4u, orpi_block36 },
+	{ 0x1fb6u, 0x1fc4u, orpi_block37 },
+	{ 0x1fc6u, 0x1fd3u, orpi_block38 },
+	{ 0x1fd6u, 0x1fdbu, orpi_block39 },
+	{ 0x1fddu, 0x1fefu, orpi_block40 },
+	{ 0x1ff2u, 0x1ff4u, orpi_block41 },
+	{ 0x1ff6u, 0x1ffeu, orpi_block42 },
+	{ 0x2010u, 0x2027u, orpi_block43 },
+	{ 0x2030u, 0x205eu, orpi_block44 },
+	{ 0x2070u, 0x2071u, orpi_block45 },
+	{ 0x2074u, 0x208eu, orpi_block46 },
+	{ 0x2090u, 0x2094u, orpi_block47 },
+	{ 0x20a0u, 0x20b5u, orpi_block48 },
+	{ 0x20d0u, 0x20f0u, orpi_block49 },
+	{ 0x2100u, 0x214fu, orpi_block50 },
+	{ 0x2153u, 0x2188u, orpi_block51 },
+	{ 0x2190u, 0x2328u, orpi_block52 },
+	{ 0x232bu, 0x23e7u, orpi_block53 },
+	{ 0x2400u, 0x2426u, orpi_block54 },
+	{ 0x2440u, 0x244au, orpi_block55 },
+	{ 0x2460u, 0x2613u, orpi_block56 },
+	{ 0x2616u, 0x2617u, orpi_block57 },
+	{ 0x2619u, 0x269cu, orpi_block58 },
+	{ 0x26a0u, 0x26bcu, orpi_block59 },
+	{ 0x26c0u, 0x26c3u, orpi_block60 },
+	{ 0x2701u, 0x2704u, orpi_block61 },
+	{ 0x2706u, 0x2709u, orpi_block62 },
+	{ 0x270cu, 0x2727u, orpi_block63 },
+	{ 0x2729u, 0x274bu, orpi_block64 },
+	{ 0x274du, 0x274du, orpi_block65 },
+	{ 0x274fu, 0x2752u, orpi_block66 },
+	{ 0x2756u, 0x2756u, orpi_block67 },
+	{ 0x2758u, 0x275eu, orpi_block68 },
+	{ 0x2761u, 0x2794u, orpi_block69 },
+	{ 0x2798u, 0x27afu, orpi_block70 },
+	{ 0x27b1u, 0x27beu, orpi_block71 },
+	{ 0x27c0u, 0x27cau, orpi_block72 },
+	{ 0x27ccu, 0x27ccu, orpi_block73 },
+	{ 0x27d0u, 0x2b4cu, orpi_block74 },
+	{ 0x2c60u, 0x2c6fu, orpi_block75 },
+	{ 0x2c71u, 0x2c7du, orpi_block76 },
+	{ 0x2de0u, 0x2dffu, orpi_block77 },
+	{ 0xfb00u, 0xfb06u, orpi_block78 },
+	{ 0xfe20u, 0xfe23u, orpi_block79 },
+	{ 0xfffdu, 0xfffdu, orpi_block80 },
+};
@@ -1433,3 +1433,120 @@ static const unsigned char scientifica_block115[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00 },	// U+F0F0 ()
 }; // 4
 
+static const FBInkGlyphRange scientifica_ranges[] = {
+	{ 0x20u, 0x7eu, scientifica_block1 },
+	{ 0xa0u, 0x1b6u, scientifica_block2 },
+	{ 0x1c7u, 0x1d4u, scientifica_block3 },
+	{ 0x20cu, 0x21bu, scientifica_block4 },
+	{ 0x296u, 0x296u, scientifica_block5 },
+	{ 0x298u, 0x298u, scientifica_block6 },
+	{ 0x2c7u, 0x2c7u, scientifica_block7 },
+	{ 0x2dau, 0x2dau, scientifica_block8 },
+	{ 0x364u, 0x364u, scientifica_block9 },
+	{ 0x391u, 0x3a9u, scientifica_block10 },
+	{ 0x3b1u, 0x3c9u, scientifica_block11 },
+	{ 0xf3cu, 0xf3du, scientifica_block12 },
+	{ 0x1e9eu, 0x1e9eu, scientifica_block13 },
+	{ 0x2010u, 0x2027u, scientifica_block14 },
+	{ 0x2032u, 0x203cu, scientifica_block15 },
+	{ 0x203eu, 0x2042u, scientifica_block16 },
+	{ 0x204fu, 0x2051u, scientifica_block17 },
+	{ 0x205cu, 0x205cu, scientifica_block18 },
+	{ 0x20a8u, 0x20a8u, scientifica_block19 },
+	{ 0x20aau, 0x20aau, scientifica_block20 },
+	{ 0x20acu, 0x20acu, scientifica_block21 },
+	{ 0x2122u, 0x2122u, scientifica_block22 },
+	{ 0x2190u, 0x2199u, scientifica_block23 },
+	{ 0x21a4u, 0x21a7u, scientifica_block24 },
+	{ 0x21a9u, 0x21aau, scientifica_block25 },
+	{ 0x21b0u, 0x21b7u, scientifica_block26 },
+	{ 0x21b9u, 0x21c4u, scientifica_block27 },
+	{ 0x21c6u, 0x21cbu, scientifica_block28 },
+	{ 0x21d0u, 0x21d3u, scientifica_block29 },
+	{ 0x2200u, 0x2214u, scientifica_block30 },
+	{ 0x2217u, 0x221au, scientifica_block31 },
+	{ 0x221du, 0x221eu, scientifica_block32 },
+	{ 0x2227u, 0x222bu, scientifica_block33 },
+	{ 0x2234u, 0x2237u, scientifica_block34 },
+	{ 0x2243u, 0x2243u, scientifica_block35 },
+	{ 0x2248u, 0x2248u, scientifica_block36 },
+	{ 0x2254u, 0x2255u, scientifica_block37 },
+	{ 0x2260u, 0x2262u, scientifica_block38 },
+	{ 0x2264u, 0x2265u, scientifica_block39 },
+	{ 0x2282u, 0x2287u, scientifica_block40 },
+	{ 0x2295u, 0x2296u, scientifica_block41 },
+	{ 0x2299u, 0x2299u, scientifica_block42 },
+	{ 0x229eu, 0x22a9u, scientifica_block43 },
+	{ 0x22abu, 0x22abu, scientifica_block44 },
+	{ 0x22c4u, 0x22c6u, scientifica_block45 },
+	{ 0x2325u, 0x2325u, scientifica_block46 },
+	{ 0x239bu, 0x23aeu, scientifica_block47 },
+	{ 0x23bau, 0x23bdu, scientifica_block48 },
+	{ 0x23e9u, 0x23ecu, scientifica_block49 },
+	{ 0x23f4u, 0x23fbu, scientifica_block50 },
+	{ 0x2500u, 0x2503u, scientifica_block51 },
+	{ 0x2506u, 0x2507u, scientifica_block52 },
+	{ 0x250au, 0x251du, scientifica_block53 },
+	{ 0x2520u, 0x2520u, scientifica_block54 },
+	{ 0x2523u, 0x2525u, scientifica_block55 },
+	{ 0x2528u, 0x2528u, scientifica_block56 },
+	{ 0x252bu, 0x252cu, scientifica_block57 },
+	{ 0x252fu, 0x2530u, scientifica_block58 },
+	{ 0x2533u, 0x2534u, scientifica_block59 },
+	{ 0x2537u, 0x2538u, scientifica_block60 },
+	{ 0x253bu, 0x253cu, scientifica_block61 },
+	{ 0x253fu, 0x253fu, scientifica_block62 },
+	{ 0x2542u, 0x2542u, scientifica_block63 },
+	{ 0x254bu, 0x254bu, scientifica_block64 },
+	{ 0x2550u, 0x2573u, scientifica_block65 },
+	{ 0x257cu, 0x257cu, scientifica_block66 },
+	{ 0x257eu, 0x257eu, scientifica_block67 },
+	{ 0x2581u, 0x258au, scientifica_block68 },
+	{ 0x258fu, 0x258fu, scientifica_block69 },
+	{ 0x2591u, 0x2593u, scientifica_block70 },
+	{ 0x25a1u, 0x25a2u, scientifica_block71 },
+	{ 0x25aau, 0x25abu, scientifica_block72 },
+	{ 0x25b2u, 0x25b9u, scientifica_block73 },
+	{ 0x25bcu, 0x25beu, scientifica_block74 },
+	{ 0x25c0u, 0x25c4u, scientifica_block75 },
+	{ 0x25cbu, 0x25cbu, scientifica_block76 },
+	{ 0x25ceu, 0x25d7u, scientifica_block77 },
+	{ 0x25e7u, 0x25ebu, scientifica_block78 },
+	{ 0x25f0u, 0x25f3u, scientifica_block79 },
+	{ 0x2600u, 0x2602u, scientifica_block80 },
+	{ 0x2630u, 0x2637u, scientifica_block81 },
+	{ 0x2661u, 0x2661u, scientifica_block82 },
+	{ 0x2665u, 0x2666u, scientifica_block83 },
+	{ 0x2669u, 0x266cu, scientifica_block84 },
+	{ 0x267au, 0x267au, scientifica_block85 },
+	{ 0x26aau, 0x26abu, scientifica_block86 },
+	{ 0x2713u, 0x2718u, scientifica_block87 },
+	{ 0x272eu, 0x272eu, scientifica_block88 },
+	{ 0x2744u, 0x2744u, scientifica_block89 },
+	{ 0x276eu, 0x2771u, scientifica_block90 },
+	{ 0x27c2u, 0x27c4u, scientifica_block91 },
+	{ 0x27d8u, 0x27d9u, scientifica_block92 },
+	{ 0x27dcu, 0x27deu, scientifica_block93 },
+	{ 0x2864u, 0x28ffu, scientifica_block94 },
+	{ 0x2919u, 0x291cu, scientifica_block95 },
+	{ 0x2b5eu, 0x2b62u, scientifica_block96 },
+	{ 0x2b64u, 0x2b64u, scientifica_block97 },
+	{ 0x2b80u, 0x2b83u, scientifica_block98 },
+	{ 0x30c3u, 0x30c4u, scientifica_block99 },
+	{ 0x5350u, 0x5350u, scientifica_block100 },
+	{ 0xe09eu, 0xe0a2u, scientifica_block101 },
+	{ 0xe0b0u, 0xe0c6u, scientifica_block102 },
+	{ 0xe0d1u, 0xe0d2u, scientifica_block103 },
+	{ 0xe0d4u, 0xe0d4u, scientifica_block104 },
+	{ 0xf031u, 0xf031u, scientifica_block105 },
+	{ 0xf033u, 0xf03du, scientifica_block106 },
+	{ 0xf057u, 0xf059u, scientifica_block107 },
+	{ 0xf061u, 0xf061u, scientifica_block108 },
+	{ 0xf073u, 0xf073u, scientifica_block109 },
+	{ 0xf078u, 0xf079u, scientifica_block110 },
+	{ 0xf07eu, 0xf07eu, scientifica_block111 },
+	{ 0xf0cfu, 0xf0d1u, scientifica_block112 },
+	{ 0xf0d5u, 0xf0dcu, scientifica_block113 },
+	{ 0xf0deu, 0xf0e0u, scientifica_block114 },
+	{ 0xf0edu, 0xf0f0u, scientifica_block115 },
+};
@@ -1311,3 +1311,113 @@ static const unsigned char scientificab_block108[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00 },	// U+F0F0 ()
 }; // 4
 
+static const FBInkGlyphRange scientificab_ranges[] = {
+	{ 0x20u, 0x7eu, scientificab_block1 },
+	{ 0xa0u, 0x1b6u, scientificab_block2 },
+	{ 0x1c7u, 0x1d4u, scientificab_block3 },
+	{ 0x20cu, 0x211u, scientificab_block4 },
+	{ 0x213u, 0x21bu, scientificab_block5 },
+	{ 0x296u, 0x296u, scientificab_block6 },
+	{ 0x2c7u, 0x2c7u, scientificab_block7 },
+	{ 0x2dau, 0x2dau, scientificab_block8 },
+	{ 0x364u, 0x364u, scientificab_block9 },
+	{ 0x391u, 0x3a9u, scientificab_block10 },
+	{ 0x3b1u, 0x3c9u, scientificab_block11 },
+	{ 0xf3cu, 0xf3du, scientificab_block12 },
+	{ 0x1e9eu, 0x1e9eu, scientificab_block13 },
+	{ 0x2010u, 0x2027u, scientificab_block14 },
+	{ 0x2032u, 0x203au, scientificab_block15 },
+	{ 0x203cu, 0x203cu, scientificab_block16 },
+	{ 0x203eu, 0x2042u, scientificab_block17 },
+	{ 0x204fu, 0x2051u, scientificab_block18 },
+	{ 0x20acu, 0x20acu, scientificab_block19 },
+	{ 0x2122u, 0x2122u, scientificab_block20 },
+	{ 0x2190u, 0x2199u, scientificab_block21 },
+	{ 0x21a4u, 0x21a7u, scientificab_block22 },
+	{ 0x21a9u, 0x21aau, scientificab_block23 },
+	{ 0x21b1u, 0x21b4u, scientificab_block24 },
+	{ 0x21b9u, 0x21c4u, scientificab_block25 },
+	{ 0x21c6u, 0x21c7u, scientificab_block26 },
+	{ 0x21c9u, 0x21c9u, scientificab_block27 },
+	{ 0x21d0u, 0x21d3u, scientificab_block28 },
+	{ 0x2200u, 0x2214u, scientificab_block29 },
+	{ 0x2218u, 0x221au, scientificab_block30 },
+	{ 0x221du, 0x221eu, scientificab_block31 },
+	{ 0x2229u, 0x222bu, scientificab_block32 },
+	{ 0x2234u, 0x2237u, scientificab_block33 },
+	{ 0x2248u, 0x2248u, scientificab_block34 },
+	{ 0x2260u, 0x2261u, scientificab_block35 },
+	{ 0x2264u, 0x2265u, scientificab_block36 },
+	{ 0x227au, 0x227au, scientificab_block37 },
+	{ 0x2282u, 0x2287u, scientificab_block38 },
+	{ 0x2295u, 0x2296u, scientificab_block39 },
+	{ 0x2299u, 0x2299u, scientificab_block40 },
+	{ 0x229eu, 0x22a9u, scientificab_block41 },
+	{ 0x22abu, 0x22abu, scientificab_block42 },
+	{ 0x22c4u, 0x22c6u, scientificab_block43 },
+	{ 0x23bau, 0x23bdu, scientificab_block44 },
+	{ 0x23e9u, 0x23ecu, scientificab_block45 },
+	{ 0x23f4u, 0x23fbu, scientificab_block46 },
+	{ 0x2500u, 0x2503u, scientificab_block47 },
+	{ 0x250au, 0x251du, scientificab_block48 },
+	{ 0x2520u, 0x2520u, scientificab_block49 },
+	{ 0x2523u, 0x2525u, scientificab_block50 },
+	{ 0x2528u, 0x2528u, scientificab_block51 },
+	{ 0x252bu, 0x252cu, scientificab_block52 },
+	{ 0x252fu, 0x2530u, scientificab_block53 },
+	{ 0x2533u, 0x2534u, scientificab_block54 },
+	{ 0x2537u, 0x2538u, scientificab_block55 },
+	{ 0x253bu, 0x253cu, scientificab_block56 },
+	{ 0x253fu, 0x253fu, scientificab_block57 },
+	{ 0x2542u, 0x2542u, scientificab_block58 },
+	{ 0x254bu, 0x254bu, scientificab_block59 },
+	{ 0x2550u, 0x2570u, scientificab_block60 },
+	{ 0x257cu, 0x257cu, scientificab_block61 },
+	{ 0x257eu, 0x257eu, scientificab_block62 },
+	{ 0x2581u, 0x258au, scientificab_block63 },
+	{ 0x258fu, 0x258fu, scientificab_block64 },
+	{ 0x2591u, 0x2593u, scientificab_block65 },
+	{ 0x25a1u, 0x25a2u, scientificab_block66 },
+	{ 0x25aau, 0x25aau, scientificab_block67 },
+	{ 0x25b2u, 0x25b4u, scientificab_block68 },
+	{ 0x25b6u, 0x25b9u, scientificab_block69 },
+	{ 0x25bcu, 0x25beu, scientificab_block70 },
+	{ 0x25c0u, 0x25c4u, scientificab_block71 },
+	{ 0x25d2u, 0x25d3u, scientificab_block72 },
+	{ 0x25d5u, 0x25d7u, scientificab_block73 },
+	{ 0x25e7u, 0x25eau, scientificab_block74 },
+	{ 0x2600u, 0x2602u, scientificab_block75 },
+	{ 0x2630u, 0x2637u, scientificab_block76 },
+	{ 0x2661u, 0x2661u, scientificab_block77 },
+	{ 0x2665u, 0x2665u, scientificab_block78 },
+	{ 0x2669u, 0x266cu, scientificab_block79 },
+	{ 0x2713u, 0x2718u, scientificab_block80 },
+	{ 0x272eu, 0x272eu, scientificab_block81 },
+	{ 0x2744u, 0x2744u, scientificab_block82 },
+	{ 0x276eu, 0x2771u, scientificab_block83 },
+	{ 0x27c2u, 0x27c4u, scientificab_block84 },
+	{ 0x27d8u, 0x27d9u, scientificab_block85 },
+	{ 0x27dcu, 0x27deu, scientificab_block86 },
+	{ 0x287du, 0x28ffu, scientificab_block87 },
+	{ 0x2919u, 0x291cu, scientificab_block88 },
+	{ 0x2b5eu, 0x2b62u, scientificab_block89 },
+	{ 0x2b64u, 0x2b64u, scientificab_block90 },
+	{ 0x2b80u, 0x2b83u, scientificab_block91 },
+	{ 0x30c3u, 0x30c4u, scientificab_block92 },
+	{ 0x5350u, 0x5350u, scientificab_block93 },
+	{ 0xe09eu, 0xe0a2u, scientificab_block94 },
+	{ 0xe0b0u, 0xe0b3u, scientificab_block95 },
+	{ 0xe0c0u, 0xe0c6u, scientificab_block96 },
+	{ 0xe0d1u, 0xe0d1u, scientificab_block97 },
+	{ 0xf031u, 0xf031u, scientificab_block98 },
+	{ 0xf033u, 0xf03du, scientificab_block99 },
+	{ 0xf057u, 0xf059u, scientificab_block100 },
+	{ 0xf061u, 0xf061u, scientificab_block101 },
+	{ 0xf073u, 0xf073u, scientificab_block102 },
+	{ 0xf078u, 0xf079u, scientificab_block103 },
+	{ 0xf07eu, 0xf07eu, scientificab_block104 },
+	{ 0xf0cfu, 0xf0d1u, scientificab_block105 },
+	{ 0xf0d5u, 0xf0dcu, scientificab_block106 },
+	{ 0xf0deu, 0xf0e0u, scientificab_block107 },
+	{ 0xf0edu, 0xf0f0u, scientificab_block108 },
+};
@@ -1421,3 +1421,120 @@ static const unsigned char scientificai_block115[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x18, 0x00, 0x04, 0x08, 0x00 },	// U+F0F0 ()
 }; // 4
 
+static const FBInkGlyphRange scientificai_ranges[] = {
+	{ 0x20u, 0x7eu, scientificai_block1 },
+	{ 0xa0u, 0x1b6u, scientificai_block2 },
+	{ 0x1c7u, 0x1d4u, scientificai_block3 },
+	{ 0x20cu, 0x21bu, scientificai_block4 },
+	{ 0x296u, 0x296u, scientificai_block5 },
+	{ 0x298u, 0x298u, scientificai_block6 },
+	{ 0x2c7u, 0x2c7u, scientificai_block7 },
+	{ 0x2dau, 0x2dau, scientificai_block8 },
+	{ 0x364u, 0x364u, scientificai_block9 },
+	{ 0x391u, 0x3a9u, scientificai_block10 },
+	{ 0x3b1u, 0x3c9u, scientificai_block11 },
+	{ 0xf3cu, 0xf3du, scientificai_block12 },
+	{ 0x1e9eu, 0x1e9eu, scientificai_block13 },
+	{ 0x2010u, 0x2027u, scientificai_block14 },
+	{ 0x2032u, 0x203cu, scientificai_block15 },
+	{ 0x203eu, 0x2042u, scientificai_block16 },
+	{ 0x204fu, 0x2051u, scientificai_block17 },
+	{ 0x205cu, 0x205cu, scientificai_block18 },
+	{ 0x20a8u, 0x20a8u, scientificai_block19 },
+	{ 0x20aau, 0x20aau, scientificai_block20 },
+	{ 0x20acu, 0x20acu, scientificai_block21 },
+	{ 0x2122u, 0x2122u, scientificai_block22 },
+	{ 0x2190u, 0x2199u, scientificai_block23 },
+	{ 0x21a4u, 0x21a7u, scientificai_block24 },
+	{ 0x21a9u, 0x21aau, scientificai_block25 },
+	{ 0x21b0u, 0x21b7u, scientificai_block26 },
+	{ 0x21b9u, 0x21c4u, scientificai_block27 },
+	{ 0x21c6u, 0x21cbu, scientificai_block28 },
+	{ 0x21d0u, 0x21d3u, scientificai_block29 },
+	{ 0x2200u, 0x2214u, scientificai_block30 },
+	{ 0x2217u, 0x221au, scientificai_block31 },
+	{ 0x221du, 0x221eu, scientificai_block32 },
+	{ 0x2227u, 0x222bu, scientificai_block33 },
+	{ 0x2234u, 0x2237u, scientificai_block34 },
+	{ 0x2243u, 0x2243u, scientificai_block35 },
+	{ 0x2248u, 0x2248u, scientificai_block36 },
+	{ 0x2254u, 0x2255u, scientificai_block37 },
+	{ 0x2260u, 0x2262u, scientificai_block38 },
+	{ 0x2264u, 0x2265u, scientificai_block39 },
+	{ 0x2282u, 0x2287u, scientificai_block40 },
+	{ 0x2295u, 0x2296u, scientificai_block41 },
+	{ 0x2299u, 0x2299u, scientificai_block42 },
+	{ 0x229eu, 0x22a9u, scientificai_block43 },
+	{ 0x22abu, 0x22abu, scientificai_block44 },
+	{ 0x22c4u, 0x22c6u, scientificai_block45 },
+	{ 0x2325u, 0x2325u, scientificai_block46 },
+	{ 0x239bu, 0x23aeu, scientificai_block47 },
+	{ 0x23bau, 0x23bdu, scientificai_block48 },
+	{ 0x23e9u, 0x23ecu, scientificai_block49 },
+	{ 0x23f4u, 0x23fbu, scientificai_block50 },
+	{ 0x2500u, 0x2503u, scientificai_block51 },
+	{ 0x2506u, 0x2507u, scientificai_block52 },
+	{ 0x250au, 0x251du, scientificai_block53 },
+	{ 0x2520u, 0x2520u, scientificai_block54 },
+	{ 0x2523u, 0x2525u, scientificai_block55 },
+	{ 0x2528u, 0x2528u, scientificai_block56 },
+	{ 0x252bu, 0x252cu, scientificai_block57 },
+	{ 0x252fu, 0x2530u, scientificai_block58 },
+	{ 0x2533u, 0x2534u, scientificai_block59 },
+	{ 0x2537u, 0x2538u, scientificai_block60 },
+	{ 0x253bu, 0x253cu, scientificai_block61 },
+	{ 0x253fu, 0x253fu, scientificai_block62 },
+	{ 0x2542u, 0x2542u, scientificai_block63 },
+	{ 0x254bu, 0x254bu, scientificai_block64 },
+	{ 0x2550u, 0x2573u, scientificai_block65 },
+	{ 0x257cu, 0x257cu, scientificai_block66 },
+	{ 0x257eu, 0x257eu, scientificai_block67 },
+	{ 0x2581u, 0x258au, scientificai_block68 },
+	{ 0x258fu, 0x258fu, scientificai_block69 },
+	{ 0x2591u, 0x2593u, scientificai_block70 },
+	{ 0x25a1u, 0x25a2u, scientificai_block71 },
+	{ 0x25aau, 0x25abu, scientificai_block72 },
+	{ 0x25b2u, 0x25b9u, scientificai_block73 },
+	{ 0x25bcu, 0x25beu, scientificai_block74 },
+	{ 0x25c0u, 0x25c4u, scientificai_block75 },
+	{ 0x25cbu, 0x25cbu, scientificai_block76 },
+	{ 0x25ceu, 0x25d7u, scientificai_block77 },
+	{ 0x25e7u, 0x25ebu, scientificai_block78 },
+	{ 0x25f0u, 0x25f3u, scientificai_block79 },
+	{ 0x2600u, 0x2602u, scientificai_block80 },
+	{ 0x2630u, 0x2637u, scientificai_block81 },
+	{ 0x2661u, 0x2661u, scientificai_block82 },
+	{ 0x2665u, 0x2666u, scientificai_block83 },
+	{ 0x2669u, 0x266cu, scientificai_block84 },
+	{ 0x267au, 0x267au, scientificai_block85 },
+	{ 0x26aau, 0x26abu, scientificai_block86 },
+	{ 0x2713u, 0x2718u, scientificai_block87 },
+	{ 0x272eu, 0x272eu, scientificai_block88 },
+	{ 0x2744u, 0x2744u, scientificai_block89 },
+	{ 0x276eu, 0x2771u, scientificai_block90 },
+	{ 0x27c2u, 0x27c4u, scientificai_block91 },
+	{ 0x27d8u, 0x27d9u, scientificai_block92 },
+	{ 0x27dcu, 0x27deu, scientificai_block93 },
+	{ 0x2864u, 0x28ffu, scientificai_block94 },
+	{ 0x2919u, 0x291cu, scientificai_block95 },
+	{ 0x2b5eu, 0x2b62u, scientificai_block96 },
+	{ 0x2b64u, 0x2b64u, scientificai_block97 },
+	{ 0x2b80u, 0x2b83u, scientificai_block98 },
+	{ 0x30c3u, 0x30c4u, scientificai_block99 },
+	{ 0x5350u, 0x5350u, scientificai_block100 },
+	{ 0xe09eu, 0xe0a2u, scientificai_block101 },
+	{ 0xe0b0u, 0xe0b5u, scientificai_block102 },
+	{ 0xe0c0u, 0xe0c6u, scientificai_block103 },
+	{ 0xe0d1u, 0xe0d1u, scientificai_block104 },
+	{ 0xf031u, 0xf031u, scientificai_block105 },
+	{ 0xf033u, 0xf03du, scientificai_block106 },
+	{ 0xf057u, 0xf059u, scientificai_block107 },
+	{ 0xf061u, 0xf061u, scientificai_block108 },
+	{ 0xf073u, 0xf073u, scientificai_block109 },
+	{ 0xf078u, 0xf079u, scientificai_block110 },
+	{ 0xf07eu, 0xf07eu, scientificai_block111 },
+	{ 0xf0cfu, 0xf0d1u, scientificai_block112 },
+	{ 0xf0d5u, 0xf0dcu, scientificai_block113 },
+	{ 0xf0deu, 0xf0e0u, scientificai_block114 },
+	{ 0xf0edu, 0xf0f0u, scientificai_block115 },
+};
@@ -1103,3 +1103,73 @@ static const uint16_t spleen_block68[][32] = {
 	{ 0x8000, 0xc000, 0x6000, 0x3000, 0x1800, 0x0c00, 0x0600, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0003, 0x0003, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060, 0x00c0, 0x0180, 0x0300, 0x0600, 0x0c00, 0x1800, 0x3000, 0x6000, 0xc000, 0x8000 },	// U+E0B3 ()
 }; // 4
 
+static const FBInkGlyphRange spleen_ranges[] = {
+	{ 0x20u, 0x7fu, spleen_block1 },
+	{ 0xa0u, 0x17fu, spleen_block2 },
+	{ 0x192u, 0x192u, spleen_block3 },
+	{ 0x1cdu, 0x1d4u, spleen_block4 },
+	{ 0x1e2u, 0x1e3u, spleen_block5 },
+	{ 0x1e6u, 0x1edu, spleen_block6 },
+	{ 0x1f0u, 0x1f0u, spleen_block7 },
+	{ 0x1f4u, 0x1f5u, spleen_block8 },
+	{ 0x1fcu, 0x217u, spleen_block9 },
+	{ 0x21eu, 0x21fu, spleen_block10 },
+	{ 0x226u, 0x229u, spleen_block11 },
+	{ 0x22eu, 0x22fu, spleen_block12 },
+	{ 0x2d8u, 0x2d9u, spleen_block13 },
+	{ 0x2dbu, 0x2ddu, spleen_block14 },
+	{ 0x393u, 0x393u, spleen_block15 },
+	{ 0x398u, 0x398u, spleen_block16 },
+	{ 0x3a3u, 0x3a3u, spleen_block17 },
+	{ 0x3a6u, 0x3a6u, spleen_block18 },
+	{ 0x3a9u, 0x3a9u, spleen_block19 },
+	{ 0x3b1u, 0x3b1u, spleen_block20 },
+	{ 0x3b4u, 0x3b5u, spleen_block21 },
+	{ 0x3c0u, 0x3c0u, spleen_block22 },
+	{ 0x3c3u, 0x3c4u, spleen_block23 },
+	{ 0x3c6u, 0x3c6u, spleen_block24 },
+	{ 0x2016u, 0x2016u, spleen_block25 },
+	{ 0x2018u, 0x2019u, spleen_block26 },
+	{ 0x201cu, 0x201du, spleen_block27 },
+	{ 0x2022u, 0x2022u, spleen_block28 },
+	{ 0x2026u, 0x2026u, spleen_block29 },
+	{ 0x2039u, 0x203au, spleen_block30 },
+	{ 0x203cu, 0x203cu, spleen_block31 },
+	{ 0x207fu, 0x207fu, spleen_block32 },
+	{ 0x20a7u, 0x20a7u, spleen_block33 },
+	{ 0x20acu, 0x20acu, spleen_block34 },
+	{ 0x2190u, 0x2195u, spleen_block35 },
+	{ 0x21a8u, 0x21a8u, spleen_block36 },
+	{ 0x2219u, 0x221au, spleen_block37 },
+	{ 0x221eu, 0x221eu, spleen_block38 },
+	{ 0x2229u, 0x222au, spleen_block39 },
+	{ 0x2248u, 0x2248u, spleen_block40 },
+	{ 0x2261u, 0x2261u, spleen_block41 },
+	{ 0x2264u, 0x2265u, spleen_block42 },
+	{ 0x2302u, 0x2302u, spleen_block43 },
+	{ 0x2310u, 0x2310u, spleen_block44 },
+	{ 0x2319u, 0x2319u, spleen_block45 },
+	{ 0x2320u, 0x2321u, spleen_block46 },
+	{ 0x2500u, 0x25a0u, spleen_block47 },
+	{ 0x25acu, 0x25acu, spleen_block48 },
+	{ 0x25b2u, 0x25b2u, spleen_block49 },
+	{ 0x25bcu, 0x25bcu, spleen_block50 },
+	{ 0x25c6u, 0x25c6u, spleen_block51 },
+	{ 0x25cau, 0x25cbu, spleen_block52 },
+	{ 0x25cfu, 0x25cfu, spleen_block53 },
+	{ 0x25d8u, 0x25d9u, spleen_block54 },
+	{ 0x25e2u, 0x25e5u, spleen_block55 },
+	{ 0x2630u, 0x2637u, spleen_block56 },
+	{ 0x263au, 0x263cu, spleen_block57 },
+	{ 0x2640u, 0x2640u, spleen_block58 },
+	{ 0x2642u, 0x2642u, spleen_block59 },
+	{ 0x2660u, 0x2660u, spleen_block60 },
+	{ 0x2663u, 0x2663u, spleen_block61 },
+	{ 0x2665u, 0x2666u, spleen_block62 },
+	{ 0x266au, 0x266bu, spleen_block63 },
+	{ 0x2800u, 0x28ffu, spleen_block64 },
+	{ 0x2b06u, 0x2b07u, spleen_block65 },
+	{ 0x2b60u, 0x2b65u, spleen_block66 },
+	{ 0xe0a0u, 0xe0a2u, spleen_block67 },
+	{ 0xe0b0u, 0xe0b3u, spleen_block68 },
+};
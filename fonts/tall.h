@@ -3555,3 +3555,189 @@ static const unsigned char tall_block184[][16] = {
 	{ 0x3e, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x3e, 0x60, 0x60, 0x60, 0x60, 0x3e, 0x3e, 0x00, 0x00 },	// U+1FBF9 (🯹)
 }; // 10
 
+static const FBInkGlyphRange tall_ranges[] = {
+	{ 0x00u, 0x19fu, tall_block1 },
+	{ 0x1b7u, 0x1b7u, tall_block2 },
+	{ 0x1cdu, 0x1e3u, tall_block3 },
+	{ 0x1e6u, 0x1e9u, tall_block4 },
+	{ 0x1eeu, 0x1f0u, tall_block5 },
+	{ 0x1f4u, 0x1f5u, tall_block6 },
+	{ 0x1f8u, 0x21bu, tall_block7 },
+	{ 0x226u, 0x227u, tall_block8 },
+	{ 0x22au, 0x233u, tall_block9 },
+	{ 0x258u, 0x259u, tall_block10 },
+	{ 0x25bu, 0x25cu, tall_block11 },
+	{ 0x263u, 0x263u, tall_block12 },
+	{ 0x26au, 0x26au, tall_block13 },
+	{ 0x28au, 0x296u, tall_block14 },
+	{ 0x2c6u, 0x2c6u, tall_block15 },
+	{ 0x2c9u, 0x2c9u, tall_block16 },
+	{ 0x2cdu, 0x2cdu, tall_block17 },
+	{ 0x2dcu, 0x2dcu, tall_block18 },
+	{ 0x300u, 0x30du, tall_block19 },
+	{ 0x30fu, 0x311u, tall_block20 },
+	{ 0x313u, 0x318u, tall_block21 },
+	{ 0x31bu, 0x31cu, tall_block22 },
+	{ 0x31fu, 0x329u, tall_block23 },
+	{ 0x32bu, 0x32cu, tall_block24 },
+	{ 0x32eu, 0x32eu, tall_block25 },
+	{ 0x330u, 0x330u, tall_block26 },
+	{ 0x332u, 0x333u, tall_block27 },
+	{ 0x335u, 0x33eu, tall_block28 },
+	{ 0x340u, 0x344u, tall_block29 },
+	{ 0x34fu, 0x34fu, tall_block30 },
+	{ 0x362u, 0x362u, tall_block31 },
+	{ 0x386u, 0x386u, tall_block32 },
+	{ 0x388u, 0x38au, tall_block33 },
+	{ 0x38cu, 0x38cu, tall_block34 },
+	{ 0x38eu, 0x38fu, tall_block35 },
+	{ 0x391u, 0x3a1u, tall_block36 },
+	{ 0x3a3u, 0x3afu, tall_block37 },
+	{ 0x3b1u, 0x3ceu, tall_block38 },
+	{ 0x400u, 0x401u, tall_block39 },
+	{ 0x405u, 0x409u, tall_block40 },
+	{ 0x410u, 0x451u, tall_block41 },
+	{ 0x455u, 0x458u, tall_block42 },
+	{ 0x4d0u, 0x4d7u, tall_block43 },
+	{ 0x4e6u, 0x4e7u, tall_block44 },
+	{ 0x4f1u, 0x4f1u, tall_block45 },
+	{ 0x5d0u, 0x5eau, tall_block46 },
+	{ 0x623u, 0x623u, tall_block47 },
+	{ 0x627u, 0x62du, tall_block48 },
+	{ 0x62fu, 0x635u, tall_block49 },
+	{ 0x637u, 0x63au, tall_block50 },
+	{ 0x640u, 0x64au, tall_block51 },
+	{ 0x671u, 0x673u, tall_block52 },
+	{ 0x1560u, 0x1563u, tall_block53 },
+	{ 0x156au, 0x156au, tall_block54 },
+	{ 0x156cu, 0x1571u, tall_block55 },
+	{ 0x15ecu, 0x15edu, tall_block56 },
+	{ 0x15efu, 0x15efu, tall_block57 },
+	{ 0x16a0u, 0x16abu, tall_block58 },
+	{ 0x16b1u, 0x16f8u, tall_block59 },
+	{ 0x1e00u, 0x1e02u, tall_block60 },
+	{ 0x1e04u, 0x1e07u, tall_block61 },
+	{ 0x1e0au, 0x1e0au, tall_block62 },
+	{ 0x1e0cu, 0x1e0fu, tall_block63 },
+	{ 0x1e41u, 0x1e4bu, tall_block64 },
+	{ 0x1e58u, 0x1e5bu, tall_block65 },
+	{ 0x1e5eu, 0x1e5eu, tall_block66 },
+	{ 0x1f00u, 0x1f7du, tall_block67 },
+	{ 0x1f80u, 0x1fb4u, tall_block68 },
+	{ 0x1fb6u, 0x1fbcu, tall_block69 },
+	{ 0x1fc2u, 0x1fc4u, tall_block70 },
+	{ 0x1fc6u, 0x1fc7u, tall_block71 },
+	{ 0x1fcau, 0x1fccu, tall_block72 },
+	{ 0x1fd0u, 0x1fd4u, tall_block73 },
+	{ 0x1fd6u, 0x1fdcu, tall_block74 },
+	{ 0x1fe0u, 0x1fe3u, tall_block75 },
+	{ 0x1fe6u, 0x1febu, tall_block76 },
+	{ 0x1ff2u, 0x1ff4u, tall_block77 },
+	{ 0x1ff6u, 0x1ff7u, tall_block78 },
+	{ 0x1ffau, 0x1ffcu, tall_block79 },
+	{ 0x2010u, 0x2019u, tall_block80 },
+	{ 0x201cu, 0x201du, tall_block81 },
+	{ 0x2020u, 0x2022u, tall_block82 },
+	{ 0x2024u, 0x2026u, tall_block83 },
+	{ 0x2030u, 0x2037u, tall_block84 },
+	{ 0x203cu, 0x203du, tall_block85 },
+	{ 0x2044u, 0x2044u, tall_block86 },
+	{ 0x2047u, 0x2049u, tall_block87 },
+	{ 0x2070u, 0x2071u, tall_block88 },
+	{ 0x2074u, 0x207cu, tall_block89 },
+	{ 0x207fu, 0x207fu, tall_block90 },
+	{ 0x20a7u, 0x20a7u, tall_block91 },
+	{ 0x20acu, 0x20acu, tall_block92 },
+	{ 0x2117u, 0x2117u, tall_block93 },
+	{ 0x2120u, 0x2120u, tall_block94 },
+	{ 0x2122u, 0x2122u, tall_block95 },
+	{ 0x2150u, 0x215fu, tall_block96 },
+	{ 0x2189u, 0x2189u, tall_block97 },
+	{ 0x2190u, 0x2199u, tall_block98 },
+	{ 0x21a5u, 0x21a5u, tall_block99 },
+	{ 0x21a8u, 0x21a8u, tall_block100 },
+	{ 0x21b2u, 0x21b2u, tall_block101 },
+	{ 0x21bcu, 0x21c3u, tall_block102 },
+	{ 0x21e6u, 0x21e9u, tall_block103 },
+	{ 0x2205u, 0x2205u, tall_block104 },
+	{ 0x2212u, 0x2215u, tall_block105 },
+	{ 0x2218u, 0x2218u, tall_block106 },
+	{ 0x221au, 0x221cu, tall_block107 },
+	{ 0x221eu, 0x221fu, tall_block108 },
+	{ 0x2229u, 0x2229u, tall_block109 },
+	{ 0x2248u, 0x2248u, tall_block110 },
+	{ 0x2261u, 0x2261u, tall_block111 },
+	{ 0x2264u, 0x2265u, tall_block112 },
+	{ 0x22c5u, 0x22c5u, tall_block113 },
+	{ 0x2301u, 0x2301u, tall_block114 },
+	{ 0x2318u, 0x2318u, tall_block115 },
+	{ 0x2320u, 0x2321u, tall_block116 },
+	{ 0x239bu, 0x23afu, tall_block117 },
+	{ 0x23b2u, 0x23b3u, tall_block118 },
+	{ 0x23b7u, 0x23bdu, tall_block119 },
+	{ 0x23d0u, 0x23d0u, tall_block120 },
+	{ 0x23dau, 0x23dau, tall_block121 },
+	{ 0x2500u, 0x25fcu, tall_block122 },
+	{ 0x25ffu, 0x25ffu, tall_block123 },
+	{ 0x2602u, 0x2602u, tall_block124 },
+	{ 0x2605u, 0x2606u, tall_block125 },
+	{ 0x2609u, 0x2609u, tall_block126 },
+	{ 0x260eu, 0x260eu, tall_block127 },
+	{ 0x2610u, 0x2612u, tall_block128 },
+	{ 0x2625u, 0x2625u, tall_block129 },
+	{ 0x2628u, 0x2628u, tall_block130 },
+	{ 0x262fu, 0x2637u, tall_block131 },
+	{ 0x2639u, 0x263bu, tall_block132 },
+	{ 0x2640u, 0x2640u, tall_block133 },
+	{ 0x2642u, 0x2642u, tall_block134 },
+	{ 0x2660u, 0x2667u, tall_block135 },
+	{ 0x2669u, 0x266cu, tall_block136 },
+	{ 0x2683u, 0x2683u, tall_block137 },
+	{ 0x268au, 0x268fu, tall_block138 },
+	{ 0x269eu, 0x269fu, tall_block139 },
+	{ 0x26acu, 0x26acu, tall_block140 },
+	{ 0x26c8u, 0x26c8u, tall_block141 },
+	{ 0x2708u, 0x2708u, tall_block142 },
+	{ 0x2713u, 0x2713u, tall_block143 },
+	{ 0x2734u, 0x2735u, tall_block144 },
+	{ 0x2764u, 0x2764u, tall_block145 },
+	{ 0x2800u, 0x28ffu, tall_block146 },
+	{ 0x29c9u, 0x29c9u, tall_block147 },
+	{ 0x2b12u, 0x2b19u, tall_block148 },
+	{ 0x2b1du, 0x2b1du, tall_block149 },
+	{ 0x2b24u, 0x2b2fu, tall_block150 },
+	{ 0x2b58u, 0x2b58u, tall_block151 },
+	{ 0x2b73u, 0x2b73u, tall_block152 },
+	{ 0x2b9cu, 0x2b9fu, tall_block153 },
+	{ 0x2bbau, 0x2bbau, tall_block154 },
+	{ 0x2bc0u, 0x2bc0u, tall_block155 },
+	{ 0x2bc5u, 0x2bc8u, tall_block156 },
+	{ 0x2bcau, 0x2bcbu, tall_block157 },
+	{ 0x2e2eu, 0x2e2eu, tall_block158 },
+	{ 0xe080u, 0xe1aau, tall_block159 },
+	{ 0xe800u, 0xe87du, tall_block160 },
+	{ 0xec00u, 0xec07u, tall_block161 },
+	{ 0xec0au, 0xec7du, tall_block162 },
+	{ 0xec7fu, 0xecdeu, tall_block163 },
+	{ 0xfe81u, 0xfe82u, tall_block164 },
+	{ 0xfe84u, 0xfe84u, tall_block165 },
+	{ 0xfe87u, 0xfe88u, tall_block166 },
+	{ 0xfe8eu, 0xfe9cu, tall_block167 },
+	{ 0xfe9eu, 0xfea4u, tall_block168 },
+	{ 0xfea9u, 0xfeb7u, tall_block169 },
+	{ 0xfeb9u, 0xfebcu, tall_block170 },
+	{ 0xfec1u, 0xfec6u, tall_block171 },
+	{ 0xfec9u, 0xfee3u, tall_block172 },
+	{ 0xfee5u, 0xfef4u, tall_block173 },
+	{ 0xff61u, 0xff9fu, tall_block174 },
+	{ 0x1d300u, 0x1d356u, tall_block175 },
+	{ 0x1f3ceu, 0x1f3ceu, tall_block176 },
+	{ 0x1f574u, 0x1f574u, tall_block177 },
+	{ 0x1f577u, 0x1f577u, tall_block178 },
+	{ 0x1f5a8u, 0x1f5a8u, tall_block179 },
+	{ 0x1f5d1u, 0x1f5d1u, tall_block180 },
+	{ 0x1f6d6u, 0x1f6d6u, tall_block181 },
+	{ 0x1f860u, 0x1f860u, tall_block182 },
+	{ 0x1fb00u, 0x1fbcau, tall_block183 },
+	{ 0x1fbf0u, 0x1fbf9u, tall_block184 },
+};
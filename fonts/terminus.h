@@ -1801,3 +1801,152 @@ static const unsigned char terminus_block147[][16] = {
 	{ 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange terminus_ranges[] = {
+	{ 0x00u, 0x00u, terminus_block1 },
+	{ 0x20u, 0x7eu, terminus_block2 },
+	{ 0xa0u, 0x17fu, terminus_block3 },
+	{ 0x186u, 0x186u, terminus_block4 },
+	{ 0x18eu, 0x190u, terminus_block5 },
+	{ 0x192u, 0x192u, terminus_block6 },
+	{ 0x19du, 0x19eu, terminus_block7 },
+	{ 0x1b5u, 0x1b7u, terminus_block8 },
+	{ 0x1cdu, 0x1d4u, terminus_block9 },
+	{ 0x1e2u, 0x1f0u, terminus_block10 },
+	{ 0x1f4u, 0x1f5u, terminus_block11 },
+	{ 0x1fcu, 0x1ffu, terminus_block12 },
+	{ 0x218u, 0x21bu, terminus_block13 },
+	{ 0x232u, 0x233u, terminus_block14 },
+	{ 0x237u, 0x237u, terminus_block15 },
+	{ 0x254u, 0x254u, terminus_block16 },
+	{ 0x258u, 0x259u, terminus_block17 },
+	{ 0x25bu, 0x25bu, terminus_block18 },
+	{ 0x272u, 0x272u, terminus_block19 },
+	{ 0x292u, 0x292u, terminus_block20 },
+	{ 0x2bbu, 0x2bdu, terminus_block21 },
+	{ 0x2c6u, 0x2c7u, terminus_block22 },
+	{ 0x2d8u, 0x2d9u, terminus_block23 },
+	{ 0x2dbu, 0x2ddu, terminus_block24 },
+	{ 0x300u, 0x308u, terminus_block25 },
+	{ 0x30au, 0x30cu, terminus_block26 },
+	{ 0x329u, 0x329u, terminus_block27 },
+	{ 0x384u, 0x38au, terminus_block28 },
+	{ 0x38cu, 0x38cu, terminus_block29 },
+	{ 0x38eu, 0x3a1u, terminus_block30 },
+	{ 0x3a3u, 0x3ceu, terminus_block31 },
+	{ 0x3d1u, 0x3d1u, terminus_block32 },
+	{ 0x3d5u, 0x3d5u, terminus_block33 },
+	{ 0x3f0u, 0x3f6u, terminus_block34 },
+	{ 0x400u, 0x45fu, terminus_block35 },
+	{ 0x462u, 0x463u, terminus_block36 },
+	{ 0x46au, 0x46bu, terminus_block37 },
+	{ 0x490u, 0x49du, terminus_block38 },
+	{ 0x4a0u, 0x4a5u, terminus_block39 },
+	{ 0x4aau, 0x4abu, terminus_block40 },
+	{ 0x4aeu, 0x4b3u, terminus_block41 },
+	{ 0x4b6u, 0x4bbu, terminus_block42 },
+	{ 0x4c0u, 0x4c2u, terminus_block43 },
+	{ 0x4cfu, 0x4dfu, terminus_block44 },
+	{ 0x4e2u, 0x4f5u, terminus_block45 },
+	{ 0x4f8u, 0x4f9u, terminus_block46 },
+	{ 0x5d0u, 0x5eau, terminus_block47 },
+	{ 0x1e0cu, 0x1e0du, terminus_block48 },
+	{ 0x1e34u, 0x1e37u, terminus_block49 },
+	{ 0x1e40u, 0x1e47u, terminus_block50 },
+	{ 0x1e6cu, 0x1e6du, terminus_block51 },
+	{ 0x1eb8u, 0x1eb9u, terminus_block52 },
+	{ 0x1ebcu, 0x1ebdu, terminus_block53 },
+	{ 0x1ecau, 0x1ecdu, terminus_block54 },
+	{ 0x1ee4u, 0x1ee5u, terminus_block55 },
+	{ 0x1ef8u, 0x1ef9u, terminus_block56 },
+	{ 0x2000u, 0x2022u, terminus_block57 },
+	{ 0x2026u, 0x2026u, terminus_block58 },
+	{ 0x2030u, 0x2030u, terminus_block59 },
+	{ 0x2032u, 0x2033u, terminus_block60 },
+	{ 0x2039u, 0x203au, terminus_block61 },
+	{ 0x203cu, 0x203cu, terminus_block62 },
+	{ 0x203eu, 0x203eu, terminus_block63 },
+	{ 0x2070u, 0x2071u, terminus_block64 },
+	{ 0x2074u, 0x208eu, terminus_block65 },
+	{ 0x2090u, 0x2098u, terminus_block66 },
+	{ 0x209au, 0x209au, terminus_block67 },
+	{ 0x20a7u, 0x20a7u, terminus_block68 },
+	{ 0x20aau, 0x20aau, terminus_block69 },
+	{ 0x20acu, 0x20acu, terminus_block70 },
+	{ 0x20aeu, 0x20aeu, terminus_block71 },
+	{ 0x2102u, 0x2102u, terminus_block72 },
+	{ 0x210eu, 0x210fu, terminus_block73 },
+	{ 0x2115u, 0x2116u, terminus_block74 },
+	{ 0x211au, 0x211au, terminus_block75 },
+	{ 0x211du, 0x211du, terminus_block76 },
+	{ 0x2122u, 0x2122u, terminus_block77 },
+	{ 0x2124u, 0x2124u, terminus_block78 },
+	{ 0x2126u, 0x2126u, terminus_block79 },
+	{ 0x2135u, 0x2135u, terminus_block80 },
+	{ 0x2190u, 0x2195u, terminus_block81 },
+	{ 0x21a4u, 0x21a4u, terminus_block82 },
+	{ 0x21a6u, 0x21a6u, terminus_block83 },
+	{ 0x21a8u, 0x21a8u, terminus_block84 },
+	{ 0x21b5u, 0x21b5u, terminus_block85 },
+	{ 0x21bbu, 0x21bbu, terminus_block86 },
+	{ 0x21cbu, 0x21ccu, terminus_block87 },
+	{ 0x21d0u, 0x21d5u, terminus_block88 },
+	{ 0x2200u, 0x2200u, terminus_block89 },
+	{ 0x2203u, 0x220du, terminus_block90 },
+	{ 0x2212u, 0x2216u, terminus_block91 },
+	{ 0x2219u, 0x221au, terminus_block92 },
+	{ 0x221eu, 0x221fu, terminus_block93 },
+	{ 0x2225u, 0x2225u, terminus_block94 },
+	{ 0x2227u, 0x222au, terminus_block95 },
+	{ 0x2248u, 0x2248u, terminus_block96 },
+	{ 0x2260u, 0x2261u, terminus_block97 },
+	{ 0x2264u, 0x2265u, terminus_block98 },
+	{ 0x226au, 0x226bu, terminus_block99 },
+	{ 0x2282u, 0x2283u, terminus_block100 },
+	{ 0x2286u, 0x2287u, terminus_block101 },
+	{ 0x22a5u, 0x22a5u, terminus_block102 },
+	{ 0x22c2u, 0x22c3u, terminus_block103 },
+	{ 0x2300u, 0x2300u, terminus_block104 },
+	{ 0x2302u, 0x2302u, terminus_block105 },
+	{ 0x2308u, 0x230bu, terminus_block106 },
+	{ 0x2310u, 0x2310u, terminus_block107 },
+	{ 0x2319u, 0x2319u, terminus_block108 },
+	{ 0x2320u, 0x2321u, terminus_block109 },
+	{ 0x239bu, 0x23a9u, terminus_block110 },
+	{ 0x23abu, 0x23afu, terminus_block111 },
+	{ 0x23bau, 0x23bdu, terminus_block112 },
+	{ 0x23d0u, 0x23d0u, terminus_block113 },
+	{ 0x2409u, 0x240du, terminus_block114 },
+	{ 0x2424u, 0x2424u, terminus_block115 },
+	{ 0x2500u, 0x2503u, terminus_block116 },
+	{ 0x2508u, 0x254bu, terminus_block117 },
+	{ 0x2550u, 0x2593u, terminus_block118 },
+	{ 0x2596u, 0x25a0u, terminus_block119 },
+	{ 0x25acu, 0x25acu, terminus_block120 },
+	{ 0x25aeu, 0x25aeu, terminus_block121 },
+	{ 0x25b2u, 0x25b2u, terminus_block122 },
+	{ 0x25b6u, 0x25b6u, terminus_block123 },
+	{ 0x25bau, 0x25bau, terminus_block124 },
+	{ 0x25bcu, 0x25bcu, terminus_block125 },
+	{ 0x25c0u, 0x25c0u, terminus_block126 },
+	{ 0x25c4u, 0x25c4u, terminus_block127 },
+	{ 0x25c6u, 0x25c6u, terminus_block128 },
+	{ 0x25cau, 0x25cbu, terminus_block129 },
+	{ 0x25cfu, 0x25cfu, terminus_block130 },
+	{ 0x25d8u, 0x25d9u, terminus_block131 },
+	{ 0x263au, 0x263cu, terminus_block132 },
+	{ 0x2640u, 0x2640u, terminus_block133 },
+	{ 0x2642u, 0x2642u, terminus_block134 },
+	{ 0x2660u, 0x2660u, terminus_block135 },
+	{ 0x2663u, 0x2663u, terminus_block136 },
+	{ 0x2665u, 0x2666u, terminus_block137 },
+	{ 0x266au, 0x266bu, terminus_block138 },
+	{ 0x2713u, 0x2714u, terminus_block139 },
+	{ 0x2717u, 0x2718u, terminus_block140 },
+	{ 0x27e8u, 0x27ebu, terminus_block141 },
+	{ 0x2800u, 0x28ffu, terminus_block142 },
+	{ 0x2e2cu, 0x2e2cu, terminus_block143 },
+	{ 0xe0a0u, 0xe0a2u, terminus_block144 },
+	{ 0xe0b0u, 0xe0b3u, terminus_block145 },
+	{ 0xf6beu, 0xf6beu, terminus_block146 },
+	{ 0xfffdu, 0xfffdu, terminus_block147 },
+};
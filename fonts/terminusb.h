@@ -1801,3 +1801,152 @@ static const unsigned char terminusb_block147[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange terminusb_ranges[] = {
+	{ 0x00u, 0x00u, terminusb_block1 },
+	{ 0x20u, 0x7eu, terminusb_block2 },
+	{ 0xa0u, 0x17fu, terminusb_block3 },
+	{ 0x186u, 0x186u, terminusb_block4 },
+	{ 0x18eu, 0x190u, terminusb_block5 },
+	{ 0x192u, 0x192u, terminusb_block6 },
+	{ 0x19du, 0x19eu, terminusb_block7 },
+	{ 0x1b5u, 0x1b7u, terminusb_block8 },
+	{ 0x1cdu, 0x1d4u, terminusb_block9 },
+	{ 0x1e2u, 0x1f0u, terminusb_block10 },
+	{ 0x1f4u, 0x1f5u, terminusb_block11 },
+	{ 0x1fcu, 0x1ffu, terminusb_block12 },
+	{ 0x218u, 0x21bu, terminusb_block13 },
+	{ 0x232u, 0x233u, terminusb_block14 },
+	{ 0x237u, 0x237u, terminusb_block15 },
+	{ 0x254u, 0x254u, terminusb_block16 },
+	{ 0x258u, 0x259u, terminusb_block17 },
+	{ 0x25bu, 0x25bu, terminusb_block18 },
+	{ 0x272u, 0x272u, terminusb_block19 },
+	{ 0x292u, 0x292u, terminusb_block20 },
+	{ 0x2bbu, 0x2bdu, terminusb_block21 },
+	{ 0x2c6u, 0x2c7u, terminusb_block22 },
+	{ 0x2d8u, 0x2d9u, terminusb_block23 },
+	{ 0x2dbu, 0x2ddu, terminusb_block24 },
+	{ 0x300u, 0x308u, terminusb_block25 },
+	{ 0x30au, 0x30cu, terminusb_block26 },
+	{ 0x329u, 0x329u, terminusb_block27 },
+	{ 0x384u, 0x38au, terminusb_block28 },
+	{ 0x38cu, 0x38cu, terminusb_block29 },
+	{ 0x38eu, 0x3a1u, terminusb_block30 },
+	{ 0x3a3u, 0x3ceu, terminusb_block31 },
+	{ 0x3d1u, 0x3d1u, terminusb_block32 },
+	{ 0x3d5u, 0x3d5u, terminusb_block33 },
+	{ 0x3f0u, 0x3f6u, terminusb_block34 },
+	{ 0x400u, 0x45fu, terminusb_block35 },
+	{ 0x462u, 0x463u, terminusb_block36 },
+	{ 0x46au, 0x46bu, terminusb_block37 },
+	{ 0x490u, 0x49du, terminusb_block38 },
+	{ 0x4a0u, 0x4a5u, terminusb_block39 },
+	{ 0x4aau, 0x4abu, terminusb_block40 },
+	{ 0x4aeu, 0x4b3u, terminusb_block41 },
+	{ 0x4b6u, 0x4bbu, terminusb_block42 },
+	{ 0x4c0u, 0x4c2u, terminusb_block43 },
+	{ 0x4cfu, 0x4dfu, terminusb_block44 },
+	{ 0x4e2u, 0x4f5u, terminusb_block45 },
+	{ 0x4f8u, 0x4f9u, terminusb_block46 },
+	{ 0x5d0u, 0x5eau, terminusb_block47 },
+	{ 0x1e0cu, 0x1e0du, terminusb_block48 },
+	{ 0x1e34u, 0x1e37u, terminusb_block49 },
+	{ 0x1e40u, 0x1e47u, terminusb_block50 },
+	{ 0x1e6cu, 0x1e6du, terminusb_block51 },
+	{ 0x1eb8u, 0x1eb9u, terminusb_block52 },
+	{ 0x1ebcu, 0x1ebdu, terminusb_block53 },
+	{ 0x1ecau, 0x1ecdu, terminusb_block54 },
+	{ 0x1ee4u, 0x1ee5u, terminusb_block55 },
+	{ 0x1ef8u, 0x1ef9u, terminusb_block56 },
+	{ 0x2000u, 0x2022u, terminusb_block57 },
+	{ 0x2026u, 0x2026u, terminusb_block58 },
+	{ 0x2030u, 0x2030u, terminusb_block59 },
+	{ 0x2032u, 0x2033u, terminusb_block60 },
+	{ 0x2039u, 0x203au, terminusb_block61 },
+	{ 0x203cu, 0x203cu, terminusb_block62 },
+	{ 0x203eu, 0x203eu, terminusb_block63 },
+	{ 0x2070u, 0x2071u, terminusb_block64 },
+	{ 0x2074u, 0x208eu, terminusb_block65 },
+	{ 0x2090u, 0x2098u, terminusb_block66 },
+	{ 0x209au, 0x209au, terminusb_block67 },
+	{ 0x20a7u, 0x20a7u, terminusb_block68 },
+	{ 0x20aau, 0x20aau, terminusb_block69 },
+	{ 0x20acu, 0x20acu, terminusb_block70 },
+	{ 0x20aeu, 0x20aeu, terminusb_block71 },
+	{ 0x2102u, 0x2102u, terminusb_block72 },
+	{ 0x210eu, 0x210fu, terminusb_block73 },
+	{ 0x2115u, 0x2116u, terminusb_block74 },
+	{ 0x211au, 0x211au, terminusb_block75 },
+	{ 0x211du, 0x211du, terminusb_block76 },
+	{ 0x2122u, 0x2122u, terminusb_block77 },
+	{ 0x2124u, 0x2124u, terminusb_block78 },
+	{ 0x2126u, 0x2126u, terminusb_block79 },
+	{ 0x2135u, 0x2135u, terminusb_block80 },
+	{ 0x2190u, 0x2195u, terminusb_block81 },
+	{ 0x21a4u, 0x21a4u, terminusb_block82 },
+	{ 0x21a6u, 0x21a6u, terminusb_block83 },
+	{ 0x21a8u, 0x21a8u, terminusb_block84 },
+	{ 0x21b5u, 0x21b5u, terminusb_block85 },
+	{ 0x21bbu, 0x21bbu, terminusb_block86 },
+	{ 0x21cbu, 0x21ccu, terminusb_block87 },
+	{ 0x21d0u, 0x21d5u, terminusb_block88 },
+	{ 0x2200u, 0x2200u, terminusb_block89 },
+	{ 0x2203u, 0x220du, terminusb_block90 },
+	{ 0x2212u, 0x2216u, terminusb_block91 },
+	{ 0x2219u, 0x221au, terminusb_block92 },
+	{ 0x221eu, 0x221fu, terminusb_block93 },
+	{ 0x2225u, 0x2225u, terminusb_block94 },
+	{ 0x2227u, 0x222au, terminusb_block95 },
+	{ 0x2248u, 0x2248u, terminusb_block96 },
+	{ 0x2260u, 0x2261u, terminusb_block97 },
+	{ 0x2264u, 0x2265u, terminusb_block98 },
+	{ 0x226au, 0x226bu, terminusb_block99 },
+	{ 0x2282u, 0x2283u, terminusb_block100 },
+	{ 0x2286u, 0x2287u, terminusb_block101 },
+	{ 0x22a5u, 0x22a5u, terminusb_block102 },
+	{ 0x22c2u, 0x22c3u, terminusb_block103 },
+	{ 0x2300u, 0x2300u, terminusb_block104 },
+	{ 0x2302u, 0x2302u, terminusb_block105 },
+	{ 0x2308u, 0x230bu, terminusb_block106 },
+	{ 0x2310u, 0x2310u, terminusb_block107 },
+	{ 0x2319u, 0x2319u, terminusb_block108 },
+	{ 0x2320u, 0x2321u, terminusb_block109 },
+	{ 0x239bu, 0x23a9u, terminusb_block110 },
+	{ 0x23abu, 0x23afu, terminusb_block111 },
+	{ 0x23bau, 0x23bdu, terminusb_block112 },
+	{ 0x23d0u, 0x23d0u, terminusb_block113 },
+	{ 0x2409u, 0x240du, terminusb_block114 },
+	{ 0x2424u, 0x2424u, terminusb_block115 },
+	{ 0x2500u, 0x2503u, terminusb_block116 },
+	{ 0x2508u, 0x254bu, terminusb_block117 },
+	{ 0x2550u, 0x2593u, terminusb_block118 },
+	{ 0x2596u, 0x25a0u, terminusb_block119 },
+	{ 0x25acu, 0x25acu, terminusb_block120 },
+	{ 0x25aeu, 0x25aeu, terminusb_block121 },
+	{ 0x25b2u, 0x25b2u, terminusb_block122 },
+	{ 0x25b6u, 0x25b6u, terminusb_block123 },
+	{ 0x25bau, 0x25bau, terminusb_block124 },
+	{ 0x25bcu, 0x25bcu, terminusb_block125 },
+	{ 0x25c0u, 0x25c0u, terminusb_block126 },
+	{ 0x25c4u, 0x25c4u, terminusb_block127 },
+	{ 0x25c6u, 0x25c6u, terminusb_block128 },
+	{ 0x25cau, 0x25cbu, terminusb_block129 },
+	{ 0x25cfu, 0x25cfu, terminusb_block130 },
+	{ 0x25d8u, 0x25d9u, terminusb_block131 },
+	{ 0x263au, 0x263cu, terminusb_block132 },
+	{ 0x2640u, 0x2640u, terminusb_block133 },
+	{ 0x2642u, 0x2642u, terminusb_block134 },
+	{ 0x2660u, 0x2660u, terminusb_block135 },
+	{ 0x2663u, 0x2663u, terminusb_block136 },
+	{ 0x2665u, 0x2666u, terminusb_block137 },
+	{ 0x266au, 0x266bu, terminusb_block138 },
+	{ 0x2713u, 0x2714u, terminusb_block139 },
+	{ 0x2717u, 0x2718u, terminusb_block140 },
+	{ 0x27e8u, 0x27ebu, terminusb_block141 },
+	{ 0x2800u, 0x28ffu, terminusb_block142 },
+	{ 0x2e2cu, 0x2e2cu, terminusb_block143 },
+	{ 0xe0a0u, 0xe0a2u, terminusb_block144 },
+	{ 0xe0b0u, 0xe0b3u, terminusb_block145 },
+	{ 0xf6beu, 0xf6beu, terminusb_block146 },
+	{ 0xfffdu, 0xfffdu, terminusb_block147 },
+};
@@ -3977,3 +3977,189 @@ static const unsigned char tewi_block184[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1f, 0x1b, 0x0e, 0x04, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange tewi_ranges[] = {
+	{ 0x20u, 0x7eu, tewi_block1 },
+	{ 0xa1u, 0xacu, tewi_block2 },
+	{ 0xaeu, 0x2bdu, tewi_block3 },
+	{ 0x2c2u, 0x2cbu, tewi_block4 },
+	{ 0x2d0u, 0x2d1u, tewi_block5 },
+	{ 0x2d8u, 0x2deu, tewi_block6 },
+	{ 0x2e0u, 0x2e0u, tewi_block7 },
+	{ 0x2e4u, 0x2e4u, tewi_block8 },
+	{ 0x2eeu, 0x2eeu, tewi_block9 },
+	{ 0x300u, 0x30eu, tewi_block10 },
+	{ 0x310u, 0x315u, tewi_block11 },
+	{ 0x31au, 0x31au, tewi_block12 },
+	{ 0x31cu, 0x31cu, tewi_block13 },
+	{ 0x31fu, 0x320u, tewi_block14 },
+	{ 0x324u, 0x325u, tewi_block15 },
+	{ 0x32au, 0x32au, tewi_block16 },
+	{ 0x32cu, 0x32cu, tewi_block17 },
+	{ 0x330u, 0x330u, tewi_block18 },
+	{ 0x339u, 0x33cu, tewi_block19 },
+	{ 0x343u, 0x344u, tewi_block20 },
+	{ 0x35cu, 0x35cu, tewi_block21 },
+	{ 0x361u, 0x361u, tewi_block22 },
+	{ 0x370u, 0x377u, tewi_block23 },
+	{ 0x37au, 0x37fu, tewi_block24 },
+	{ 0x384u, 0x38au, tewi_block25 },
+	{ 0x38cu, 0x38cu, tewi_block26 },
+	{ 0x38eu, 0x3a1u, tewi_block27 },
+	{ 0x3a3u, 0x486u, tewi_block28 },
+	{ 0x48au, 0x4ffu, tewi_block29 },
+	{ 0x5beu, 0x5beu, tewi_block30 },
+	{ 0x5c0u, 0x5c0u, tewi_block31 },
+	{ 0x5c3u, 0x5c3u, tewi_block32 },
+	{ 0x5c6u, 0x5c6u, tewi_block33 },
+	{ 0x5d0u, 0x5efu, tewi_block34 },
+	{ 0xca0u, 0xca0u, tewi_block35 },
+	{ 0xe3fu, 0xe3fu, tewi_block36 },
+	{ 0x16a0u, 0x16a0u, tewi_block37 },
+	{ 0x16a2u, 0x16a3u, tewi_block38 },
+	{ 0x16a5u, 0x16a6u, tewi_block39 },
+	{ 0x16a8u, 0x16acu, tewi_block40 },
+	{ 0x1e00u, 0x1ea9u, tewi_block41 },
+	{ 0x1eabu, 0x1eb3u, tewi_block42 },
+	{ 0x1eb5u, 0x1ec3u, tewi_block43 },
+	{ 0x1ec5u, 0x1f15u, tewi_block44 },
+	{ 0x1f18u, 0x1f1du, tewi_block45 },
+	{ 0x1f20u, 0x1f45u, tewi_block46 },
+	{ 0x1f48u, 0x1f4du, tewi_block47 },
+	{ 0x1f50u, 0x1f57u, tewi_block48 },
+	{ 0x1f59u, 0x1f59u, tewi_block49 },
+	{ 0x1f5bu, 0x1f5bu, tewi_block50 },
+	{ 0x1f5du, 0x1f5du, tewi_block51 },
+	{ 0x1f5fu, 0x1f7du, tewi_block52 },
+	{ 0x1f80u, 0x1fb4u, tewi_block53 },
+	{ 0x1fb6u, 0x1fbfu, tewi_block54 },
+	{ 0x1fc2u, 0x1fc4u, tewi_block55 },
+	{ 0x1fc6u, 0x1fd3u, tewi_block56 },
+	{ 0x1fd6u, 0x1fdbu, tewi_block57 },
+	{ 0x1fddu, 0x1fefu, tewi_block58 },
+	{ 0x1ff2u, 0x1ff4u, tewi_block59 },
+	{ 0x1ff6u, 0x1ffeu, tewi_block60 },
+	{ 0x2010u, 0x2010u, tewi_block61 },
+	{ 0x2012u, 0x2027u, tewi_block62 },
+	{ 0x2030u, 0x2030u, tewi_block63 },
+	{ 0x2032u, 0x203au, tewi_block64 },
+	{ 0x203cu, 0x2056u, tewi_block65 },
+	{ 0x2058u, 0x205eu, tewi_block66 },
+	{ 0x2070u, 0x2071u, tewi_block67 },
+	{ 0x2074u, 0x208eu, tewi_block68 },
+	{ 0x2090u, 0x209cu, tewi_block69 },
+	{ 0x20a0u, 0x20a6u, tewi_block70 },
+	{ 0x20a8u, 0x20afu, tewi_block71 },
+	{ 0x20b1u, 0x20b3u, tewi_block72 },
+	{ 0x20b5u, 0x20b6u, tewi_block73 },
+	{ 0x20b8u, 0x20bau, tewi_block74 },
+	{ 0x20bcu, 0x20bdu, tewi_block75 },
+	{ 0x2100u, 0x210bu, tewi_block76 },
+	{ 0x2116u, 0x2117u, tewi_block77 },
+	{ 0x2122u, 0x2122u, tewi_block78 },
+	{ 0x2125u, 0x2127u, tewi_block79 },
+	{ 0x212au, 0x212bu, tewi_block80 },
+	{ 0x212fu, 0x212fu, tewi_block81 },
+	{ 0x2133u, 0x2134u, tewi_block82 },
+	{ 0x2160u, 0x2166u, tewi_block83 },
+	{ 0x2168u, 0x2176u, tewi_block84 },
+	{ 0x2178u, 0x2180u, tewi_block85 },
+	{ 0x2183u, 0x2183u, tewi_block86 },
+	{ 0x2190u, 0x2193u, tewi_block87 },
+	{ 0x2195u, 0x21acu, tewi_block88 },
+	{ 0x21afu, 0x21cdu, tewi_block89 },
+	{ 0x21cfu, 0x21d3u, tewi_block90 },
+	{ 0x21d5u, 0x21efu, tewi_block91 },
+	{ 0x21f1u, 0x21f8u, tewi_block92 },
+	{ 0x21fau, 0x21fau, tewi_block93 },
+	{ 0x21fdu, 0x21feu, tewi_block94 },
+	{ 0x2200u, 0x222cu, tewi_block95 },
+	{ 0x222eu, 0x222fu, tewi_block96 },
+	{ 0x2231u, 0x225cu, tewi_block97 },
+	{ 0x225eu, 0x2299u, tewi_block98 },
+	{ 0x229bu, 0x229bu, tewi_block99 },
+	{ 0x229du, 0x2320u, tewi_block100 },
+	{ 0x2322u, 0x2328u, tewi_block101 },
+	{ 0x232bu, 0x232bu, tewi_block102 },
+	{ 0x232du, 0x232du, tewi_block103 },
+	{ 0x232fu, 0x237eu, tewi_block104 },
+	{ 0x2380u, 0x2380u, tewi_block105 },
+	{ 0x2388u, 0x2388u, tewi_block106 },
+	{ 0x238bu, 0x238bu, tewi_block107 },
+	{ 0x23bau, 0x23bdu, tewi_block108 },
+	{ 0x23e9u, 0x23efu, tewi_block109 },
+	{ 0x2408u, 0x240fu, tewi_block110 },
+	{ 0x2423u, 0x2426u, tewi_block111 },
+	{ 0x2440u, 0x244au, tewi_block112 },
+	{ 0x2460u, 0x24b5u, tewi_block113 },
+	{ 0x2500u, 0x2609u, tewi_block114 },
+	{ 0x2610u, 0x2611u, tewi_block115 },
+	{ 0x2614u, 0x2614u, tewi_block116 },
+	{ 0x2616u, 0x2617u, tewi_block117 },
+	{ 0x261eu, 0x261eu, tewi_block118 },
+	{ 0x2630u, 0x2637u, tewi_block119 },
+	{ 0x263au, 0x263cu, tewi_block120 },
+	{ 0x263fu, 0x2642u, tewi_block121 },
+	{ 0x2660u, 0x266fu, tewi_block122 },
+	{ 0x26a2u, 0x26a9u, tewi_block123 },
+	{ 0x2708u, 0x2708u, tewi_block124 },
+	{ 0x2713u, 0x2718u, tewi_block125 },
+	{ 0x271au, 0x2721u, tewi_block126 },
+	{ 0x2724u, 0x2727u, tewi_block127 },
+	{ 0x2729u, 0x272bu, tewi_block128 },
+	{ 0x2733u, 0x2733u, tewi_block129 },
+	{ 0x2736u, 0x2736u, tewi_block130 },
+	{ 0x273fu, 0x273fu, tewi_block131 },
+	{ 0x2741u, 0x2741u, tewi_block132 },
+	{ 0x274fu, 0x2752u, tewi_block133 },
+	{ 0x275bu, 0x2760u, tewi_block134 },
+	{ 0x2764u, 0x2766u, tewi_block135 },
+	{ 0x276cu, 0x2771u, tewi_block136 },
+	{ 0x278au, 0x279bu, tewi_block137 },
+	{ 0x27e8u, 0x27e9u, tewi_block138 },
+	{ 0x27f2u, 0x27f3u, tewi_block139 },
+	{ 0x27f5u, 0x27f6u, tewi_block140 },
+	{ 0x27f8u, 0x27f9u, tewi_block141 },
+	{ 0x27fbu, 0x28ffu, tewi_block142 },
+	{ 0x2902u, 0x2903u, tewi_block143 },
+	{ 0x2906u, 0x2909u, tewi_block144 },
+	{ 0x290cu, 0x290fu, tewi_block145 },
+	{ 0x2912u, 0x2913u, tewi_block146 },
+	{ 0x2919u, 0x291eu, tewi_block147 },
+	{ 0x2921u, 0x2926u, tewi_block148 },
+	{ 0x2933u, 0x2946u, tewi_block149 },
+	{ 0x2949u, 0x294du, tewi_block150 },
+	{ 0x294fu, 0x294fu, tewi_block151 },
+	{ 0x2951u, 0x2976u, tewi_block152 },
+	{ 0x2978u, 0x297fu, tewi_block153 },
+	{ 0x2b00u, 0x2b03u, tewi_block154 },
+	{ 0x2b05u, 0x2b0bu, tewi_block155 },
+	{ 0x2b0du, 0x2b32u, tewi_block156 },
+	{ 0x2b38u, 0x2b38u, tewi_block157 },
+	{ 0x2b3fu, 0x2b55u, tewi_block158 },
+	{ 0x2b58u, 0x2b58u, tewi_block159 },
+	{ 0x2b5au, 0x2b63u, tewi_block160 },
+	{ 0x2b65u, 0x2b73u, tewi_block161 },
+	{ 0x2b76u, 0x2b79u, tewi_block162 },
+	{ 0x2b7eu, 0x2b7eu, tewi_block163 },
+	{ 0x2b80u, 0x2b80u, tewi_block164 },
+	{ 0x2b82u, 0x2b82u, tewi_block165 },
+	{ 0x2b88u, 0x2b93u, tewi_block166 },
+	{ 0x2b95u, 0x2b95u, tewi_block167 },
+	{ 0x2ba0u, 0x2bafu, tewi_block168 },
+	{ 0x2bb8u, 0x2bb8u, tewi_block169 },
+	{ 0x2bc0u, 0x2bc2u, tewi_block170 },
+	{ 0x2bc5u, 0x2bc8u, tewi_block171 },
+	{ 0x2bcau, 0x2bcfu, tewi_block172 },
+	{ 0x2becu, 0x2befu, tewi_block173 },
+	{ 0x2c60u, 0x2c7fu, tewi_block174 },
+	{ 0x2e00u, 0x2e0du, tewi_block175 },
+	{ 0x2e0fu, 0x2e18u, tewi_block176 },
+	{ 0x2e1au, 0x2e40u, tewi_block177 },
+	{ 0xe0a0u, 0xe0a2u, tewi_block178 },
+	{ 0xe0a5u, 0xe0acu, tewi_block179 },
+	{ 0xe0b0u, 0xe0b3u, tewi_block180 },
+	{ 0xe0b5u, 0xe0b8u, tewi_block181 },
+	{ 0xe0c0u, 0xe0c7u, tewi_block182 },
+	{ 0xfb01u, 0xfb02u, tewi_block183 },
+	{ 0xfffdu, 0xfffdu, tewi_block184 },
+};
@@ -383,3 +383,8 @@ static const unsigned char tewib_block3[][13] = {
 	{ 0x00, 0x00, 0x0c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+01B2 (Ʋ)
 }; // 127
 
+static const FBInkGlyphRange tewib_ranges[] = {
+	{ 0x20u, 0x7eu, tewib_block1 },
+	{ 0xa0u, 0x131u, tewib_block2 },
+	{ 0x134u, 0x1b2u, tewib_block3 },
+};
@@ -3893,3 +3893,237 @@ static const unsigned char thin_block232[][8] = {
 	{ 0x3e, 0x63, 0x63, 0x3e, 0x60, 0x60, 0x3e, 0x00 },	// U+1FBF9 (🯹)
 }; // 10
 
+static const FBInkGlyphRange thin_ranges[] = {
+	{ 0x00u, 0x195u, thin_block1 },
+	{ 0x197u, 0x19fu, thin_block2 },
+	{ 0x1b7u, 0x1b7u, thin_block3 },
+	{ 0x1cdu, 0x1e3u, thin_block4 },
+	{ 0x1e6u, 0x1e9u, thin_block5 },
+	{ 0x1eeu, 0x1f0u, thin_block6 },
+	{ 0x1f4u, 0x1f5u, thin_block7 },
+	{ 0x1f8u, 0x21bu, thin_block8 },
+	{ 0x226u, 0x227u, thin_block9 },
+	{ 0x22au, 0x233u, thin_block10 },
+	{ 0x258u, 0x259u, thin_block11 },
+	{ 0x263u, 0x263u, thin_block12 },
+	{ 0x292u, 0x292u, thin_block13 },
+	{ 0x294u, 0x294u, thin_block14 },
+	{ 0x2c6u, 0x2c6u, thin_block15 },
+	{ 0x2c9u, 0x2c9u, thin_block16 },
+	{ 0x2cdu, 0x2cdu, thin_block17 },
+	{ 0x2dcu, 0x2dcu, thin_block18 },
+	{ 0x300u, 0x30du, thin_block19 },
+	{ 0x30fu, 0x311u, thin_block20 },
+	{ 0x313u, 0x318u, thin_block21 },
+	{ 0x31bu, 0x31cu, thin_block22 },
+	{ 0x31fu, 0x329u, thin_block23 },
+	{ 0x32bu, 0x32cu, thin_block24 },
+	{ 0x32eu, 0x32eu, thin_block25 },
+	{ 0x330u, 0x330u, thin_block26 },
+	{ 0x332u, 0x333u, thin_block27 },
+	{ 0x335u, 0x33eu, thin_block28 },
+	{ 0x340u, 0x344u, thin_block29 },
+	{ 0x34fu, 0x34fu, thin_block30 },
+	{ 0x362u, 0x362u, thin_block31 },
+	{ 0x386u, 0x386u, thin_block32 },
+	{ 0x388u, 0x38au, thin_block33 },
+	{ 0x38cu, 0x38cu, thin_block34 },
+	{ 0x38eu, 0x38fu, thin_block35 },
+	{ 0x391u, 0x3a1u, thin_block36 },
+	{ 0x3a3u, 0x3afu, thin_block37 },
+	{ 0x3b1u, 0x3ceu, thin_block38 },
+	{ 0x400u, 0x401u, thin_block39 },
+	{ 0x405u, 0x409u, thin_block40 },
+	{ 0x410u, 0x451u, thin_block41 },
+	{ 0x455u, 0x458u, thin_block42 },
+	{ 0x4d0u, 0x4d7u, thin_block43 },
+	{ 0x4e6u, 0x4e7u, thin_block44 },
+	{ 0x4f1u, 0x4f1u, thin_block45 },
+	{ 0x5d0u, 0x5eau, thin_block46 },
+	{ 0x623u, 0x623u, thin_block47 },
+	{ 0x627u, 0x62du, thin_block48 },
+	{ 0x62fu, 0x635u, thin_block49 },
+	{ 0x637u, 0x63au, thin_block50 },
+	{ 0x640u, 0x64au, thin_block51 },
+	{ 0x671u, 0x673u, thin_block52 },
+	{ 0x1560u, 0x1563u, thin_block53 },
+	{ 0x156au, 0x156au, thin_block54 },
+	{ 0x156cu, 0x1571u, thin_block55 },
+	{ 0x15ecu, 0x15edu, thin_block56 },
+	{ 0x15efu, 0x15efu, thin_block57 },
+	{ 0x16a0u, 0x16abu, thin_block58 },
+	{ 0x16b1u, 0x16f8u, thin_block59 },
+	{ 0x1e00u, 0x1e02u, thin_block60 },
+	{ 0x1e04u, 0x1e07u, thin_block61 },
+	{ 0x1e0au, 0x1e0au, thin_block62 },
+	{ 0x1e0cu, 0x1e0fu, thin_block63 },
+	{ 0x1e41u, 0x1e4bu, thin_block64 },
+	{ 0x1e58u, 0x1e5bu, thin_block65 },
+	{ 0x1e5eu, 0x1e5eu, thin_block66 },
+	{ 0x1f00u, 0x1f7du, thin_block67 },
+	{ 0x1f80u, 0x1fb4u, thin_block68 },
+	{ 0x1fb6u, 0x1fbcu, thin_block69 },
+	{ 0x1fc2u, 0x1fc4u, thin_block70 },
+	{ 0x1fc6u, 0x1fc7u, thin_block71 },
+	{ 0x1fcau, 0x1fccu, thin_block72 },
+	{ 0x1fd0u, 0x1fd4u, thin_block73 },
+	{ 0x1fd6u, 0x1fdcu, thin_block74 },
+	{ 0x1fe0u, 0x1fe3u, thin_block75 },
+	{ 0x1fe6u, 0x1febu, thin_block76 },
+	{ 0x1ff2u, 0x1ff4u, thin_block77 },
+	{ 0x1ff6u, 0x1ff7u, thin_block78 },
+	{ 0x1ffau, 0x1ffcu, thin_block79 },
+	{ 0x2010u, 0x2019u, thin_block80 },
+	{ 0x201cu, 0x201du, thin_block81 },
+	{ 0x2020u, 0x2022u, thin_block82 },
+	{ 0x2024u, 0x2026u, thin_block83 },
+	{ 0x2030u, 0x2037u, thin_block84 },
+	{ 0x203cu, 0x203du, thin_block85 },
+	{ 0x2044u, 0x2044u, thin_block86 },
+	{ 0x2047u, 0x2049u, thin_block87 },
+	{ 0x2070u, 0x2071u, thin_block88 },
+	{ 0x2074u, 0x207cu, thin_block89 },
+	{ 0x207fu, 0x207fu, thin_block90 },
+	{ 0x20a7u, 0x20a7u, thin_block91 },
+	{ 0x20acu, 0x20acu, thin_block92 },
+	{ 0x2117u, 0x2117u, thin_block93 },
+	{ 0x2120u, 0x2120u, thin_block94 },
+	{ 0x2122u, 0x2122u, thin_block95 },
+	{ 0x2150u, 0x215fu, thin_block96 },
+	{ 0x2189u, 0x2189u, thin_block97 },
+	{ 0x2190u, 0x2199u, thin_block98 },
+	{ 0x21a5u, 0x21a5u, thin_block99 },
+	{ 0x21a8u, 0x21a8u, thin_block100 },
+	{ 0x21b2u, 0x21b2u, thin_block101 },
+	{ 0x21bcu, 0x21c3u, thin_block102 },
+	{ 0x21e6u, 0x21e9u, thin_block103 },
+	{ 0x2205u, 0x2205u, thin_block104 },
+	{ 0x2212u, 0x2215u, thin_block105 },
+	{ 0x2218u, 0x2218u, thin_block106 },
+	{ 0x221au, 0x221cu, thin_block107 },
+	{ 0x221eu, 0x221fu, thin_block108 },
+	{ 0x2229u, 0x2229u, thin_block109 },
+	{ 0x2248u, 0x2248u, thin_block110 },
+	{ 0x2261u, 0x2261u, thin_block111 },
+	{ 0x2264u, 0x2265u, thin_block112 },
+	{ 0x22c5u, 0x22c5u, thin_block113 },
+	{ 0x2301u, 0x2301u, thin_block114 },
+	{ 0x2318u, 0x2318u, thin_block115 },
+	{ 0x231au, 0x231bu, thin_block116 },
+	{ 0x2320u, 0x2321u, thin_block117 },
+	{ 0x239bu, 0x23afu, thin_block118 },
+	{ 0x23b2u, 0x23b3u, thin_block119 },
+	{ 0x23b7u, 0x23bdu, thin_block120 },
+	{ 0x23d0u, 0x23d0u, thin_block121 },
+	{ 0x23dau, 0x23dau, thin_block122 },
+	{ 0x23e9u, 0x23ecu, thin_block123 },
+	{ 0x2500u, 0x25ffu, thin_block124 },
+	{ 0x2602u, 0x2602u, thin_block125 },
+	{ 0x2605u, 0x2606u, thin_block126 },
+	{ 0x2609u, 0x2609u, thin_block127 },
+	{ 0x260eu, 0x260eu, thin_block128 },
+	{ 0x2610u, 0x2612u, thin_block129 },
+	{ 0x2615u, 0x2615u, thin_block130 },
+	{ 0x2625u, 0x2625u, thin_block131 },
+	{ 0x2628u, 0x2628u, thin_block132 },
+	{ 0x262fu, 0x2637u, thin_block133 },
+	{ 0x2639u, 0x263bu, thin_block134 },
+	{ 0x2640u, 0x2640u, thin_block135 },
+	{ 0x2642u, 0x2642u, thin_block136 },
+	{ 0x2660u, 0x2667u, thin_block137 },
+	{ 0x2669u, 0x266cu, thin_block138 },
+	{ 0x2683u, 0x2683u, thin_block139 },
+	{ 0x268au, 0x268fu, thin_block140 },
+	{ 0x269eu, 0x269fu, thin_block141 },
+	{ 0x26aau, 0x26acu, thin_block142 },
+	{ 0x26c8u, 0x26c8u, thin_block143 },
+	{ 0x26f5u, 0x26f5u, thin_block144 },
+	{ 0x2708u, 0x2708u, thin_block145 },
+	{ 0x2713u, 0x2713u, thin_block146 },
+	{ 0x2734u, 0x2735u, thin_block147 },
+	{ 0x2764u, 0x2764u, thin_block148 },
+	{ 0x2800u, 0x28ffu, thin_block149 },
+	{ 0x29c9u, 0x29c9u, thin_block150 },
+	{ 0x2b12u, 0x2b19u, thin_block151 },
+	{ 0x2b1du, 0x2b1du, thin_block152 },
+	{ 0x2b24u, 0x2b2fu, thin_block153 },
+	{ 0x2b55u, 0x2b55u, thin_block154 },
+	{ 0x2b58u, 0x2b58u, thin_block155 },
+	{ 0x2b73u, 0x2b73u, thin_block156 },
+	{ 0x2b9cu, 0x2b9fu, thin_block157 },
+	{ 0x2bbau, 0x2bbau, thin_block158 },
+	{ 0x2bc0u, 0x2bc0u, thin_block159 },
+	{ 0x2bc5u, 0x2bc8u, thin_block160 },
+	{ 0x2bcau, 0x2bcbu, thin_block161 },
+	{ 0x2e2eu, 0x2e2eu, thin_block162 },
+	{ 0x4dc0u, 0x4dffu, thin_block163 },
+	{ 0xe080u, 0xe1aau, thin_block164 },
+	{ 0xe800u, 0xe87du, thin_block165 },
+	{ 0xec00u, 0xec07u, thin_block166 },
+	{ 0xec0au, 0xec7du, thin_block167 },
+	{ 0xec7fu, 0xecdeu, thin_block168 },
+	{ 0xfe81u, 0xfe82u, thin_block169 },
+	{ 0xfe84u, 0xfe84u, thin_block170 },
+	{ 0xfe87u, 0xfe87u, thin_block171 },
+	{ 0xfe8fu, 0xfe9cu, thin_block172 },
+	{ 0xfe9eu, 0xfea4u, thin_block173 },
+	{ 0xfea9u, 0xfeadu, thin_block174 },
+	{ 0xfeafu, 0xfeafu, thin_block175 },
+	{ 0xfeb1u, 0xfeb7u, thin_block176 },
+	{ 0xfeb9u, 0xfebcu, thin_block177 },
+	{ 0xfec1u, 0xfec6u, thin_block178 },
+	{ 0xfec9u, 0xfeddu, thin_block179 },
+	{ 0xfedfu, 0xfee3u, thin_block180 },
+	{ 0xfee5u, 0xfee9u, thin_block181 },
+	{ 0xfeebu, 0xfef4u, thin_block182 },
+	{ 0xff01u, 0xff36u, thin_block183 },
+	{ 0xff38u, 0xff5du, thin_block184 },
+	{ 0xff5fu, 0xff9fu, thin_block185 },
+	{ 0x1d300u, 0x1d356u, thin_block186 },
+	{ 0x1f332u, 0x1f333u, thin_block187 },
+	{ 0x1f344u, 0x1f345u, thin_block188 },
+	{ 0x1f34eu, 0x1f34fu, thin_block189 },
+	{ 0x1f37au, 0x1f37au, thin_block190 },
+	{ 0x1f37eu, 0x1f37eu, thin_block191 },
+	{ 0x1f3ceu, 0x1f3ceu, thin_block192 },
+	{ 0x1f3d0u, 0x1f3d0u, thin_block193 },
+	{ 0x1f3f0u, 0x1f3f0u, thin_block194 },
+	{ 0x1f407u, 0x1f408u, thin_block195 },
+	{ 0x1f40du, 0x1f40du, thin_block196 },
+	{ 0x1f419u, 0x1f419u, thin_block197 },
+	{ 0x1f41fu, 0x1f41fu, thin_block198 },
+	{ 0x1f42au, 0x1f42au, thin_block199 },
+	{ 0x1f47bu, 0x1f47bu, thin_block200 },
+	{ 0x1f47eu, 0x1f47eu, thin_block201 },
+	{ 0x1f480u, 0x1f480u, thin_block202 },
+	{ 0x1f48du, 0x1f48eu, thin_block203 },
+	{ 0x1f4a7u, 0x1f4a7u, thin_block204 },
+	{ 0x1f4adu, 0x1f4adu, thin_block205 },
+	{ 0x1f4b0u, 0x1f4b0u, thin_block206 },
+	{ 0x1f4beu, 0x1f4beu, thin_block207 },
+	{ 0x1f4c1u, 0x1f4c1u, thin_block208 },
+	{ 0x1f4c4u, 0x1f4c4u, thin_block209 },
+	{ 0x1f4dcu, 0x1f4dcu, thin_block210 },
+	{ 0x1f4fbu, 0x1f4fbu, thin_block211 },
+	{ 0x1f514u, 0x1f514u, thin_block212 },
+	{ 0x1f52bu, 0x1f52bu, thin_block213 },
+	{ 0x1f52eu, 0x1f52eu, thin_block214 },
+	{ 0x1f574u, 0x1f574u, thin_block215 },
+	{ 0x1f577u, 0x1f577u, thin_block216 },
+	{ 0x1f5a8u, 0x1f5a8u, thin_block217 },
+	{ 0x1f5d1u, 0x1f5d1u, thin_block218 },
+	{ 0x1f68du, 0x1f68du, thin_block219 },
+	{ 0x1f6d6u, 0x1f6d6u, thin_block220 },
+	{ 0x1f6f8u, 0x1f6f8u, thin_block221 },
+	{ 0x1f860u, 0x1f860u, thin_block222 },
+	{ 0x1f986u, 0x1f986u, thin_block223 },
+	{ 0x1f98bu, 0x1f98bu, thin_block224 },
+	{ 0x1f9f2u, 0x1f9f2u, thin_block225 },
+	{ 0x1fa90u, 0x1fa90u, thin_block226 },
+	{ 0x1fa93u, 0x1fa93u, thin_block227 },
+	{ 0x1fa99u, 0x1fa99u, thin_block228 },
+	{ 0x1fa9cu, 0x1fa9cu, thin_block229 },
+	{ 0x1faa6u, 0x1faa8u, thin_block230 },
+	{ 0x1fb00u, 0x1fbcau, thin_block231 },
+	{ 0x1fbf0u, 0x1fbf9u, thin_block232 },
+};
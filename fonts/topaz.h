@@ -265,3 +265,6 @@ static const unsigned char topaz_block1[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18, 0x0c, 0x0c },	// U+00FF (ÿ)
 }; // 256
 
+static const FBInkGlyphRange topaz_ranges[] = {
+	{ 0x00u, 0xffu, topaz_block1 },
+};
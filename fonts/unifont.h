@@ -8209,3 +8209,371 @@ static const unsigned char unifont_block366[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7e, 0x66, 0x5a, 0x5a, 0x5e, 0x6e, 0x6e, 0x7e, 0x6e, 0x6e, 0x7e, 0x00, 0x00 },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange unifont_ranges[] = {
+	{ 0x20u, 0x7eu, unifont_block1 },
+	{ 0xa0u, 0xacu, unifont_block2 },
+	{ 0xaeu, 0x34eu, unifont_block3 },
+	{ 0x350u, 0x35bu, unifont_block4 },
+	{ 0x363u, 0x377u, unifont_block5 },
+	{ 0x37au, 0x37fu, unifont_block6 },
+	{ 0x384u, 0x38au, unifont_block7 },
+	{ 0x38cu, 0x38cu, unifont_block8 },
+	{ 0x38eu, 0x3a1u, unifont_block9 },
+	{ 0x3a3u, 0x487u, unifont_block10 },
+	{ 0x48au, 0x529u, unifont_block11 },
+	{ 0x52cu, 0x52fu, unifont_block12 },
+	{ 0x531u, 0x556u, unifont_block13 },
+	{ 0x559u, 0x58au, unifont_block14 },
+	{ 0x58fu, 0x58fu, unifont_block15 },
+	{ 0x591u, 0x5c7u, unifont_block16 },
+	{ 0x5d0u, 0x5eau, unifont_block17 },
+	{ 0x5efu, 0x5f4u, unifont_block18 },
+	{ 0x609u, 0x60au, unifont_block19 },
+	{ 0x60cu, 0x60du, unifont_block20 },
+	{ 0x610u, 0x610u, unifont_block21 },
+	{ 0x618u, 0x61bu, unifont_block22 },
+	{ 0x61fu, 0x655u, unifont_block23 },
+	{ 0x657u, 0x6a9u, unifont_block24 },
+	{ 0x6abu, 0x6d5u, unifont_block25 },
+	{ 0x6dbu, 0x6dbu, unifont_block26 },
+	{ 0x6dfu, 0x6e1u, unifont_block27 },
+	{ 0x6e4u, 0x6e7u, unifont_block28 },
+	{ 0x6eeu, 0x6ffu, unifont_block29 },
+	{ 0x750u, 0x78fu, unifont_block30 },
+	{ 0x791u, 0x79cu, unifont_block31 },
+	{ 0x7a0u, 0x7b1u, unifont_block32 },
+	{ 0x7c0u, 0x7fau, unifont_block33 },
+	{ 0x7fdu, 0x7ffu, unifont_block34 },
+	{ 0x8a0u, 0x8b4u, unifont_block35 },
+	{ 0x8b6u, 0x8c7u, unifont_block36 },
+	{ 0x8d3u, 0x8d9u, unifont_block37 },
+	{ 0x8e0u, 0x8ffu, unifont_block38 },
+	{ 0xe01u, 0xe3au, unifont_block39 },
+	{ 0xe3fu, 0xe5au, unifont_block40 },
+	{ 0xe81u, 0xe82u, unifont_block41 },
+	{ 0xe84u, 0xe84u, unifont_block42 },
+	{ 0xe86u, 0xe8au, unifont_block43 },
+	{ 0xe8cu, 0xea3u, unifont_block44 },
+	{ 0xea5u, 0xea5u, unifont_block45 },
+	{ 0xea7u, 0xebdu, unifont_block46 },
+	{ 0xec0u, 0xec4u, unifont_block47 },
+	{ 0xec6u, 0xec6u, unifont_block48 },
+	{ 0xec8u, 0xecdu, unifont_block49 },
+	{ 0xed0u, 0xed9u, unifont_block50 },
+	{ 0xedcu, 0xedfu, unifont_block51 },
+	{ 0xf00u, 0xf01u, unifont_block52 },
+	{ 0xf04u, 0xf15u, unifont_block53 },
+	{ 0xf19u, 0xf39u, unifont_block54 },
+	{ 0xf3cu, 0xf47u, unifont_block55 },
+	{ 0xf49u, 0xf6cu, unifont_block56 },
+	{ 0xf71u, 0xf87u, unifont_block57 },
+	{ 0xf89u, 0xf97u, unifont_block58 },
+	{ 0xf99u, 0xfbcu, unifont_block59 },
+	{ 0xfbeu, 0xfc4u, unifont_block60 },
+	{ 0xfceu, 0xfcfu, unifont_block61 },
+	{ 0xfd1u, 0xfd4u, unifont_block62 },
+	{ 0x10a0u, 0x10c5u, unifont_block63 },
+	{ 0x10c7u, 0x10c7u, unifont_block64 },
+	{ 0x10cdu, 0x10cdu, unifont_block65 },
+	{ 0x10d0u, 0x10ffu, unifont_block66 },
+	{ 0x1343u, 0x1343u, unifont_block67 },
+	{ 0x1361u, 0x1361u, unifont_block68 },
+	{ 0x1390u, 0x1394u, unifont_block69 },
+	{ 0x1396u, 0x1396u, unifont_block70 },
+	{ 0x1399u, 0x1399u, unifont_block71 },
+	{ 0x13a0u, 0x13f5u, unifont_block72 },
+	{ 0x13f8u, 0x13fdu, unifont_block73 },
+	{ 0x1400u, 0x1400u, unifont_block74 },
+	{ 0x141eu, 0x142au, unifont_block75 },
+	{ 0x1433u, 0x1439u, unifont_block76 },
+	{ 0x1449u, 0x144bu, unifont_block77 },
+	{ 0x1466u, 0x1466u, unifont_block78 },
+	{ 0x146bu, 0x14bfu, unifont_block79 },
+	{ 0x14d0u, 0x14d2u, unifont_block80 },
+	{ 0x14eau, 0x150bu, unifont_block81 },
+	{ 0x1525u, 0x1541u, unifont_block82 },
+	{ 0x1548u, 0x1552u, unifont_block83 },
+	{ 0x155du, 0x155du, unifont_block84 },
+	{ 0x156au, 0x156au, unifont_block85 },
+	{ 0x157bu, 0x157du, unifont_block86 },
+	{ 0x1586u, 0x1589u, unifont_block87 },
+	{ 0x1597u, 0x159au, unifont_block88 },
+	{ 0x159fu, 0x159fu, unifont_block89 },
+	{ 0x15a6u, 0x15b7u, unifont_block90 },
+	{ 0x15eeu, 0x15eeu, unifont_block91 },
+	{ 0x1601u, 0x1603u, unifont_block92 },
+	{ 0x1646u, 0x1647u, unifont_block93 },
+	{ 0x165au, 0x165au, unifont_block94 },
+	{ 0x166du, 0x166eu, unifont_block95 },
+	{ 0x1677u, 0x167fu, unifont_block96 },
+	{ 0x16a0u, 0x16dfu, unifont_block97 },
+	{ 0x16e1u, 0x16e1u, unifont_block98 },
+	{ 0x16e3u, 0x16f8u, unifont_block99 },
+	{ 0x1762u, 0x1762u, unifont_block100 },
+	{ 0x17bbu, 0x17bbu, unifont_block101 },
+	{ 0x17cbu, 0x17cbu, unifont_block102 },
+	{ 0x17d6u, 0x17d6u, unifont_block103 },
+	{ 0x17dcu, 0x17dcu, unifont_block104 },
+	{ 0x17f0u, 0x17f9u, unifont_block105 },
+	{ 0x18b4u, 0x18b6u, unifont_block106 },
+	{ 0x18b8u, 0x18b8u, unifont_block107 },
+	{ 0x18bau, 0x18bau, unifont_block108 },
+	{ 0x18beu, 0x18bfu, unifont_block109 },
+	{ 0x18c3u, 0x18c5u, unifont_block110 },
+	{ 0x18d4u, 0x18dfu, unifont_block111 },
+	{ 0x18e9u, 0x18e9u, unifont_block112 },
+	{ 0x18ebu, 0x18ebu, unifont_block113 },
+	{ 0x18f3u, 0x18f5u, unifont_block114 },
+	{ 0x1950u, 0x196du, unifont_block115 },
+	{ 0x1970u, 0x1974u, unifont_block116 },
+	{ 0x1983u, 0x1983u, unifont_block117 },
+	{ 0x198fu, 0x198fu, unifont_block118 },
+	{ 0x1991u, 0x1991u, unifont_block119 },
+	{ 0x199au, 0x199au, unifont_block120 },
+	{ 0x199eu, 0x199eu, unifont_block121 },
+	{ 0x19a1u, 0x19a1u, unifont_block122 },
+	{ 0x19a3u, 0x19a4u, unifont_block123 },
+	{ 0x19a7u, 0x19a7u, unifont_block124 },
+	{ 0x19b0u, 0x19b3u, unifont_block125 },
+	{ 0x19b7u, 0x19bau, unifont_block126 },
+	{ 0x19c1u, 0x19c1u, unifont_block127 },
+	{ 0x19c6u, 0x19c6u, unifont_block128 },
+	{ 0x19c8u, 0x19c9u, unifont_block129 },
+	{ 0x19d0u, 0x19d4u, unifont_block130 },
+	{ 0x19d6u, 0x19d6u, unifont_block131 },
+	{ 0x19d8u, 0x19d9u, unifont_block132 },
+	{ 0x1ab0u, 0x1ac0u, unifont_block133 },
+	{ 0x1c50u, 0x1c88u, unifont_block134 },
+	{ 0x1c90u, 0x1cbau, unifont_block135 },
+	{ 0x1cbdu, 0x1cbfu, unifont_block136 },
+	{ 0x1d00u, 0x1d79u, unifont_block137 },
+	{ 0x1d7bu, 0x1dccu, unifont_block138 },
+	{ 0x1dceu, 0x1df9u, unifont_block139 },
+	{ 0x1dfbu, 0x1dfbu, unifont_block140 },
+	{ 0x1dfdu, 0x1f15u, unifont_block141 },
+	{ 0x1f18u, 0x1f1du, unifont_block142 },
+	{ 0x1f20u, 0x1f45u, unifont_block143 },
+	{ 0x1f48u, 0x1f4du, unifont_block144 },
+	{ 0x1f50u, 0x1f57u, unifont_block145 },
+	{ 0x1f59u, 0x1f59u, unifont_block146 },
+	{ 0x1f5bu, 0x1f5bu, unifont_block147 },
+	{ 0x1f5du, 0x1f5du, unifont_block148 },
+	{ 0x1f5fu, 0x1f7du, unifont_block149 },
+	{ 0x1f80u, 0x1fb4u, unifont_block150 },
+	{ 0x1fb6u, 0x1fc4u, unifont_block151 },
+	{ 0x1fc6u, 0x1fd3u, unifont_block152 },
+	{ 0x1fd6u, 0x1fdbu, unifont_block153 },
+	{ 0x1fddu, 0x1fefu, unifont_block154 },
+	{ 0x1ff2u, 0x1ff4u, unifont_block155 },
+	{ 0x1ff6u, 0x1ffeu, unifont_block156 },
+	{ 0x2000u, 0x200au, unifont_block157 },
+	{ 0x2010u, 0x2027u, unifont_block158 },
+	{ 0x202fu, 0x2056u, unifont_block159 },
+	{ 0x2058u, 0x205fu, unifont_block160 },
+	{ 0x2070u, 0x2071u, unifont_block161 },
+	{ 0x2074u, 0x208eu, unifont_block162 },
+	{ 0x2090u, 0x209cu, unifont_block163 },
+	{ 0x20a0u, 0x20b8u, unifont_block164 },
+	{ 0x20bau, 0x20bfu, unifont_block165 },
+	{ 0x20d0u, 0x20dcu, unifont_block166 },
+	{ 0x20e1u, 0x20e1u, unifont_block167 },
+	{ 0x20e5u, 0x20e6u, unifont_block168 },
+	{ 0x20e8u, 0x20e9u, unifont_block169 },
+	{ 0x20ebu, 0x20f0u, unifont_block170 },
+	{ 0x2100u, 0x210du, unifont_block171 },
+	{ 0x2110u, 0x212du, unifont_block172 },
+	{ 0x212fu, 0x2139u, unifont_block173 },
+	{ 0x213eu, 0x213eu, unifont_block174 },
+	{ 0x2141u, 0x2144u, unifont_block175 },
+	{ 0x214au, 0x214bu, unifont_block176 },
+	{ 0x214du, 0x214eu, unifont_block177 },
+	{ 0x2150u, 0x2181u, unifont_block178 },
+	{ 0x2183u, 0x2187u, unifont_block179 },
+	{ 0x2189u, 0x218bu, unifont_block180 },
+	{ 0x2190u, 0x219bu, unifont_block181 },
+	{ 0x219eu, 0x21f3u, unifont_block182 },
+	{ 0x21f5u, 0x21f8u, unifont_block183 },
+	{ 0x21fdu, 0x21feu, unifont_block184 },
+	{ 0x2200u, 0x22b5u, unifont_block185 },
+	{ 0x22b9u, 0x22d7u, unifont_block186 },
+	{ 0x22dau, 0x22f1u, unifont_block187 },
+	{ 0x22f4u, 0x22f4u, unifont_block188 },
+	{ 0x22f7u, 0x22f8u, unifont_block189 },
+	{ 0x22fcu, 0x22fcu, unifont_block190 },
+	{ 0x22feu, 0x22feu, unifont_block191 },
+	{ 0x2301u, 0x2315u, unifont_block192 },
+	{ 0x2317u, 0x2328u, unifont_block193 },
+	{ 0x232bu, 0x232bu, unifont_block194 },
+	{ 0x2336u, 0x237au, unifont_block195 },
+	{ 0x237fu, 0x2380u, unifont_block196 },
+	{ 0x2395u, 0x2396u, unifont_block197 },
+	{ 0x239bu, 0x23b1u, unifont_block198 },
+	{ 0x23b7u, 0x23bfu, unifont_block199 },
+	{ 0x23cbu, 0x23ccu, unifont_block200 },
+	{ 0x23cfu, 0x23d3u, unifont_block201 },
+	{ 0x23dau, 0x23dau, unifont_block202 },
+	{ 0x23e8u, 0x23e8u, unifont_block203 },
+	{ 0x2422u, 0x2426u, unifont_block204 },
+	{ 0x2440u, 0x244au, unifont_block205 },
+	{ 0x2500u, 0x25eeu, unifont_block206 },
+	{ 0x25f0u, 0x2602u, unifont_block207 },
+	{ 0x2604u, 0x260fu, unifont_block208 },
+	{ 0x2613u, 0x2614u, unifont_block209 },
+	{ 0x261au, 0x2621u, unifont_block210 },
+	{ 0x2625u, 0x262au, unifont_block211 },
+	{ 0x262du, 0x262eu, unifont_block212 },
+	{ 0x2638u, 0x2671u, unifont_block213 },
+	{ 0x2690u, 0x2691u, unifont_block214 },
+	{ 0x26a1u, 0x26a1u, unifont_block215 },
+	{ 0x26a8u, 0x26a8u, unifont_block216 },
+	{ 0x26aau, 0x26acu, unifont_block217 },
+	{ 0x26b2u, 0x26b5u, unifont_block218 },
+	{ 0x26b7u, 0x26bcu, unifont_block219 },
+	{ 0x26e2u, 0x26e2u, unifont_block220 },
+	{ 0x2768u, 0x2775u, unifont_block221 },
+	{ 0x27b0u, 0x27b0u, unifont_block222 },
+	{ 0x27c0u, 0x27c0u, unifont_block223 },
+	{ 0x27c2u, 0x27c2u, unifont_block224 },
+	{ 0x27c5u, 0x27c7u, unifont_block225 },
+	{ 0x27cau, 0x27cau, unifont_block226 },
+	{ 0x27d1u, 0x27d1u, unifont_block227 },
+	{ 0x27d3u, 0x27d4u, unifont_block228 },
+	{ 0x27dfu, 0x27e0u, unifont_block229 },
+	{ 0x27e6u, 0x27efu, unifont_block230 },
+	{ 0x2800u, 0x28ffu, unifont_block231 },
+	{ 0x2908u, 0x2909u, unifont_block232 },
+	{ 0x2912u, 0x2913u, unifont_block233 },
+	{ 0x2938u, 0x2939u, unifont_block234 },
+	{ 0x2949u, 0x2949u, unifont_block235 },
+	{ 0x294cu, 0x294du, unifont_block236 },
+	{ 0x294fu, 0x294fu, unifont_block237 },
+	{ 0x2951u, 0x2951u, unifont_block238 },
+	{ 0x2954u, 0x2955u, unifont_block239 },
+	{ 0x2958u, 0x2959u, unifont_block240 },
+	{ 0x295cu, 0x295du, unifont_block241 },
+	{ 0x2960u, 0x2961u, unifont_block242 },
+	{ 0x297cu, 0x297du, unifont_block243 },
+	{ 0x2980u, 0x2992u, unifont_block244 },
+	{ 0x2997u, 0x299du, unifont_block245 },
+	{ 0x299fu, 0x29a7u, unifont_block246 },
+	{ 0x29d1u, 0x29d9u, unifont_block247 },
+	{ 0x29dcu, 0x29deu, unifont_block248 },
+	{ 0x29e1u, 0x29e1u, unifont_block249 },
+	{ 0x29ebu, 0x29ebu, unifont_block250 },
+	{ 0x29eeu, 0x29f3u, unifont_block251 },
+	{ 0x29f5u, 0x29fdu, unifont_block252 },
+	{ 0x2a0bu, 0x2a0bu, unifont_block253 },
+	{ 0x2a0du, 0x2a1cu, unifont_block254 },
+	{ 0x2a1eu, 0x2a1fu, unifont_block255 },
+	{ 0x2a21u, 0x2a2cu, unifont_block256 },
+	{ 0x2a2fu, 0x2a32u, unifont_block257 },
+	{ 0x2a3cu, 0x2a4du, unifont_block258 },
+	{ 0x2a66u, 0x2a67u, unifont_block259 },
+	{ 0x2a6au, 0x2a73u, unifont_block260 },
+	{ 0x2a77u, 0x2a77u, unifont_block261 },
+	{ 0x2a8bu, 0x2a8cu, unifont_block262 },
+	{ 0x2a8fu, 0x2a94u, unifont_block263 },
+	{ 0x2abfu, 0x2accu, unifont_block264 },
+	{ 0x2ad3u, 0x2ad6u, unifont_block265 },
+	{ 0x2adeu, 0x2adeu, unifont_block266 },
+	{ 0x2aeeu, 0x2af2u, unifont_block267 },
+	{ 0x2af6u, 0x2af6u, unifont_block268 },
+	{ 0x2afeu, 0x2affu, unifont_block269 },
+	{ 0x2b06u, 0x2b07u, unifont_block270 },
+	{ 0x2b0du, 0x2b0du, unifont_block271 },
+	{ 0x2b1du, 0x2b1eu, unifont_block272 },
+	{ 0x2b25u, 0x2b2bu, unifont_block273 },
+	{ 0x2b2eu, 0x2b2fu, unifont_block274 },
+	{ 0x2b31u, 0x2b31u, unifont_block275 },
+	{ 0x2b4eu, 0x2b4fu, unifont_block276 },
+	{ 0x2bc9u, 0x2bc9u, unifont_block277 },
+	{ 0x2bffu, 0x2c0eu, unifont_block278 },
+	{ 0x2c10u, 0x2c1eu, unifont_block279 },
+	{ 0x2c20u, 0x2c26u, unifont_block280 },
+	{ 0x2c2au, 0x2c2eu, unifont_block281 },
+	{ 0x2c30u, 0x2c3eu, unifont_block282 },
+	{ 0x2c40u, 0x2c4eu, unifont_block283 },
+	{ 0x2c50u, 0x2c56u, unifont_block284 },
+	{ 0x2c5au, 0x2c5eu, unifont_block285 },
+	{ 0x2c60u, 0x2ccdu, unifont_block286 },
+	{ 0x2cd0u, 0x2ce6u, unifont_block287 },
+	{ 0x2ce8u, 0x2ce9u, unifont_block288 },
+	{ 0x2cebu, 0x2ceeu, unifont_block289 },
+	{ 0x2cf0u, 0x2cf3u, unifont_block290 },
+	{ 0x2cf9u, 0x2d04u, unifont_block291 },
+	{ 0x2d06u, 0x2d06u, unifont_block292 },
+	{ 0x2d08u, 0x2d09u, unifont_block293 },
+	{ 0x2d0bu, 0x2d0cu, unifont_block294 },
+	{ 0x2d0eu, 0x2d0fu, unifont_block295 },
+	{ 0x2d11u, 0x2d12u, unifont_block296 },
+	{ 0x2d15u, 0x2d1au, unifont_block297 },
+	{ 0x2d1du, 0x2d1fu, unifont_block298 },
+	{ 0x2d21u, 0x2d24u, unifont_block299 },
+	{ 0x2d27u, 0x2d27u, unifont_block300 },
+	{ 0x2d2du, 0x2d2du, unifont_block301 },
+	{ 0x2d30u, 0x2d47u, unifont_block302 },
+	{ 0x2d49u, 0x2d67u, unifont_block303 },
+	{ 0x2d6fu, 0x2d70u, unifont_block304 },
+	{ 0x2d7fu, 0x2d7fu, unifont_block305 },
+	{ 0x2de0u, 0x2e0du, unifont_block306 },
+	{ 0x2e12u, 0x2e12u, unifont_block307 },
+	{ 0x2e16u, 0x2e39u, unifont_block308 },
+	{ 0x2e3cu, 0x2e42u, unifont_block309 },
+	{ 0x2e44u, 0x2e4fu, unifont_block310 },
+	{ 0x2e52u, 0x2e52u, unifont_block311 },
+	{ 0x303fu, 0x303fu, unifont_block312 },
+	{ 0xa4d0u, 0xa4ffu, unifont_block313 },
+	{ 0xa640u, 0xa64bu, unifont_block314 },
+	{ 0xa64eu, 0xa64fu, unifont_block315 },
+	{ 0xa652u, 0xa65du, unifont_block316 },
+	{ 0xa65fu, 0xa661u, unifont_block317 },
+	{ 0xa668u, 0xa66bu, unifont_block318 },
+	{ 0xa66fu, 0xa66fu, unifont_block319 },
+	{ 0xa671u, 0xa671u, unifont_block320 },
+	{ 0xa673u, 0xa683u, unifont_block321 },
+	{ 0xa686u, 0xa697u, unifont_block322 },
+	{ 0xa69au, 0xa6f7u, unifont_block323 },
+	{ 0xa700u, 0xa727u, unifont_block324 },
+	{ 0xa72au, 0xa731u, unifont_block325 },
+	{ 0xa73eu, 0xa74du, unifont_block326 },
+	{ 0xa750u, 0xa757u, unifont_block327 },
+	{ 0xa75au, 0xa770u, unifont_block328 },
+	{ 0xa778u, 0xa7bfu, unifont_block329 },
+	{ 0xa7c4u, 0xa7cau, unifont_block330 },
+	{ 0xa7f5u, 0xa7feu, unifont_block331 },
+	{ 0xa828u, 0xa829u, unifont_block332 },
+	{ 0xab30u, 0xab65u, unifont_block333 },
+	{ 0xab68u, 0xab6bu, unifont_block334 },
+	{ 0xab70u, 0xabbfu, unifont_block335 },
+	{ 0xfb00u, 0xfb06u, unifont_block336 },
+	{ 0xfb13u, 0xfb17u, unifont_block337 },
+	{ 0xfb1du, 0xfb20u, unifont_block338 },
+	{ 0xfb29u, 0xfb36u, unifont_block339 },
+	{ 0xfb38u, 0xfb3cu, unifont_block340 },
+	{ 0xfb3eu, 0xfb3eu, unifont_block341 },
+	{ 0xfb40u, 0xfb41u, unifont_block342 },
+	{ 0xfb43u, 0xfb44u, unifont_block343 },
+	{ 0xfb46u, 0xfbc1u, unifont_block344 },
+	{ 0xfbd3u, 0xfc1eu, unifont_block345 },
+	{ 0xfc20u, 0xfc20u, unifont_block346 },
+	{ 0xfc22u, 0xfc24u, unifont_block347 },
+	{ 0xfc26u, 0xfc3cu, unifont_block348 },
+	{ 0xfc3fu, 0xfcacu, unifont_block349 },
+	{ 0xfcb0u, 0xfcb0u, unifont_block350 },
+	{ 0xfcb8u, 0xfce6u, unifont_block351 },
+	{ 0xfcebu, 0xfcfau, unifont_block352 },
+	{ 0xfcffu, 0xfd16u, unifont_block353 },
+	{ 0xfd21u, 0xfd2cu, unifont_block354 },
+	{ 0xfd33u, 0xfd33u, unifont_block355 },
+	{ 0xfd3au, 0xfd3du, unifont_block356 },
+	{ 0xfe20u, 0xfe2fu, unifont_block357 },
+	{ 0xfe70u, 0xfe74u, unifont_block358 },
+	{ 0xfe76u, 0xfefcu, unifont_block359 },
+	{ 0xff61u, 0xffbeu, unifont_block360 },
+	{ 0xffc2u, 0xffc7u, unifont_block361 },
+	{ 0xffcau, 0xffcfu, unifont_block362 },
+	{ 0xffd2u, 0xffd7u, unifont_block363 },
+	{ 0xffdau, 0xffdcu, unifont_block364 },
+	{ 0xffe8u, 0xffeeu, unifont_block365 },
+	{ 0xfffdu, 0xfffdu, unifont_block366 },
+};
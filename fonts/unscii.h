@@ -3893,3 +3893,237 @@ static const unsigned char unscii_block232[][8] = {
 	{ 0x3e, 0x63, 0x63, 0x3e, 0x60, 0x60, 0x3e, 0x00 },	// U+1FBF9 (🯹)
 }; // 10
 
+static const FBInkGlyphRange unscii_ranges[] = {
+	{ 0x00u, 0x195u, unscii_block1 },
+	{ 0x197u, 0x19fu, unscii_block2 },
+	{ 0x1b7u, 0x1b7u, unscii_block3 },
+	{ 0x1cdu, 0x1e3u, unscii_block4 },
+	{ 0x1e6u, 0x1e9u, unscii_block5 },
+	{ 0x1eeu, 0x1f0u, unscii_block6 },
+	{ 0x1f4u, 0x1f5u, unscii_block7 },
+	{ 0x1f8u, 0x21bu, unscii_block8 },
+	{ 0x226u, 0x227u, unscii_block9 },
+	{ 0x22au, 0x233u, unscii_block10 },
+	{ 0x258u, 0x259u, unscii_block11 },
+	{ 0x263u, 0x263u, unscii_block12 },
+	{ 0x292u, 0x292u, unscii_block13 },
+	{ 0x294u, 0x294u, unscii_block14 },
+	{ 0x2c6u, 0x2c6u, unscii_block15 },
+	{ 0x2c9u, 0x2c9u, unscii_block16 },
+	{ 0x2cdu, 0x2cdu, unscii_block17 },
+	{ 0x2dcu, 0x2dcu, unscii_block18 },
+	{ 0x300u, 0x30du, unscii_block19 },
+	{ 0x30fu, 0x311u, unscii_block20 },
+	{ 0x313u, 0x318u, unscii_block21 },
+	{ 0x31bu, 0x31cu, unscii_block22 },
+	{ 0x31fu, 0x329u, unscii_block23 },
+	{ 0x32bu, 0x32cu, unscii_block24 },
+	{ 0x32eu, 0x32eu, unscii_block25 },
+	{ 0x330u, 0x330u, unscii_block26 },
+	{ 0x332u, 0x333u, unscii_block27 },
+	{ 0x335u, 0x33eu, unscii_block28 },
+	{ 0x340u, 0x344u, unscii_block29 },
+	{ 0x34fu, 0x34fu, unscii_block30 },
+	{ 0x362u, 0x362u, unscii_block31 },
+	{ 0x386u, 0x386u, unscii_block32 },
+	{ 0x388u, 0x38au, unscii_block33 },
+	{ 0x38cu, 0x38cu, unscii_block34 },
+	{ 0x38eu, 0x38fu, unscii_block35 },
+	{ 0x391u, 0x3a1u, unscii_block36 },
+	{ 0x3a3u, 0x3afu, unscii_block37 },
+	{ 0x3b1u, 0x3ceu, unscii_block38 },
+	{ 0x400u, 0x401u, unscii_block39 },
+	{ 0x405u, 0x409u, unscii_block40 },
+	{ 0x410u, 0x451u, unscii_block41 },
+	{ 0x455u, 0x458u, unscii_block42 },
+	{ 0x4d0u, 0x4d7u, unscii_block43 },
+	{ 0x4e6u, 0x4e7u, unscii_block44 },
+	{ 0x4f1u, 0x4f1u, unscii_block45 },
+	{ 0x5d0u, 0x5eau, unscii_block46 },
+	{ 0x623u, 0x623u, unscii_block47 },
+	{ 0x627u, 0x62du, unscii_block48 },
+	{ 0x62fu, 0x635u, unscii_block49 },
+	{ 0x637u, 0x63au, unscii_block50 },
+	{ 0x640u, 0x64au, unscii_block51 },
+	{ 0x671u, 0x673u, unscii_block52 },
+	{ 0x1560u, 0x1563u, unscii_block53 },
+	{ 0x156au, 0x156au, unscii_block54 },
+	{ 0x156cu, 0x1571u, unscii_block55 },
+	{ 0x15ecu, 0x15edu, unscii_block56 },
+	{ 0x15efu, 0x15efu, unscii_block57 },
+	{ 0x16a0u, 0x16abu, unscii_block58 },
+	{ 0x16b1u, 0x16f8u, unscii_block59 },
+	{ 0x1e00u, 0x1e02u, unscii_block60 },
+	{ 0x1e04u, 0x1e07u, unscii_block61 },
+	{ 0x1e0au, 0x1e0au, unscii_block62 },
+	{ 0x1e0cu, 0x1e0fu, unscii_block63 },
+	{ 0x1e41u, 0x1e4bu, unscii_block64 },
+	{ 0x1e58u, 0x1e5bu, unscii_block65 },
+	{ 0x1e5eu, 0x1e5eu, unscii_block66 },
+	{ 0x1f00u, 0x1f7du, unscii_block67 },
+	{ 0x1f80u, 0x1fb4u, unscii_block68 },
+	{ 0x1fb6u, 0x1fbcu, unscii_block69 },
+	{ 0x1fc2u, 0x1fc4u, unscii_block70 },
+	{ 0x1fc6u, 0x1fc7u, unscii_block71 },
+	{ 0x1fcau, 0x1fccu, unscii_block72 },
+	{ 0x1fd0u, 0x1fd4u, unscii_block73 },
+	{ 0x1fd6u, 0x1fdcu, unscii_block74 },
+	{ 0x1fe0u, 0x1fe3u, unscii_block75 },
+	{ 0x1fe6u, 0x1febu, unscii_block76 },
+	{ 0x1ff2u, 0x1ff4u, unscii_block77 },
+	{ 0x1ff6u, 0x1ff7u, unscii_block78 },
+	{ 0x1ffau, 0x1ffcu, unscii_block79 },
+	{ 0x2010u, 0x2019u, unscii_block80 },
+	{ 0x201cu, 0x201du, unscii_block81 },
+	{ 0x2020u, 0x2022u, unscii_block82 },
+	{ 0x2024u, 0x2026u, unscii_block83 },
+	{ 0x2030u, 0x2037u, unscii_block84 },
+	{ 0x203cu, 0x203du, unscii_block85 },
+	{ 0x2044u, 0x2044u, unscii_block86 },
+	{ 0x2047u, 0x2049u, unscii_block87 },
+	{ 0x2070u, 0x2071u, unscii_block88 },
+	{ 0x2074u, 0x207cu, unscii_block89 },
+	{ 0x207fu, 0x207fu, unscii_block90 },
+	{ 0x20a7u, 0x20a7u, unscii_block91 },
+	{ 0x20acu, 0x20acu, unscii_block92 },
+	{ 0x2117u, 0x2117u, unscii_block93 },
+	{ 0x2120u, 0x2120u, unscii_block94 },
+	{ 0x2122u, 0x2122u, unscii_block95 },
+	{ 0x2150u, 0x215fu, unscii_block96 },
+	{ 0x2189u, 0x2189u, unscii_block97 },
+	{ 0x2190u, 0x2199u, unscii_block98 },
+	{ 0x21a5u, 0x21a5u, unscii_block99 },
+	{ 0x21a8u, 0x21a8u, unscii_block100 },
+	{ 0x21b2u, 0x21b2u, unscii_block101 },
+	{ 0x21bcu, 0x21c3u, unscii_block102 },
+	{ 0x21e6u, 0x21e9u, unscii_block103 },
+	{ 0x2205u, 0x2205u, unscii_block104 },
+	{ 0x2212u, 0x2215u, unscii_block105 },
+	{ 0x2218u, 0x2218u, unscii_block106 },
+	{ 0x221au, 0x221cu, unscii_block107 },
+	{ 0x221eu, 0x221fu, unscii_block108 },
+	{ 0x2229u, 0x2229u, unscii_block109 },
+	{ 0x2248u, 0x2248u, unscii_block110 },
+	{ 0x2261u, 0x2261u, unscii_block111 },
+	{ 0x2264u, 0x2265u, unscii_block112 },
+	{ 0x22c5u, 0x22c5u, unscii_block113 },
+	{ 0x2301u, 0x2301u, unscii_block114 },
+	{ 0x2318u, 0x2318u, unscii_block115 },
+	{ 0x231au, 0x231bu, unscii_block116 },
+	{ 0x2320u, 0x2321u, unscii_block117 },
+	{ 0x239bu, 0x23afu, unscii_block118 },
+	{ 0x23b2u, 0x23b3u, unscii_block119 },
+	{ 0x23b7u, 0x23bdu, unscii_block120 },
+	{ 0x23d0u, 0x23d0u, unscii_block121 },
+	{ 0x23dau, 0x23dau, unscii_block122 },
+	{ 0x23e9u, 0x23ecu, unscii_block123 },
+	{ 0x2500u, 0x25ffu, unscii_block124 },
+	{ 0x2602u, 0x2602u, unscii_block125 },
+	{ 0x2605u, 0x2606u, unscii_block126 },
+	{ 0x2609u, 0x2609u, unscii_block127 },
+	{ 0x260eu, 0x260eu, unscii_block128 },
+	{ 0x2610u, 0x2612u, unscii_block129 },
+	{ 0x2615u, 0x2615u, unscii_block130 },
+	{ 0x2625u, 0x2625u, unscii_block131 },
+	{ 0x2628u, 0x2628u, unscii_block132 },
+	{ 0x262fu, 0x2637u, unscii_block133 },
+	{ 0x2639u, 0x263bu, unscii_block134 },
+	{ 0x2640u, 0x2640u, unscii_block135 },
+	{ 0x2642u, 0x2642u, unscii_block136 },
+	{ 0x2660u, 0x2667u, unscii_block137 },
+	{ 0x2669u, 0x266cu, unscii_block138 },
+	{ 0x2683u, 0x2683u, unscii_block139 },
+	{ 0x268au, 0x268fu, unscii_block140 },
+	{ 0x269eu, 0x269fu, unscii_block141 },
+	{ 0x26aau, 0x26acu, unscii_block142 },
+	{ 0x26c8u, 0x26c8u, unscii_block143 },
+	{ 0x26f5u, 0x26f5u, unscii_block144 },
+	{ 0x2708u, 0x2708u, unscii_block145 },
+	{ 0x2713u, 0x2713u, unscii_block146 },
+	{ 0x2734u, 0x2735u, unscii_block147 },
+	{ 0x2764u, 0x2764u, unscii_block148 },
+	{ 0x2800u, 0x28ffu, unscii_block149 },
+	{ 0x29c9u, 0x29c9u, unscii_block150 },
+	{ 0x2b12u, 0x2b19u, unscii_block151 },
+	{ 0x2b1du, 0x2b1du, unscii_block152 },
+	{ 0x2b24u, 0x2b2fu, unscii_block153 },
+	{ 0x2b55u, 0x2b55u, unscii_block154 },
+	{ 0x2b58u, 0x2b58u, unscii_block155 },
+	{ 0x2b73u, 0x2b73u, unscii_block156 },
+	{ 0x2b9cu, 0x2b9fu, unscii_block157 },
+	{ 0x2bbau, 0x2bbau, unscii_block158 },
+	{ 0x2bc0u, 0x2bc0u, unscii_block159 },
+	{ 0x2bc5u, 0x2bc8u, unscii_block160 },
+	{ 0x2bcau, 0x2bcbu, unscii_block161 },
+	{ 0x2e2eu, 0x2e2eu, unscii_block162 },
+	{ 0x4dc0u, 0x4dffu, unscii_block163 },
+	{ 0xe080u, 0xe1aau, unscii_block164 },
+	{ 0xe800u, 0xe87du, unscii_block165 },
+	{ 0xec00u, 0xec07u, unscii_block166 },
+	{ 0xec0au, 0xec7du, unscii_block167 },
+	{ 0xec7fu, 0xecdeu, unscii_block168 },
+	{ 0xfe81u, 0xfe82u, unscii_block169 },
+	{ 0xfe84u, 0xfe84u, unscii_block170 },
+	{ 0xfe87u, 0xfe87u, unscii_block171 },
+	{ 0xfe8fu, 0xfe9cu, unscii_block172 },
+	{ 0xfe9eu, 0xfea4u, unscii_block173 },
+	{ 0xfea9u, 0xfeadu, unscii_block174 },
+	{ 0xfeafu, 0xfeafu, unscii_block175 },
+	{ 0xfeb1u, 0xfeb7u, unscii_block176 },
+	{ 0xfeb9u, 0xfebcu, unscii_block177 },
+	{ 0xfec1u, 0xfec6u, unscii_block178 },
+	{ 0xfec9u, 0xfeddu, unscii_block179 },
+	{ 0xfedfu, 0xfee3u, unscii_block180 },
+	{ 0xfee5u, 0xfee9u, unscii_block181 },
+	{ 0xfeebu, 0xfef4u, unscii_block182 },
+	{ 0xff01u, 0xff36u, unscii_block183 },
+	{ 0xff38u, 0xff5du, unscii_block184 },
+	{ 0xff5fu, 0xff9fu, unscii_block185 },
+	{ 0x1d300u, 0x1d356u, unscii_block186 },
+	{ 0x1f332u, 0x1f333u, unscii_block187 },
+	{ 0x1f344u, 0x1f345u, unscii_block188 },
+	{ 0x1f34eu, 0x1f34fu, unscii_block189 },
+	{ 0x1f37au, 0x1f37au, unscii_block190 },
+	{ 0x1f37eu, 0x1f37eu, unscii_block191 },
+	{ 0x1f3ceu, 0x1f3ceu, unscii_block192 },
+	{ 0x1f3d0u, 0x1f3d0u, unscii_block193 },
+	{ 0x1f3f0u, 0x1f3f0u, unscii_block194 },
+	{ 0x1f407u, 0x1f408u, unscii_block195 },
+	{ 0x1f40du, 0x1f40du, unscii_block196 },
+	{ 0x1f419u, 0x1f419u, unscii_block197 },
+	{ 0x1f41fu, 0x1f41fu, unscii_block198 },
+	{ 0x1f42au, 0x1f42au, unscii_block199 },
+	{ 0x1f47bu, 0x1f47bu, unscii_block200 },
+	{ 0x1f47eu, 0x1f47eu, unscii_block201 },
+	{ 0x1f480u, 0x1f480u, unscii_block202 },
+	{ 0x1f48du, 0x1f48eu, unscii_block203 },
+	{ 0x1f4a7u, 0x1f4a7u, unscii_block204 },
+	{ 0x1f4adu, 0x1f4adu, unscii_block205 },
+	{ 0x1f4b0u, 0x1f4b0u, unscii_block206 },
+	{ 0x1f4beu, 0x1f4beu, unscii_block207 },
+	{ 0x1f4c1u, 0x1f4c1u, unscii_block208 },
+	{ 0x1f4c4u, 0x1f4c4u, unscii_block209 },
+	{ 0x1f4dcu, 0x1f4dcu, unscii_block210 },
+	{ 0x1f4fbu, 0x1f4fbu, unscii_block211 },
+	{ 0x1f514u, 0x1f514u, unscii_block212 },
+	{ 0x1f52bu, 0x1f52bu, unscii_block213 },
+	{ 0x1f52eu, 0x1f52eu, unscii_block214 },
+	{ 0x1f574u, 0x1f574u, unscii_block215 },
+	{ 0x1f577u, 0x1f577u, unscii_block216 },
+	{ 0x1f5a8u, 0x1f5a8u, unscii_block217 },
+	{ 0x1f5d1u, 0x1f5d1u, unscii_block218 },
+	{ 0x1f68du, 0x1f68du, unscii_block219 },
+	{ 0x1f6d6u, 0x1f6d6u, unscii_block220 },
+	{ 0x1f6f8u, 0x1f6f8u, unscii_block221 },
+	{ 0x1f860u, 0x1f860u, unscii_block222 },
+	{ 0x1f986u, 0x1f986u, unscii_block223 },
+	{ 0x1f98bu, 0x1f98bu, unscii_block224 },
+	{ 0x1f9f2u, 0x1f9f2u, unscii_block225 },
+	{ 0x1fa90u, 0x1fa90u, unscii_block226 },
+	{ 0x1fa93u, 0x1fa93u, unscii_block227 },
+	{ 0x1fa99u, 0x1fa99u, unscii_block228 },
+	{ 0x1fa9cu, 0x1fa9cu, unscii_block229 },
+	{ 0x1faa6u, 0x1faa8u, unscii_block230 },
+	{ 0x1fb00u, 0x1fbcau, unscii_block231 },
+	{ 0x1fbf0u, 0x1fbf9u, unscii_block232 },
+};
@@ -913,3 +913,98 @@ static const unsigned char veggie_block93[][16] = {
 	{ 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xee, 0xee, 0xd6, 0xee, 0xee, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00 },	// U+FFFF (￿)
 }; // 1
 
+static const FBInkGlyphRange veggie_ranges[] = {
+	{ 0x20u, 0x7eu, veggie_block1 },
+	{ 0xa0u, 0x113u, veggie_block2 },
+	{ 0x116u, 0x12bu, veggie_block3 },
+	{ 0x12eu, 0x131u, veggie_block4 },
+	{ 0x134u, 0x13eu, veggie_block5 },
+	{ 0x141u, 0x148u, veggie_block6 },
+	{ 0x14au, 0x14du, veggie_block7 },
+	{ 0x150u, 0x17eu, veggie_block8 },
+	{ 0x192u, 0x192u, veggie_block9 },
+	{ 0x218u, 0x21bu, veggie_block10 },
+	{ 0x2c7u, 0x2c7u, veggie_block11 },
+	{ 0x2d8u, 0x2d9u, veggie_block12 },
+	{ 0x2dbu, 0x2dbu, veggie_block13 },
+	{ 0x2ddu, 0x2ddu, veggie_block14 },
+	{ 0x37au, 0x37au, veggie_block15 },
+	{ 0x37eu, 0x37eu, veggie_block16 },
+	{ 0x384u, 0x386u, veggie_block17 },
+	{ 0x388u, 0x38au, veggie_block18 },
+	{ 0x38cu, 0x38cu, veggie_block19 },
+	{ 0x38eu, 0x3a1u, veggie_block20 },
+	{ 0x3a3u, 0x3ceu, veggie_block21 },
+	{ 0x401u, 0x44fu, veggie_block22 },
+	{ 0x451u, 0x45fu, veggie_block23 },
+	{ 0x490u, 0x491u, veggie_block24 },
+	{ 0x1e02u, 0x1e03u, veggie_block25 },
+	{ 0x1e0au, 0x1e0bu, veggie_block26 },
+	{ 0x1e1eu, 0x1e1fu, veggie_block27 },
+	{ 0x1e40u, 0x1e41u, veggie_block28 },
+	{ 0x1e56u, 0x1e57u, veggie_block29 },
+	{ 0x1e60u, 0x1e61u, veggie_block30 },
+	{ 0x1e6au, 0x1e6bu, veggie_block31 },
+	{ 0x1e80u, 0x1e85u, veggie_block32 },
+	{ 0x1ef2u, 0x1ef3u, veggie_block33 },
+	{ 0x2015u, 0x2015u, veggie_block34 },
+	{ 0x2018u, 0x2019u, veggie_block35 },
+	{ 0x201bu, 0x2022u, veggie_block36 },
+	{ 0x2026u, 0x2026u, veggie_block37 },
+	{ 0x2030u, 0x2030u, veggie_block38 },
+	{ 0x203cu, 0x203du, veggie_block39 },
+	{ 0x207fu, 0x207fu, veggie_block40 },
+	{ 0x20a7u, 0x20a7u, veggie_block41 },
+	{ 0x20acu, 0x20acu, veggie_block42 },
+	{ 0x20afu, 0x20afu, veggie_block43 },
+	{ 0x2116u, 0x2116u, veggie_block44 },
+	{ 0x2122u, 0x2122u, veggie_block45 },
+	{ 0x2190u, 0x2195u, veggie_block46 },
+	{ 0x21a8u, 0x21a8u, veggie_block47 },
+	{ 0x21b5u, 0x21b5u, veggie_block48 },
+	{ 0x2219u, 0x221au, veggie_block49 },
+	{ 0x221eu, 0x221fu, veggie_block50 },
+	{ 0x2229u, 0x2229u, veggie_block51 },
+	{ 0x2248u, 0x2248u, veggie_block52 },
+	{ 0x2260u, 0x2261u, veggie_block53 },
+	{ 0x2264u, 0x2265u, veggie_block54 },
+	{ 0x2302u, 0x2302u, veggie_block55 },
+	{ 0x2310u, 0x2310u, veggie_block56 },
+	{ 0x2320u, 0x2321u, veggie_block57 },
+	{ 0x2500u, 0x2500u, veggie_block58 },
+	{ 0x2502u, 0x2502u, veggie_block59 },
+	{ 0x250cu, 0x250cu, veggie_block60 },
+	{ 0x2510u, 0x2510u, veggie_block61 },
+	{ 0x2514u, 0x2514u, veggie_block62 },
+	{ 0x2518u, 0x2518u, veggie_block63 },
+	{ 0x251cu, 0x251cu, veggie_block64 },
+	{ 0x2524u, 0x2524u, veggie_block65 },
+	{ 0x252cu, 0x252cu, veggie_block66 },
+	{ 0x2534u, 0x2534u, veggie_block67 },
+	{ 0x253cu, 0x253cu, veggie_block68 },
+	{ 0x2550u, 0x256cu, veggie_block69 },
+	{ 0x2580u, 0x2580u, veggie_block70 },
+	{ 0x2584u, 0x2584u, veggie_block71 },
+	{ 0x2588u, 0x2588u, veggie_block72 },
+	{ 0x258cu, 0x258cu, veggie_block73 },
+	{ 0x2590u, 0x2593u, veggie_block74 },
+	{ 0x25a0u, 0x25a0u, veggie_block75 },
+	{ 0x25acu, 0x25acu, veggie_block76 },
+	{ 0x25b2u, 0x25b2u, veggie_block77 },
+	{ 0x25b6u, 0x25b6u, veggie_block78 },
+	{ 0x25bcu, 0x25bcu, veggie_block79 },
+	{ 0x25c0u, 0x25c0u, veggie_block80 },
+	{ 0x25cbu, 0x25cbu, veggie_block81 },
+	{ 0x25d8u, 0x25d9u, veggie_block82 },
+	{ 0x263au, 0x263cu, veggie_block83 },
+	{ 0x2640u, 0x2640u, veggie_block84 },
+	{ 0x2642u, 0x2642u, veggie_block85 },
+	{ 0x2660u, 0x2660u, veggie_block86 },
+	{ 0x2663u, 0x2663u, veggie_block87 },
+	{ 0x2665u, 0x2666u, veggie_block88 },
+	{ 0x266au, 0x266bu, veggie_block89 },
+	{ 0xe0a0u, 0xe0a2u, veggie_block90 },
+	{ 0xe0b0u, 0xe0b3u, veggie_block91 },
+	{ 0xfffdu, 0xfffdu, veggie_block92 },
+	{ 0xffffu, 0xffffu, veggie_block93 },
+};
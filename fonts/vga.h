@@ -1137,3 +1137,114 @@ static const unsigned char vga_block109[][16] = {
 	{ 0xff, 0xff, 0xc1, 0x9c, 0x9c, 0xcf, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff },	// U+FFFD (�)
 }; // 1
 
+static const FBInkGlyphRange vga_ranges[] = {
+	{ 0x00u, 0x7fu, vga_block1 },
+	{ 0xa0u, 0x17fu, vga_block2 },
+	{ 0x192u, 0x192u, vga_block3 },
+	{ 0x1a1u, 0x1a1u, vga_block4 },
+	{ 0x1b7u, 0x1b7u, vga_block5 },
+	{ 0x1fau, 0x1ffu, vga_block6 },
+	{ 0x218u, 0x21bu, vga_block7 },
+	{ 0x251u, 0x251u, vga_block8 },
+	{ 0x278u, 0x278u, vga_block9 },
+	{ 0x2c6u, 0x2c7u, vga_block10 },
+	{ 0x2c9u, 0x2c9u, vga_block11 },
+	{ 0x2d8u, 0x2ddu, vga_block12 },
+	{ 0x37eu, 0x37eu, vga_block13 },
+	{ 0x384u, 0x38au, vga_block14 },
+	{ 0x38cu, 0x38cu, vga_block15 },
+	{ 0x38eu, 0x3a1u, vga_block16 },
+	{ 0x3a3u, 0x3ceu, vga_block17 },
+	{ 0x3d0u, 0x3d0u, vga_block18 },
+	{ 0x3f4u, 0x3f4u, vga_block19 },
+	{ 0x400u, 0x45fu, vga_block20 },
+	{ 0x490u, 0x491u, vga_block21 },
+	{ 0x5beu, 0x5beu, vga_block22 },
+	{ 0x5d0u, 0x5eau, vga_block23 },
+	{ 0x5f0u, 0x5f4u, vga_block24 },
+	{ 0x1d1bu, 0x1d1bu, vga_block25 },
+	{ 0x1d26u, 0x1d26u, vga_block26 },
+	{ 0x1d28u, 0x1d28u, vga_block27 },
+	{ 0x1e80u, 0x1e85u, vga_block28 },
+	{ 0x1e9fu, 0x1e9fu, vga_block29 },
+	{ 0x1ef2u, 0x1ef3u, vga_block30 },
+	{ 0x2010u, 0x2010u, vga_block31 },
+	{ 0x2012u, 0x2015u, vga_block32 },
+	{ 0x2017u, 0x2022u, vga_block33 },
+	{ 0x2026u, 0x2027u, vga_block34 },
+	{ 0x2030u, 0x2030u, vga_block35 },
+	{ 0x2032u, 0x2033u, vga_block36 },
+	{ 0x2035u, 0x2035u, vga_block37 },
+	{ 0x2039u, 0x203au, vga_block38 },
+	{ 0x203cu, 0x203cu, vga_block39 },
+	{ 0x203eu, 0x2040u, vga_block40 },
+	{ 0x2044u, 0x2044u, vga_block41 },
+	{ 0x2054u, 0x2054u, vga_block42 },
+	{ 0x2074u, 0x207bu, vga_block43 },
+	{ 0x207fu, 0x207fu, vga_block44 },
+	{ 0x2081u, 0x208bu, vga_block45 },
+	{ 0x20a3u, 0x20a4u, vga_block46 },
+	{ 0x20a7u, 0x20a7u, vga_block47 },
+	{ 0x20aau, 0x20aau, vga_block48 },
+	{ 0x20acu, 0x20acu, vga_block49 },
+	{ 0x2105u, 0x2105u, vga_block50 },
+	{ 0x2113u, 0x2113u, vga_block51 },
+	{ 0x2116u, 0x2116u, vga_block52 },
+	{ 0x2122u, 0x2122u, vga_block53 },
+	{ 0x2126u, 0x2126u, vga_block54 },
+	{ 0x212eu, 0x212eu, vga_block55 },
+	{ 0x2150u, 0x2151u, vga_block56 },
+	{ 0x2153u, 0x215eu, vga_block57 },
+	{ 0x2190u, 0x2195u, vga_block58 },
+	{ 0x21a8u, 0x21a8u, vga_block59 },
+	{ 0x2202u, 0x2202u, vga_block60 },
+	{ 0x2205u, 0x2206u, vga_block61 },
+	{ 0x2208u, 0x2208u, vga_block62 },
+	{ 0x220fu, 0x220fu, vga_block63 },
+	{ 0x2211u, 0x2212u, vga_block64 },
+	{ 0x2215u, 0x2215u, vga_block65 },
+	{ 0x2219u, 0x221au, vga_block66 },
+	{ 0x221eu, 0x221fu, vga_block67 },
+	{ 0x2229u, 0x2229u, vga_block68 },
+	{ 0x222bu, 0x222bu, vga_block69 },
+	{ 0x2248u, 0x2248u, vga_block70 },
+	{ 0x2260u, 0x2261u, vga_block71 },
+	{ 0x2264u, 0x2265u, vga_block72 },
+	{ 0x2299u, 0x2299u, vga_block73 },
+	{ 0x2300u, 0x2300u, vga_block74 },
+	{ 0x2302u, 0x2302u, vga_block75 },
+	{ 0x2310u, 0x2310u, vga_block76 },
+	{ 0x2320u, 0x2321u, vga_block77 },
+	{ 0x2500u, 0x2500u, vga_block78 },
+	{ 0x2502u, 0x2502u, vga_block79 },
+	{ 0x250cu, 0x250cu, vga_block80 },
+	{ 0x2510u, 0x2510u, vga_block81 },
+	{ 0x2514u, 0x2514u, vga_block82 },
+	{ 0x2518u, 0x2518u, vga_block83 },
+	{ 0x251cu, 0x251cu, vga_block84 },
+	{ 0x2524u, 0x2524u, vga_block85 },
+	{ 0x252cu, 0x252cu, vga_block86 },
+	{ 0x2534u, 0x2534u, vga_block87 },
+	{ 0x253cu, 0x253cu, vga_block88 },
+	{ 0x2550u, 0x256cu, vga_block89 },
+	{ 0x2580u, 0x25a1u, vga_block90 },
+	{ 0x25aau, 0x25acu, vga_block91 },
+	{ 0x25b2u, 0x25b2u, vga_block92 },
+	{ 0x25bau, 0x25bau, vga_block93 },
+	{ 0x25bcu, 0x25bcu, vga_block94 },
+	{ 0x25c4u, 0x25c4u, vga_block95 },
+	{ 0x25cau, 0x25cbu, vga_block96 },
+	{ 0x25cfu, 0x25cfu, vga_block97 },
+	{ 0x25d8u, 0x25d9u, vga_block98 },
+	{ 0x25e6u, 0x25e6u, vga_block99 },
+	{ 0x263au, 0x263cu, vga_block100 },
+	{ 0x2640u, 0x2640u, vga_block101 },
+	{ 0x2642u, 0x2642u, vga_block102 },
+	{ 0x2660u, 0x2660u, vga_block103 },
+	{ 0x2663u, 0x2663u, vga_block104 },
+	{ 0x2665u, 0x2666u, vga_block105 },
+	{ 0x266au, 0x266bu, vga_block106 },
+	{ 0x2713u, 0x2713u, vga_block107 },
+	{ 0xfb01u, 0xfb02u, vga_block108 },
+	{ 0xfffdu, 0xfffdu, vga_block109 },
+};
@@ -21,9 +21,13 @@
 import re
 import sys
 
-# We'll send the C header to stdout, but our C if/else snippet to stderr... ;).
+# We'll send the C header (glyphs & range table) to stdout, but our C lookup function to stderr... ;).
 # And then use your shell to handle the I/O redirections, because I'm lazy :D.
 # ./hextoc.py unscii > ../fonts/unscii.h 2>> ../fbink_unscii.c
+# An optional list of comma-separated codepoints or codepoint ranges can be passed as a second argument,
+# in which case only those glyphs will be emitted (this is what the Makefile's FONT_RANGES knob relies on).
+# The first glyph of the font is always kept, as it's the fallback for codepoints the font doesn't cover.
+# ./hextoc.py terminus 0x20-0x7e,0xa0-0xff,0x2026 > terminus.h
 def eprint(*args, **kwargs):
 	print(*args, file=sys.stderr, **kwargs)
 
@@ -112,6 +116,30 @@ def hex2f64(v):
 	print("Available: {}".format(', '.join([k for k in font_set.keys()])))
 	sys.exit(-1)
 
+# And, optionally, the subset of codepoints we want to keep, as a list of (first, last) tuples
+subset = []
+if len(sys.argv) > 2 and sys.argv[2]:
+	for r in sys.argv[2].split(","):
+		bounds = r.strip().split("-")
+		try:
+			first = int(bounds[0], base=0)
+			last = int(bounds[-1], base=0)
+		except ValueError:
+			print("Invalid codepoint range '{}'!".format(r))
+			sys.exit(-1)
+		if len(bounds) > 2 or first > last:
+			print("Invalid codepoint range '{}'!".format(r))
+			sys.exit(-1)
+		subset.append((first, last))
+
+def is_wanted(hcp):
+	if not subset:
+		return True
+	for (first, last) in subset:
+		if first <= hcp <= last:
+			return True
+	return False
+
 # And populate that specific font's settings
 fontfile = os.path.dirname(os.path.abspath(__file__)) + "/../fonts/" + font_set[fontname][0]
 fontwidth = font_set[fontname][1]
@@ -128,6 +156,8 @@ def hex2f64(v):
 
 blocknum = 0
 blockcount = 1
+# List of (first codepoint, last codepoint, block number) tuples
+ranges = []
 blockcp = 0x0
 cp = 0x0
 prevcp = -42
@@ -153,45 +183,15 @@ def hex2f64(v):
 		if m:
 			cp = m.group(1)
 			hcp = int(cp, base=16)
+			if blocknum > 0 and not is_wanted(hcp):
+				continue
 			if hcp == prevcp + 0x1:
 				blockcount += 1
 			else:
 				if blocknum > 0:
 					print("}}; // {}".format(blockcount))
 					print("")
-					if blocknum == 1:
-						if fontwidth <= 8:
-							eprint("static const unsigned char*")
-						elif fontwidth <= 16:
-							eprint("static const uint16_t*")
-						elif fontwidth <= 32:
-							eprint("static const uint32_t*")
-						elif fontwidth <= 64:
-							eprint("static const uint64_t*")
-						else:
-							exit(-1)
-						eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
-						eprint("{")
-						if blockcp > 0 :
-							if blockcp == prevcp:
-								eprint("\tif (codepoint == {:#04x}u) {{".format(blockcp))
-								eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-							else:
-								eprint("\tif (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-								eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
-						else:
-							if prevcp == 0:
-								eprint("\tif (codepoint == {:#04x}u) {{".format(prevcp))
-							else:
-								eprint("\tif (codepoint <= {:#04x}u) {{".format(prevcp))
-							eprint("\t\treturn {}_block{}[codepoint];".format(fontname, blocknum))
-					else:
-						if blockcp == prevcp:
-							eprint("\t}} else if (codepoint == {:#04x}u) {{".format(blockcp))
-							eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-						else:
-							eprint("\t}} else if (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-							eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
+					ranges.append((blockcp, prevcp, blocknum))
 				blocknum += 1
 				blockcount = 1
 				blockcp = hcp
@@ -223,48 +223,45 @@ def hex2f64(v):
 				exit(-1)
 			print(u" }},\t// U+{} ({})".format(cp, chr(hcp) if hcp >= 0x20 else "ESC"))
 			prevcp = hcp
+if blocknum == 0:
+	print("No {}x{} glyphs found in '{}'!".format(fontwidth, fontheight, fontfile))
+	sys.exit(-1)
 print("}}; // {}".format(blockcount))
 print("")
 
-# Handle single block fonts
-if blocknum == 1:
-	if fontwidth <= 8:
-		eprint("static const unsigned char*")
-	elif fontwidth <= 16:
-		eprint("static const uint16_t*")
-	elif fontwidth <= 32:
-		eprint("static const uint32_t*")
-	elif fontwidth <= 64:
-		eprint("static const uint64_t*")
-	else:
-		exit(-1)
-	eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
-	eprint("{")
-	if blockcp > 0:
-		if blockcp == prevcp:
-			eprint("\tif (codepoint == {:#04x}u) {{".format(blockcp))
-			eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-		else:
-			eprint("\tif (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-			eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
-	else:
-		if prevcp == 0:
-			eprint("\tif (codepoint == {:#04x}u) {{".format(prevcp))
-		else:
-			eprint("\tif (codepoint <= {:#04x}u) {{".format(prevcp))
-		eprint("\t\treturn {}_block{}[codepoint];".format(fontname, blocknum))
-else:
-	# Otherwise, don't forget the final block ;)
-	if blockcp == prevcp:
-		eprint("\t}} else if (codepoint == {:#04x}u) {{".format(blockcp))
-		eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-	else:
-		eprint("\t}} else if (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-		eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
+# Don't forget the final block ;)
+ranges.append((blockcp, prevcp, blocknum))
 
-eprint("\t} else {")
-eprint('\t\tWARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));')
-eprint("\t\treturn {}_block1[0];".format(fontname))
+# The lookup goes through a sorted table of codepoint ranges (c.f., font_lookup_glyph in fbink.c)
+print("static const FBInkGlyphRange {}_ranges[] = {{".format(fontname))
+for (first, last, block) in ranges:
+	print("\t{{ {:#04x}u, {:#04x}u, {}_block{} }},".format(first, last, fontname, block))
+print("};")
+if fontwidth <= 8:
+	rtype = "unsigned char"
+elif fontwidth <= 16:
+	rtype = "uint16_t"
+elif fontwidth <= 32:
+	rtype = "uint32_t"
+elif fontwidth <= 64:
+	rtype = "uint64_t"
+else:
+	exit(-1)
+eprint("static const {}*".format(rtype))
+eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
+eprint("{")
+decl = "\tconst {}* bitmap =".format(rtype)
+call = "font_lookup_glyph({0}_ranges, ARRAY_SIZE({0}_ranges), codepoint, sizeof(*{0}_block1));".format(fontname)
+# Mimic clang-format's ColumnLimit
+if len("{} {}".format(decl, call).expandtabs(8)) <= 122:
+	eprint("{} {}".format(decl, call))
+else:
+	eprint("{}\n\t    {}".format(decl, call))
+eprint("\tif (likely(bitmap)) {")
+eprint("\t\treturn bitmap;")
 eprint("\t}")
+eprint("")
+eprint('\tWARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));')
+eprint("\treturn {}_block1[0];".format(fontname))
 eprint("}")
 eprint("")
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# -*- coding:utf-8 -*-
+#
+# FBInk related tool, Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# Build a bitmap font pack (.fbf) out of Unifont's hex format, for FBInk to mmap at runtime (c.f., fbink_fontpack.h).
+# This is the runtime counterpart of hextoc.py: same input, same bit mirroring, but no rebuild required.
+# NOTE: As with hextoc.py, BDF fonts should be converted to hex first (via unibdf2hex, preferably).
+#       Widths up to 32 are supported, rows are stored as uint8_t for <= 8, uint16_t for <= 16, and uint32_t for <= 32.
+#
+# Usage: ./hextopack.py font.hex width height font.fbf
+#        Then use it via fbink -F /path/to/font.fbf, or drop it in FBInk's pack directory and use fbink -F font
+#
+##
+
+import re
+import struct
+import sys
+
+# Keep in sync with fbink_fontpack.h
+PACK_MAGIC = b"FBINKFNT"
+PACK_VERSION = 1
+PACK_MAX_SIZE = 32
+
+# c.f., hextoc.py for the why & how of the mirroring
+def hex2f8(v):
+	h = int(v, base=16)
+	return ((h * 0x0202020202 & 0x010884422010) % 1023)
+
+def hex2f16(v):
+	h = int(v, base=16)
+	return int(bin(h)[2:].zfill(16)[::-1], 2)
+
+def hex2f32(v):
+	h = int(v, base=16)
+	return int(bin(h)[2:].zfill(32)[::-1], 2)
+
+if len(sys.argv) != 5:
+	print("Usage: {} font.hex width height font.fbf".format(sys.argv[0]))
+	sys.exit(-1)
+
+fontfile = sys.argv[1]
+fontwidth = int(sys.argv[2])
+fontheight = int(sys.argv[3])
+packfile = sys.argv[4]
+
+if not 0 < fontwidth <= PACK_MAX_SIZE or not 0 < fontheight <= PACK_MAX_SIZE:
+	print("Unsupported font size (Must be <= {}x{})!".format(PACK_MAX_SIZE, PACK_MAX_SIZE))
+	sys.exit(-1)
+
+if fontwidth <= 8:
+	row_size, row_fmt, pat_rows, mirror = 1, "B", "([0-9a-fA-F]{2})", hex2f8
+elif fontwidth <= 16:
+	row_size, row_fmt, pat_rows, mirror = 2, "H", "([0-9a-fA-F]{4})", hex2f16
+else:
+	row_size, row_fmt, pat_rows, mirror = 4, "I", "([0-9a-fA-F]{8})", hex2f32
+fmt = re.compile(r"^([0-9a-fA-F]{{4,8}}):{}$".format(pat_rows * fontheight))
+
+# Codepoint -> list of rows
+glyphs = {}
+with open(fontfile, "r") as f:
+	for line in f:
+		m = fmt.match(line)
+		if m:
+			glyphs[int(m.group(1), base=16)] = [mirror(m.group(i+2)) for i in range(fontheight)]
+
+if not glyphs:
+	print("No {}x{} glyphs found in '{}'!".format(fontwidth, fontheight, fontfile))
+	sys.exit(-1)
+
+# Coalesce contiguous codepoints into (first, last, first glyph index) ranges
+codepoints = sorted(glyphs.keys())
+ranges = []
+for idx, cp in enumerate(codepoints):
+	if ranges and cp == ranges[-1][1] + 1:
+		ranges[-1][1] = cp
+	else:
+		ranges.append([cp, cp, idx])
+
+# Everything is little-endian
+with open(packfile, "wb") as f:
+	f.write(struct.pack("<8sHBBB3xII", PACK_MAGIC, PACK_VERSION, fontwidth, fontheight, row_size, len(ranges), len(codepoints)))
+	for (first, last, glyph) in ranges:
+		f.write(struct.pack("<III", first, last, glyph))
+	# Pad the glyph data to a 4 bytes boundary
+	f.write(b"\0" * (-f.tell() % 4))
+	for cp in codepoints:
+		f.write(struct.pack("<{}{}".format(fontheight, row_fmt), *glyphs[cp]))
+
+print("Packed {} glyphs in {} ranges to '{}'".format(len(codepoints), len(ranges), packfile))
@@ -0,0 +1,278 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Microbenchmark for the blit engine (c.f., fill_span*, blit_copy & blit_fence in fbink.c).
+// Measures fill & copy throughput for every pixel width we handle, both on the actual fb mapping (write-combined),
+// and on a plain heap buffer of the same size (cached), as a point of reference.
+// NOTE: Nothing is ever refreshed, and the fb content is restored on exit, so this should be invisible on an eInk screen.
+
+// Because we're pretty much Linux-bound ;).
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
+
+#ifndef FBINK_WITH_DRAW
+#	error Cannot build this tool without Draw support!
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+// I feel dirty.
+#include "../fbink.c"
+
+#define BILLION 1000000000L
+
+typedef enum
+{
+	BENCH_SCALAR = 0U,    // Plain loops (fill), or memcpy (copy)
+	BENCH_STORE,          // Blit engine, regular stores
+	BENCH_STREAM,         // Blit engine, non-temporal stores (if available)
+	BENCH_MAX = 0xFFu,    // uint8_t
+} __attribute__((packed)) BENCH_MODE_E;
+typedef uint8_t BENCH_MODE_T;
+
+static const char*
+    bench_mode_to_string(BENCH_MODE_T mode)
+{
+	switch (mode) {
+		case BENCH_SCALAR:
+			return "scalar";
+		case BENCH_STORE:
+			return "burst";
+		case BENCH_STREAM:
+			return "stream";
+		default:
+			return "unknown";
+	}
+}
+
+static long
+    elapsed_ns(const struct timespec* restrict t0, const struct timespec* restrict t1)
+{
+	return ((t1->tv_sec * BILLION) + t1->tv_nsec) - ((t0->tv_sec * BILLION) + t0->tv_nsec);
+}
+
+// The naive per-pixel loops the blit engine replaced
+static void __attribute__((noinline))
+    scalar_fill(unsigned char* restrict dst, size_t len, uint8_t bpp)
+{
+	if (bpp == 32U) {
+		volatile uint32_t* p = (volatile uint32_t*) (void*) dst;
+		for (size_t i = 0U; i < len >> 2U; i++) {
+			p[i] = 0xFF808080u;
+		}
+	} else if (bpp == 16U) {
+		volatile uint16_t* p = (volatile uint16_t*) (void*) dst;
+		for (size_t i = 0U; i < len >> 1U; i++) {
+			p[i] = 0x8410u;
+		}
+	} else {
+		volatile uint8_t* p = dst;
+		for (size_t i = 0U; i < len; i++) {
+			p[i] = 0x80u;
+		}
+	}
+}
+
+static void __attribute__((noinline))
+    engine_fill(unsigned char* restrict dst, size_t len, uint8_t bpp, bool stream)
+{
+	if (bpp == 32U) {
+		fill_span32((uint32_t*) (void*) dst, 0xFF808080u, len >> 2U, stream);
+	} else if (bpp == 16U) {
+		fill_span16((uint16_t*) (void*) dst, 0x8410u, len >> 1U, stream);
+	} else {
+		fill_span8(dst, 0x80u, len, stream);
+	}
+	blit_fence(stream);
+}
+
+static void __attribute__((noinline))
+    engine_copy(unsigned char* restrict dst, const unsigned char* restrict src, size_t len, BENCH_MODE_T mode)
+{
+	if (mode == BENCH_SCALAR) {
+		memcpy(dst, src, len);
+	} else {
+		blit_copy(dst, src, len, mode == BENCH_STREAM);
+		blit_fence(mode == BENCH_STREAM);
+	}
+}
+
+// Returns the throughput in MB/s
+static double
+    bench_fill(unsigned char* restrict dst, size_t len, uint8_t bpp, BENCH_MODE_T mode, size_t iterations)
+{
+	struct timespec t0;
+	struct timespec t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (size_t i = 0U; i < iterations; i++) {
+		if (mode == BENCH_SCALAR) {
+			scalar_fill(dst, len, bpp);
+		} else {
+			engine_fill(dst, len, bpp, mode == BENCH_STREAM);
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	const long ns = elapsed_ns(&t0, &t1);
+	return ((double) len * (double) iterations * 1000.0) / (double) ns;
+}
+
+static double
+    bench_copy(unsigned char* restrict dst,
+	       const unsigned char* restrict src,
+	       size_t       len,
+	       BENCH_MODE_T mode,
+	       size_t       iterations)
+{
+	struct timespec t0;
+	struct timespec t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (size_t i = 0U; i < iterations; i++) {
+		engine_copy(dst, src, len, mode);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	const long ns = elapsed_ns(&t0, &t1);
+	return ((double) len * (double) iterations * 1000.0) / (double) ns;
+}
+
+static void
+    bench_target(const char* name,
+		 unsigned char* restrict dst,
+		 const unsigned char* restrict src,
+		 size_t len,
+		 size_t iterations)
+{
+	// NOTE: 8bpp covers Y4, Y8 & the 24bpp formats, too (as both of those boil down to a memset)
+	static const uint8_t bpps[] = { 8U, 16U, 32U };
+
+	printf("\n%s (%zu bytes, %zu passes)\n", name, len, iterations);
+	printf("%-12s %12s %12s %12s\n",
+	       "",
+	       bench_mode_to_string(BENCH_SCALAR),
+	       bench_mode_to_string(BENCH_STORE),
+	       bench_mode_to_string(BENCH_STREAM));
+	for (size_t b = 0U; b < sizeof(bpps); b++) {
+		printf("fill %2hhubpp  ", bpps[b]);
+		for (BENCH_MODE_T mode = BENCH_SCALAR; mode <= BENCH_STREAM; mode++) {
+			printf(" %7.1f MB/s", bench_fill(dst, len, bpps[b], mode, iterations));
+		}
+		printf("\n");
+	}
+	printf("%-12s ", "copy");
+	for (BENCH_MODE_T mode = BENCH_SCALAR; mode <= BENCH_STREAM; mode++) {
+		printf(" %7.1f MB/s", bench_copy(dst, src, len, mode, iterations));
+	}
+	printf("\n");
+}
+
+// Main entry point
+int
+    main(int argc, char* argv[])
+{
+	// For the LOG & ELOG macros
+	g_isQuiet   = false;
+	g_isVerbose = false;
+
+	FBInkConfig fbink_cfg = { 0 };
+	fbink_cfg.is_quiet    = true;
+
+	size_t iterations = 32U;
+	if (argc > 1) {
+		iterations = strtoul(argv[1], NULL, 10);
+		if (iterations == 0U) {
+			fprintf(stderr, "Usage: %s [passes]\n", argv[0]);
+			return ERRCODE(EXIT_FAILURE);
+		}
+	}
+
+	// Assume success, until shit happens ;)
+	int            rv     = EXIT_SUCCESS;
+	unsigned char* backup = NULL;
+	unsigned char* heap   = NULL;
+	unsigned char* src    = NULL;
+
+	int fbfd = fbink_open();
+	if (fbfd == ERRCODE(EXIT_FAILURE)) {
+		fprintf(stderr, "Failed to open the framebuffer, aborting . . .\n");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	if (fbink_init(fbfd, &fbink_cfg) != EXIT_SUCCESS) {
+		fprintf(stderr, "Failed to initialize FBInk, aborting . . .\n");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	// We also need to mmap the fb
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Only bench the visible area, we don't want to clobber whatever may live in the offscreen part of the mapping.
+	const size_t len = (size_t) fInfo.line_length * vInfo.yres;
+	backup           = malloc(len);
+	heap             = aligned_alloc(BLIT_BURST_BYTES, (len + BLIT_BURST_BYTES - 1U) & ~(BLIT_BURST_BYTES - 1U));
+	src              = malloc(len);
+	if (!backup || !heap || !src) {
+		perror("malloc");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	memcpy(backup, fbPtr, len);
+	for (size_t i = 0U; i < len; i++) {
+		src[i] = (unsigned char) i;
+	}
+
+	printf("Native fb: %ux%u @ %ubpp (line length: %u bytes)\n",
+	       vInfo.xres,
+	       vInfo.yres,
+	       vInfo.bits_per_pixel,
+	       fInfo.line_length);
+#if defined(FBINK_SIMD_STREAM)
+	printf("Blit engine: %u bytes vectors, %u bytes bursts, non-temporal stores\n",
+	       FBINK_SIMD_BYTES,
+	       BLIT_BURST_BYTES);
+#elif defined(FBINK_SIMD_BYTES)
+	printf("Blit engine: %u bytes vectors, %u bytes bursts, no non-temporal stores (%s == %s)\n",
+	       FBINK_SIMD_BYTES,
+	       BLIT_BURST_BYTES,
+	       bench_mode_to_string(BENCH_STORE),
+	       bench_mode_to_string(BENCH_STREAM));
+#else
+	printf("Blit engine: no SIMD, everything boils down to memset/memcpy\n");
+#endif
+
+	bench_target("framebuffer", fbPtr, src, len, iterations);
+	bench_target("heap", heap, src, len, iterations);
+
+	// Put everything back where it was
+	memcpy(fbPtr, backup, len);
+
+cleanup:
+	free(backup);
+	free(heap);
+	free(src);
+	fbink_close(fbfd);
+
+	return rv;
+}